@@ -0,0 +1,346 @@
+#ifndef ADDRESSABLEPRIQUE_H
+#define ADDRESSABLEPRIQUE_H
+
+#include <algorithm>
+#include <limits>
+#include "comparator.h"
+#include "error.h"
+#include "printable.h"
+#include "types.h"
+#include "vector.h"
+
+/**
+ * @file addressablePrique.h
+ * @brief Priority queue whose elements can be changed or removed through handles.
+ */
+
+namespace original {
+
+    /**
+     * @class addressablePrique
+     * @tparam TYPE Type of the elements
+     * @tparam Callback Comparator type, the element comparing first is popped first, as in prique
+     * @tparam ARITY Number of children of each heap node
+     * @brief Indexed ARITY-ary heap handing out a stable handle for every pushed element.
+     * @details Elements stay in a slot named by their handle while the heap itself only orders
+     *          handles, and every handle remembers its position in the heap. So sifting moves
+     *          plain integers, and decreaseKey(), update() and erase() find their element
+     *          directly instead of searching for it, which is what Dijkstra or A* style
+     *          algorithms need.
+     *
+     *          A handle stays valid until its element is popped or erased; afterwards a later
+     *          push may hand it out again.
+     */
+    template<typename TYPE, template <typename> typename Callback = increaseComparator, uint32_t ARITY = 4>
+    requires Compare<Callback<TYPE>, TYPE>
+    class addressablePrique final : public printable {
+        static_assert(ARITY >= 2, "a heap node needs at least two children");
+    public:
+        using handle = uint32_t;
+    private:
+        static constexpr uint32_t NO_POS = std::numeric_limits<uint32_t>::max();
+
+        Callback<TYPE> compare_;
+        vector<TYPE> slots_;
+        vector<uint32_t> pos_;
+        vector<handle> heap_;
+        vector<handle> free_;
+
+        [[nodiscard]] bool prior(handle h1, handle h2);
+        void place(uint32_t index, handle h);
+        void siftUp(uint32_t index);
+        void siftDown(uint32_t index);
+        void validate(handle h) const;
+        handle insert(TYPE&& e);
+        TYPE remove(uint32_t index);
+    public:
+        explicit addressablePrique(const Callback<TYPE>& compare = Callback<TYPE>{});
+
+        [[nodiscard]] uint32_t size() const;
+        [[nodiscard]] bool empty() const;
+        void clear();
+
+        /**
+         * @brief Whether h currently names an element of the queue.
+         */
+        [[nodiscard]] bool contains(handle h) const;
+
+        handle push(const TYPE& e);
+        handle push(TYPE&& e);
+        template<typename... Args>
+        handle emplace(Args&&... args);
+
+        /**
+         * @throw noElementError if the queue is empty.
+         */
+        TYPE pop();
+        TYPE top() const;
+        handle topHandle() const;
+
+        /**
+         * @throw noElementError if h does not name an element of the queue.
+         */
+        TYPE get(handle h) const;
+
+        /**
+         * @brief Replaces the element of h by e, which may move it either way.
+         */
+        void update(handle h, const TYPE& e);
+
+        /**
+         * @brief Replaces the element of h by e, which must not compare after the old element.
+         * @throw valueError if e would pop later than the element it replaces.
+         */
+        void decreaseKey(handle h, const TYPE& e);
+
+        /**
+         * @brief Removes the element of h wherever it is in the heap.
+         * @return The removed element.
+         */
+        TYPE erase(handle h);
+
+        [[nodiscard]] std::string className() const override;
+        [[nodiscard]] std::string toString(bool enter) const override;
+    };
+}
+
+    template <typename TYPE, template <typename> class Callback, uint32_t ARITY>
+    requires original::Compare<Callback<TYPE>, TYPE>
+    original::addressablePrique<TYPE, Callback, ARITY>::addressablePrique(const Callback<TYPE>& compare)
+        : compare_(compare) {}
+
+    template <typename TYPE, template <typename> class Callback, uint32_t ARITY>
+    requires original::Compare<Callback<TYPE>, TYPE>
+    auto original::addressablePrique<TYPE, Callback, ARITY>::prior(const handle h1, const handle h2) -> bool
+    {
+        return this->compare_(this->slots_[h1], this->slots_[h2]);
+    }
+
+    template <typename TYPE, template <typename> class Callback, uint32_t ARITY>
+    requires original::Compare<Callback<TYPE>, TYPE>
+    auto original::addressablePrique<TYPE, Callback, ARITY>::place(const uint32_t index, const handle h) -> void
+    {
+        this->heap_[index] = h;
+        this->pos_[h] = index;
+    }
+
+    // Sifts with a hole: only the handles passed over are moved, h is placed once at the end.
+    template <typename TYPE, template <typename> class Callback, uint32_t ARITY>
+    requires original::Compare<Callback<TYPE>, TYPE>
+    auto original::addressablePrique<TYPE, Callback, ARITY>::siftUp(uint32_t index) -> void
+    {
+        const handle h = this->heap_[index];
+        while (index > 0) {
+            const uint32_t parent = (index - 1) / ARITY;
+            if (!this->prior(h, this->heap_[parent]))
+                break;
+            this->place(index, this->heap_[parent]);
+            index = parent;
+        }
+        this->place(index, h);
+    }
+
+    template <typename TYPE, template <typename> class Callback, uint32_t ARITY>
+    requires original::Compare<Callback<TYPE>, TYPE>
+    auto original::addressablePrique<TYPE, Callback, ARITY>::siftDown(uint32_t index) -> void
+    {
+        const handle h = this->heap_[index];
+        const uint64_t size = this->heap_.size();
+        while (static_cast<uint64_t>(index) * ARITY + 1 < size) {
+            const uint64_t first = static_cast<uint64_t>(index) * ARITY + 1;
+            const uint64_t bound = std::min<uint64_t>(first + ARITY, size);
+            uint32_t child = first;
+            for (uint64_t i = first + 1; i < bound; ++i) {
+                if (this->prior(this->heap_[i], this->heap_[child]))
+                    child = i;
+            }
+            if (!this->prior(this->heap_[child], h))
+                break;
+            this->place(index, this->heap_[child]);
+            index = child;
+        }
+        this->place(index, h);
+    }
+
+    template <typename TYPE, template <typename> class Callback, uint32_t ARITY>
+    requires original::Compare<Callback<TYPE>, TYPE>
+    auto original::addressablePrique<TYPE, Callback, ARITY>::validate(const handle h) const -> void
+    {
+        if (!this->contains(h))
+            throw noElementError();
+    }
+
+    template <typename TYPE, template <typename> class Callback, uint32_t ARITY>
+    requires original::Compare<Callback<TYPE>, TYPE>
+    auto original::addressablePrique<TYPE, Callback, ARITY>::insert(TYPE&& e) -> handle
+    {
+        handle h;
+        if (this->free_.empty()) {
+            h = this->slots_.size();
+            this->slots_.pushEnd(std::move(e));
+            this->pos_.pushEnd(NO_POS);
+        } else {
+            h = this->free_.popEnd();
+            this->slots_[h] = std::move(e);
+        }
+        this->heap_.pushEnd(h);
+        this->pos_[h] = this->heap_.size() - 1;
+        this->siftUp(this->heap_.size() - 1);
+        return h;
+    }
+
+    // Fills the hole at index with the last handle, which then moves whichever way it has to.
+    template <typename TYPE, template <typename> class Callback, uint32_t ARITY>
+    requires original::Compare<Callback<TYPE>, TYPE>
+    auto original::addressablePrique<TYPE, Callback, ARITY>::remove(const uint32_t index) -> TYPE
+    {
+        const handle h = this->heap_[index];
+        const handle last = this->heap_.popEnd();
+        if (index < this->heap_.size()) {
+            this->place(index, last);
+            this->siftDown(index);
+            this->siftUp(this->pos_[last]);
+        }
+        this->pos_[h] = NO_POS;
+        this->free_.pushEnd(h);
+        return std::move(this->slots_[h]);
+    }
+
+    template <typename TYPE, template <typename> class Callback, uint32_t ARITY>
+    requires original::Compare<Callback<TYPE>, TYPE>
+    auto original::addressablePrique<TYPE, Callback, ARITY>::size() const -> uint32_t
+    {
+        return this->heap_.size();
+    }
+
+    template <typename TYPE, template <typename> class Callback, uint32_t ARITY>
+    requires original::Compare<Callback<TYPE>, TYPE>
+    auto original::addressablePrique<TYPE, Callback, ARITY>::empty() const -> bool
+    {
+        return this->heap_.empty();
+    }
+
+    template <typename TYPE, template <typename> class Callback, uint32_t ARITY>
+    requires original::Compare<Callback<TYPE>, TYPE>
+    auto original::addressablePrique<TYPE, Callback, ARITY>::clear() -> void
+    {
+        this->slots_.clear();
+        this->pos_.clear();
+        this->heap_.clear();
+        this->free_.clear();
+    }
+
+    template <typename TYPE, template <typename> class Callback, uint32_t ARITY>
+    requires original::Compare<Callback<TYPE>, TYPE>
+    auto original::addressablePrique<TYPE, Callback, ARITY>::contains(const handle h) const -> bool
+    {
+        return h < this->pos_.size() && this->pos_.get(h) != NO_POS;
+    }
+
+    template <typename TYPE, template <typename> class Callback, uint32_t ARITY>
+    requires original::Compare<Callback<TYPE>, TYPE>
+    auto original::addressablePrique<TYPE, Callback, ARITY>::push(const TYPE& e) -> handle
+    {
+        return this->insert(TYPE(e));
+    }
+
+    template <typename TYPE, template <typename> class Callback, uint32_t ARITY>
+    requires original::Compare<Callback<TYPE>, TYPE>
+    auto original::addressablePrique<TYPE, Callback, ARITY>::push(TYPE&& e) -> handle
+    {
+        return this->insert(std::move(e));
+    }
+
+    template <typename TYPE, template <typename> class Callback, uint32_t ARITY>
+    requires original::Compare<Callback<TYPE>, TYPE>
+    template <typename... Args>
+    auto original::addressablePrique<TYPE, Callback, ARITY>::emplace(Args&&... args) -> handle
+    {
+        return this->insert(TYPE(std::forward<Args>(args)...));
+    }
+
+    template <typename TYPE, template <typename> class Callback, uint32_t ARITY>
+    requires original::Compare<Callback<TYPE>, TYPE>
+    auto original::addressablePrique<TYPE, Callback, ARITY>::pop() -> TYPE
+    {
+        if (this->empty())
+            throw noElementError();
+        return this->remove(0);
+    }
+
+    template <typename TYPE, template <typename> class Callback, uint32_t ARITY>
+    requires original::Compare<Callback<TYPE>, TYPE>
+    auto original::addressablePrique<TYPE, Callback, ARITY>::top() const -> TYPE
+    {
+        return this->slots_.get(this->topHandle());
+    }
+
+    template <typename TYPE, template <typename> class Callback, uint32_t ARITY>
+    requires original::Compare<Callback<TYPE>, TYPE>
+    auto original::addressablePrique<TYPE, Callback, ARITY>::topHandle() const -> handle
+    {
+        if (this->empty())
+            throw noElementError();
+        return this->heap_.getBegin();
+    }
+
+    template <typename TYPE, template <typename> class Callback, uint32_t ARITY>
+    requires original::Compare<Callback<TYPE>, TYPE>
+    auto original::addressablePrique<TYPE, Callback, ARITY>::get(const handle h) const -> TYPE
+    {
+        this->validate(h);
+        return this->slots_.get(h);
+    }
+
+    template <typename TYPE, template <typename> class Callback, uint32_t ARITY>
+    requires original::Compare<Callback<TYPE>, TYPE>
+    auto original::addressablePrique<TYPE, Callback, ARITY>::update(const handle h, const TYPE& e) -> void
+    {
+        this->validate(h);
+        this->slots_[h] = e;
+        this->siftUp(this->pos_[h]);
+        this->siftDown(this->pos_[h]);
+    }
+
+    template <typename TYPE, template <typename> class Callback, uint32_t ARITY>
+    requires original::Compare<Callback<TYPE>, TYPE>
+    auto original::addressablePrique<TYPE, Callback, ARITY>::decreaseKey(const handle h, const TYPE& e) -> void
+    {
+        this->validate(h);
+        if (this->compare_(this->slots_[h], e))
+            throw valueError();
+        this->slots_[h] = e;
+        this->siftUp(this->pos_[h]);
+    }
+
+    template <typename TYPE, template <typename> class Callback, uint32_t ARITY>
+    requires original::Compare<Callback<TYPE>, TYPE>
+    auto original::addressablePrique<TYPE, Callback, ARITY>::erase(const handle h) -> TYPE
+    {
+        this->validate(h);
+        return this->remove(this->pos_[h]);
+    }
+
+    template <typename TYPE, template <typename> class Callback, uint32_t ARITY>
+    requires original::Compare<Callback<TYPE>, TYPE>
+    auto original::addressablePrique<TYPE, Callback, ARITY>::className() const -> std::string
+    {
+        return "addressablePrique";
+    }
+
+    template <typename TYPE, template <typename> class Callback, uint32_t ARITY>
+    requires original::Compare<Callback<TYPE>, TYPE>
+    auto original::addressablePrique<TYPE, Callback, ARITY>::toString(const bool enter) const -> std::string
+    {
+        std::stringstream ss;
+        ss << this->className() << "(";
+        for (uint32_t i = 0; i < this->heap_.size(); ++i) {
+            if (i != 0) ss << ", ";
+            ss << printable::formatString(this->slots_.get(this->heap_.get(i)));
+        }
+        ss << ")";
+        if (enter) ss << "\n";
+        return ss.str();
+    }
+
+#endif //ADDRESSABLEPRIQUE_H
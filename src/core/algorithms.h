@@ -1,8 +1,17 @@
 #ifndef ALGORITHMS_H
 #define ALGORITHMS_H
 
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include "comparator.h"
+#include "execution.h"
 #include "filter.h"
+#include "iterable.h"
 #include "iterator.h"
+#include "randomAccessIterator.h"
+#include "span.h"
+#include "threadPool.h"
 #include "types.h"
 
 namespace original
@@ -100,27 +109,224 @@ namespace original
         requires Compare<Callback, TYPE>
         static bool compare(const iterator<TYPE>& it1, const iterator<TYPE>& it2, const Callback& compares);
 
-        template<typename TYPE, typename Callback>
+        /**
+         * ---- Heap operations. ----
+         * The heap is laid out implicitly over [begin, range], the children of the element at index i
+         * are at i * ARITY + 1 to i * ARITY + ARITY. A 4-ary heap is half as deep as a binary one and
+         * scans children lying next to each other, which trades a few comparisons for fewer cache misses.
+         * */
+
+        template<uint32_t ARITY = 2, typename TYPE, typename Callback>
         requires Compare<Callback, TYPE>
         static void heapAdjustDown(const iterator<TYPE>& begin, const iterator<TYPE>& range,
                                    const iterator<TYPE>& current, const Callback& compares);
 
-        template<typename TYPE, typename Callback>
+        template<uint32_t ARITY = 2, typename TYPE, typename Callback>
         requires Compare<Callback, TYPE>
         static void heapAdjustUp(const iterator<TYPE>& begin, const iterator<TYPE>& current,
                                  const Callback& compares);
 
-        template<typename TYPE, typename Callback>
+        template<uint32_t ARITY = 2, typename TYPE, typename Callback>
         requires Compare<Callback, TYPE>
         static void heapInit(const iterator<TYPE> &begin, const iterator<TYPE> &end,
                              const Callback& compares);
 
-    protected:
+        template<typename TYPE, typename Callback = increaseComparator<TYPE>>
+        requires Compare<Callback, TYPE>
+        static void sort(const iterator<TYPE> &begin, const iterator<TYPE> &end,
+                         const Callback& compares = Callback{});
+
+        template<typename TYPE, typename Callback = increaseComparator<TYPE>>
+        requires Compare<Callback, TYPE>
+        static void stableSort(const iterator<TYPE> &begin, const iterator<TYPE> &end,
+                               const Callback& compares = Callback{});
+
+        template<typename TYPE, typename Callback = increaseComparator<TYPE>>
+        requires Compare<Callback, TYPE>
+        static void partialSort(const iterator<TYPE> &begin, const iterator<TYPE> &end, uint32_t n,
+                                const Callback& compares = Callback{});
+
+        template<typename TYPE, typename Callback = increaseComparator<TYPE>>
+        requires Compare<Callback, TYPE>
+        static void nthElement(const iterator<TYPE> &begin, const iterator<TYPE> &end, uint32_t n,
+                               const Callback& compares = Callback{});
+
+        /**
+         * ---- Execution policy overloads. ----
+         * With a parallel policy, contiguous ranges are split into chunks run on threadPool::global(),
+         * every other range and the sequenced policy use the sequential version above.
+         * */
+
+        template<typename Policy, typename TYPE, typename Callback>
+        requires ExecutionPolicy<Policy> && Condition<Callback, TYPE>
+        static bool allOf(const Policy& policy, const iterator<TYPE>& begin, const iterator<TYPE>& end,
+                          const Callback& condition);
+
+        template<typename Policy, typename TYPE, typename Callback>
+        requires ExecutionPolicy<Policy> && Condition<Callback, TYPE>
+        static bool anyOf(const Policy& policy, const iterator<TYPE>& begin, const iterator<TYPE>& end,
+                          const Callback& condition);
+
+        template<typename Policy, typename TYPE, typename Callback>
+        requires ExecutionPolicy<Policy> && Condition<Callback, TYPE>
+        static bool noneOf(const Policy& policy, const iterator<TYPE>& begin, const iterator<TYPE>& end,
+                           const Callback& condition);
+
+        template<typename Policy, typename TYPE>
+        requires ExecutionPolicy<Policy>
+        static iterator<TYPE>* find(const Policy& policy, const iterator<TYPE>& begin, const iterator<TYPE>& end,
+                                    const TYPE& target);
+
+        template<typename Policy, typename TYPE, typename Callback>
+        requires ExecutionPolicy<Policy> && Condition<Callback, TYPE>
+        static iterator<TYPE>* find(const Policy& policy, const iterator<TYPE>& begin, const iterator<TYPE>& end,
+                                    const Callback& condition);
+
+        template<typename Policy, typename TYPE>
+        requires ExecutionPolicy<Policy>
+        static uint32_t count(const Policy& policy, const iterator<TYPE>& begin, const iterator<TYPE>& end,
+                              const TYPE& target);
+
+        template<typename Policy, typename TYPE, typename Callback>
+        requires ExecutionPolicy<Policy> && Condition<Callback, TYPE>
+        static uint32_t count(const Policy& policy, const iterator<TYPE>& begin, const iterator<TYPE>& end,
+                              const Callback& condition);
+
+        template<typename Policy, typename TYPE, typename Callback>
+        requires ExecutionPolicy<Policy> && Operation<Callback, TYPE>
+        static void forEach(const Policy& policy, const iterator<TYPE>& begin, const iterator<TYPE>& end,
+                            Callback operation);
+
+        template<typename Policy, typename TYPE>
+        requires ExecutionPolicy<Policy>
+        static void fill(const Policy& policy, const iterator<TYPE>& begin, const iterator<TYPE>& end,
+                         const TYPE& value = TYPE{});
+
+        template<typename Policy, typename TYPE>
+        requires ExecutionPolicy<Policy>
+        static iterator<TYPE>* copy(const Policy& policy, const iterator<TYPE>& begin_src,
+                                    const iterator<TYPE>& end_src, const iterator<TYPE>& begin_tar);
+
+        /**
+         * ---- Span overloads. ----
+         * Run the raw kernels over the whole span, without the iterators the overloads above take.
+         * */
+
+        template<typename TYPE, typename Callback>
+        requires Operation<Callback, TYPE>
+        static void forEach(const span<TYPE>& range, Callback operation);
+
+        template<typename TYPE>
+        static void fill(const span<TYPE>& range, const TYPE& value = TYPE{});
+
+        template<typename TYPE>
+        static uint32_t count(const span<TYPE>& range, const TYPE& target);
+
         template<typename TYPE, typename Callback>
+        requires Condition<Callback, TYPE>
+        static uint32_t count(const span<TYPE>& range, const Callback& condition);
+
+        // Copies src to the front of tar and returns the written part of tar, tar may overlap src.
+        template<typename TYPE>
+        static span<TYPE> copy(const span<TYPE>& src, const span<TYPE>& tar);
+
+        template<typename TYPE, typename Callback = increaseComparator<TYPE>>
+        requires Compare<Callback, TYPE>
+        static void sort(const span<TYPE>& range, const Callback& compares = Callback{});
+
+        template<typename TYPE, typename Callback = increaseComparator<TYPE>>
+        requires Compare<Callback, TYPE>
+        static void stableSort(const span<TYPE>& range, const Callback& compares = Callback{});
+
+        template<typename TYPE, typename Callback = increaseComparator<TYPE>>
+        requires Compare<Callback, TYPE>
+        static void partialSort(const span<TYPE>& range, uint32_t n, const Callback& compares = Callback{});
+
+        template<typename TYPE, typename Callback = increaseComparator<TYPE>>
+        requires Compare<Callback, TYPE>
+        static void nthElement(const span<TYPE>& range, uint32_t n, const Callback& compares = Callback{});
+
+    protected:
+        template<uint32_t ARITY = 2, typename TYPE, typename Callback>
         requires Compare<Callback, TYPE>
         static iterator<TYPE>* heapGetPrior(const iterator<TYPE>& begin, const iterator<TYPE>& range,
                                             const iterator<TYPE>& parent, const Callback& compares);
 
+        /**
+         * ---- Contiguous fast path. ----
+         * Ranges over randomAccessIterator (vector, array) are resolved to raw pointers once per call,
+         * the kernels then run without cloning iterators or virtual calls. Any other range
+         * falls back to the polymorphic implementation.
+         * */
+
+        template<typename TYPE>
+        static const randomAccessIterator<TYPE>* randomAccess(const iterator<TYPE>& it);
+
+        template<typename TYPE>
+        static bool contiguous(const iterator<TYPE>& begin, const iterator<TYPE>& end, bool inclusive,
+                               TYPE*& first, TYPE*& last);
+
+        template<typename TYPE>
+        static bool contiguous(const iterator<TYPE>& begin, uint32_t n, TYPE*& first);
+
+        template<uint32_t ARITY = 2, typename TYPE, typename Callback>
+        static void rawHeapAdjustDown(TYPE* first, int64_t last, int64_t current, const Callback& compares);
+
+        template<uint32_t ARITY = 2, typename TYPE, typename Callback>
+        static void rawHeapAdjustUp(TYPE* first, int64_t current, const Callback& compares);
+
+        /**
+         * ---- Sorting kernels over the half-open span [first, last). ----
+         * Ranges that are not contiguous are moved into a scratch buffer, sorted there and moved back.
+         * */
+
+        static constexpr int64_t INSERTION_SORT_THRESHOLD = 16;
+
+        template<typename TYPE, typename Kernel>
+        static void buffered(const iterator<TYPE>& begin, const iterator<TYPE>& end, Kernel kernel);
+
+        template<typename TYPE, typename Callback>
+        static void rawInsertionSort(TYPE* first, TYPE* last, const Callback& compares);
+
+        template<typename TYPE, typename Callback>
+        static TYPE* rawPartition(TYPE* first, TYPE* last, const Callback& compares);
+
+        template<typename TYPE, typename Callback>
+        static void rawHeapSelect(TYPE* first, TYPE* middle, TYPE* last, const Callback& compares);
+
+        template<typename TYPE, typename Callback>
+        static void rawHeapSort(TYPE* first, TYPE* last, const Callback& compares);
+
+        template<typename TYPE, typename Callback>
+        static void rawIntroSort(TYPE* first, TYPE* last, int64_t depth, const Callback& compares);
+
+        template<typename TYPE, typename Callback>
+        static void rawSort(TYPE* first, TYPE* last, const Callback& compares);
+
+        template<typename TYPE, typename Callback>
+        static void rawMerge(TYPE* src, int64_t left, int64_t mid, int64_t right, TYPE* dst, const Callback& compares);
+
+        template<typename TYPE, typename Callback>
+        static void rawStableSort(TYPE* first, TYPE* last, const Callback& compares);
+
+        template<typename TYPE, typename Callback>
+        static void rawPartialSort(TYPE* first, TYPE* middle, TYPE* last, const Callback& compares);
+
+        template<typename TYPE, typename Callback>
+        static void rawNthElement(TYPE* first, TYPE* nth, TYPE* last, const Callback& compares);
+
+        /**
+         * ---- Parallel chunking. ----
+         * */
+
+        static constexpr int64_t PARALLEL_GRAIN = 1 << 14;
+
+        template<typename Kernel>
+        static void parallelChunks(int64_t len, Kernel kernel);
+
+        template<typename TYPE, typename Callback>
+        static int64_t parallelFindIf(TYPE* first, int64_t len, const Callback& condition);
+
 
         /**
          * ---- Implementation of pointer overload version. ----
@@ -262,32 +468,60 @@ namespace original
             return compare(*it1, *it2, compares);
         }
 
-        template<typename TYPE, typename Callback>
+        template<uint32_t ARITY = 2, typename TYPE, typename Callback>
         requires original::Compare<Callback, TYPE>
         static auto heapAdjustDown(const iterator<TYPE>* begin, const iterator<TYPE>* range,
                                                   const iterator<TYPE>* current, const Callback& compares) -> void {
-            heapAdjustDown(*begin, *range, *current, compares);
+            heapAdjustDown<ARITY>(*begin, *range, *current, compares);
         }
 
-        template<typename TYPE, typename Callback>
+        template<uint32_t ARITY = 2, typename TYPE, typename Callback>
         requires original::Compare<Callback, TYPE>
         static auto heapAdjustUp(const iterator<TYPE>* begin, const iterator<TYPE>* current,
                                                 const Callback& compares) -> void {
-            heapAdjustUp(*begin, *current, compares);
+            heapAdjustUp<ARITY>(*begin, *current, compares);
         }
 
-        template<typename TYPE, typename Callback>
+        template<uint32_t ARITY = 2, typename TYPE, typename Callback>
         requires original::Compare<Callback, TYPE>
         static auto heapInit(const iterator<TYPE>* begin, const iterator<TYPE>* end,
                                             const Callback& compares) -> void {
-            heapInit(*begin, *end, compares);
+            heapInit<ARITY>(*begin, *end, compares);
         }
 
-        template<typename TYPE, typename Callback>
+        template<uint32_t ARITY = 2, typename TYPE, typename Callback>
         requires original::Compare<Callback, TYPE>
         static auto heapGetPrior(const iterator<TYPE>* begin, const iterator<TYPE>* range,
                                                 const iterator<TYPE>* parent, const Callback& compares) -> iterator<TYPE>* {
-            return heapGetPrior(*begin, *range, *parent, compares);
+            return heapGetPrior<ARITY>(*begin, *range, *parent, compares);
+        }
+
+        template<typename TYPE, typename Callback = increaseComparator<TYPE>>
+        requires original::Compare<Callback, TYPE>
+        static auto sort(const iterator<TYPE>* begin, const iterator<TYPE>* end,
+                         const Callback& compares = Callback{}) -> void {
+            sort(*begin, *end, compares);
+        }
+
+        template<typename TYPE, typename Callback = increaseComparator<TYPE>>
+        requires original::Compare<Callback, TYPE>
+        static auto stableSort(const iterator<TYPE>* begin, const iterator<TYPE>* end,
+                               const Callback& compares = Callback{}) -> void {
+            stableSort(*begin, *end, compares);
+        }
+
+        template<typename TYPE, typename Callback = increaseComparator<TYPE>>
+        requires original::Compare<Callback, TYPE>
+        static auto partialSort(const iterator<TYPE>* begin, const iterator<TYPE>* end, uint32_t n,
+                                const Callback& compares = Callback{}) -> void {
+            partialSort(*begin, *end, n, compares);
+        }
+
+        template<typename TYPE, typename Callback = increaseComparator<TYPE>>
+        requires original::Compare<Callback, TYPE>
+        static auto nthElement(const iterator<TYPE>* begin, const iterator<TYPE>* end, uint32_t n,
+                               const Callback& compares = Callback{}) -> void {
+            nthElement(*begin, *end, n, compares);
         }
     };
 }
@@ -295,12 +529,7 @@ namespace original
     template <typename TYPE>
     auto original::algorithms::distance(const iterator<TYPE>& end, const iterator<TYPE>& begin) -> int64_t
     {
-        auto* it1 = end.clone();
-        auto* it2 = begin.clone();
-        auto dis = it1->operator-(*it2);
-        delete it1;
-        delete it2;
-        return dis;
+        return end.operator-(begin);
     }
 
     template<typename TYPE>
@@ -317,6 +546,16 @@ namespace original
     requires original::Condition<Callback, TYPE>
     bool original::algorithms::allOf(const iterator<TYPE> &begin, const iterator<TYPE> &end,
                                      const Callback& condition) {
+        TYPE* first;
+        TYPE* last;
+        if (contiguous(begin, end, true, first, last)) {
+            for (; first != last; ++first){
+                if (!condition(*first))
+                    return false;
+            }
+            return true;
+        }
+
         auto* it = begin.clone();
         for (; distance(*it, end) <= 0; it->next()){
             if (!condition(it->get())){
@@ -332,6 +571,16 @@ namespace original
     requires original::Condition<Callback, TYPE>
     bool original::algorithms::anyOf(const iterator<TYPE> &begin, const iterator<TYPE> &end,
                                      const Callback& condition) {
+        TYPE* first;
+        TYPE* last;
+        if (contiguous(begin, end, true, first, last)) {
+            for (; first != last; ++first){
+                if (condition(*first))
+                    return true;
+            }
+            return false;
+        }
+
         auto* it = begin.clone();
         for (; distance(*it, end) <= 0; it->next()){
             if (condition(it->get())){
@@ -347,6 +596,16 @@ namespace original
     requires original::Condition<Callback, TYPE>
     bool original::algorithms::noneOf(const iterator<TYPE> &begin, const iterator<TYPE> &end,
                                       const Callback& condition) {
+        TYPE* first;
+        TYPE* last;
+        if (contiguous(begin, end, true, first, last)) {
+            for (; first != last; ++first){
+                if (condition(*first))
+                    return false;
+            }
+            return true;
+        }
+
         auto* it = begin.clone();
         for (; distance(*it, end) <= 0; it->next()){
             if (condition(it->get())){
@@ -361,6 +620,19 @@ namespace original
     template <typename TYPE>
     auto original::algorithms::find(const iterator<TYPE>& begin, const iterator<TYPE>& end,
         const TYPE& target) -> iterator<TYPE>* {
+        TYPE* first;
+        TYPE* last;
+        if (contiguous(begin, end, false, first, last)) {
+            for (TYPE* cur = first; cur != last; ++cur) {
+                if (*cur == target) {
+                    auto it = begin.clone();
+                    *it += cur - first;
+                    return it;
+                }
+            }
+            return end.clone();
+        }
+
         auto it = begin.clone();
         while (it->isValid() && !it->equal(end)) {
             if (it->get() == target) {
@@ -375,6 +647,16 @@ namespace original
     template <typename TYPE>
     auto original::algorithms::find(const iterator<TYPE>& begin, const uint32_t n, const TYPE& target) -> iterator<TYPE>* {
         auto it = begin.clone();
+        TYPE* first;
+        if (contiguous(begin, n, first)) {
+            uint32_t i = 0;
+            while (i < n && !(first[i] == target)) {
+                i += 1;
+            }
+            *it += i;
+            return it;
+        }
+
         for (uint32_t i = 0; i < n; i += 1, it->next())
         {
             if (it->get() == target) return it;
@@ -386,6 +668,19 @@ namespace original
     requires original::Condition<Callback, TYPE>
     auto original::algorithms::find(const iterator<TYPE> &begin, const iterator<TYPE> &end,
                                     const Callback& condition) -> iterator<TYPE>* {
+        TYPE* first;
+        TYPE* last;
+        if (contiguous(begin, end, false, first, last)) {
+            for (TYPE* cur = first; cur != last; ++cur) {
+                if (condition(*cur)) {
+                    auto it = begin.clone();
+                    *it += cur - first;
+                    return it;
+                }
+            }
+            return end.clone();
+        }
+
         auto it = begin.clone();
         while (it->isValid() && !it->equal(end)) {
             if (condition(it->get())) {
@@ -401,6 +696,16 @@ namespace original
     requires original::Condition<Callback, TYPE>
     auto original::algorithms::find(const iterator<TYPE>& begin, const uint32_t n, const Callback& condition) -> iterator<TYPE>* {
         auto it = begin.clone();
+        TYPE* first;
+        if (contiguous(begin, n, first)) {
+            uint32_t i = 0;
+            while (i < n && !condition(first[i])) {
+                i += 1;
+            }
+            *it += i;
+            return it;
+        }
+
         for (uint32_t i = 0; i < n; i += 1, it->next())
         {
             if (condition(it->get())) return it;
@@ -413,6 +718,17 @@ namespace original
         const TYPE& target) -> uint32_t
     {
         uint32_t cnt = 0;
+        TYPE* first;
+        TYPE* last;
+        if (contiguous(begin, end, true, first, last)) {
+            for (; first != last; ++first) {
+                if (*first == target) {
+                    cnt += 1;
+                }
+            }
+            return cnt;
+        }
+
         auto it = begin.clone();
         while (it->isValid() && !end.atPrev(it)) {
             if (it->get() == target) {
@@ -430,6 +746,17 @@ namespace original
                                      const Callback& condition) -> uint32_t
     {
         uint32_t cnt = 0;
+        TYPE* first;
+        TYPE* last;
+        if (contiguous(begin, end, true, first, last)) {
+            for (; first != last; ++first) {
+                if (condition(*first)) {
+                    cnt += 1;
+                }
+            }
+            return cnt;
+        }
+
         auto it = begin.clone();
         while (it->isValid() && !end.atPrev(it)) {
             if (condition(it->get())) {
@@ -445,14 +772,33 @@ namespace original
     auto original::algorithms::equal(const iterator<TYPE>& begin1, const iterator<TYPE>& end1,
                                      const iterator<TYPE>& begin2, const iterator<TYPE>& end2) -> bool
     {
+        TYPE* first1;
+        TYPE* last1;
+        TYPE* first2;
+        TYPE* last2;
+        if (contiguous(begin1, end1, true, first1, last1) && contiguous(begin2, end2, true, first2, last2)) {
+            if (last1 - first1 != last2 - first2)
+                return false;
+            for (; first1 != last1; ++first1, ++first2) {
+                if (!(*first1 == *first2))
+                    return false;
+            }
+            return true;
+        }
+
         auto it1 = begin1.clone();
         auto it2 = begin2.clone();
 
+        bool res = true;
         while (it1->isValid() && it2->isValid() && !it1->equal(end1) && !it2->equal(end2)) {
+            if (!(it1->get() == it2->get())) {
+                res = false;
+                break;
+            }
             it1->next();
             it2->next();
         }
-        const bool res = it1->equal(end1) && it2->equal(end2) && it1->get() == it2->get();
+        res = res && it1->equal(end1) && it2->equal(end2) && it1->get() == it2->get();
         delete it1;
         delete it2;
         return res;
@@ -463,6 +809,15 @@ namespace original
     auto original::algorithms::forEach(const iterator<TYPE>& begin, const iterator<TYPE>& end,
                                        Callback operation) -> void
     {
+        TYPE* first;
+        TYPE* last;
+        if (contiguous(begin, end, true, first, last)) {
+            for (; first != last; ++first) {
+                operation(*first);
+            }
+            return;
+        }
+
         auto it = begin.clone();
         for (; !it->equal(end); it->next()) {
             operation(it->get());
@@ -476,6 +831,15 @@ namespace original
     auto original::algorithms::forEach(const iterator<TYPE>& begin, const uint32_t n,
                                        Callback operation) -> iterator<TYPE>* {
         auto it = begin.clone();
+        TYPE* first;
+        if (contiguous(begin, n, first)) {
+            for (uint32_t i = 0; i < n; ++i) {
+                operation(first[i]);
+            }
+            *it += n;
+            return it;
+        }
+
         for (uint32_t i = 0; i < n; i += 1, it->next())
         {
             operation(it->get());
@@ -487,12 +851,23 @@ namespace original
     requires original::Operation<Callback_O, TYPE> && original::Condition<Callback_C, TYPE>
     auto original::algorithms::forEach(const iterator<TYPE> &begin, const iterator<TYPE> &end, Callback_O operation,
                                        const Callback_C &condition) -> void {
+        TYPE* first;
+        TYPE* last;
+        if (contiguous(begin, end, true, first, last)) {
+            for (; first != last; ++first) {
+                if (condition(*first))
+                    operation(*first);
+            }
+            return;
+        }
+
         auto it = begin.clone();
         for (; !it->equal(end); it->next()) {
             if (condition(it->get()))
                 operation(it->get());
         }
-        operation(it->get());
+        if (condition(it->get()))
+            operation(it->get());
         delete it;
     }
 
@@ -501,6 +876,16 @@ namespace original
     auto original::algorithms::forEach(const iterator<TYPE> &begin, const uint32_t n, Callback_O operation,
                                        const Callback_C &condition) -> iterator<TYPE>* {
         auto it = begin.clone();
+        TYPE* first;
+        if (contiguous(begin, n, first)) {
+            for (uint32_t i = 0; i < n; ++i) {
+                if (condition(first[i]))
+                    operation(first[i]);
+            }
+            *it += n;
+            return it;
+        }
+
         for (uint32_t i = 0; i < n; i += 1, it->next())
         {
             if (condition(it->get()))
@@ -513,6 +898,15 @@ namespace original
     auto original::algorithms::fill(const iterator<TYPE>& begin,
                                     const iterator<TYPE>& end, const TYPE& value) -> void
     {
+        TYPE* first;
+        TYPE* last;
+        if (contiguous(begin, end, true, first, last)) {
+            for (; first != last; ++first) {
+                *first = value;
+            }
+            return;
+        }
+
         auto it = begin.clone();
         while (!it->equal(end)){
             it->set(value);
@@ -526,6 +920,15 @@ namespace original
     auto original::algorithms::fill(const iterator<TYPE>& begin,
                                     const uint32_t n, const TYPE& value) -> iterator<TYPE>* {
         auto it = begin.clone();
+        TYPE* first;
+        if (contiguous(begin, n, first)) {
+            for (uint32_t i = 0; i < n; ++i) {
+                first[i] = value;
+            }
+            *it += n;
+            return it;
+        }
+
         for (uint32_t i = 0; i < n; ++i) {
             it->set(value);
             it->next();
@@ -536,6 +939,13 @@ namespace original
     template <typename TYPE>
     auto original::algorithms::swap(const iterator<TYPE>& it1, const iterator<TYPE>& it2) noexcept -> void
     {
+        auto* raw1 = randomAccess(it1);
+        auto* raw2 = randomAccess(it2);
+        if (raw1 != nullptr && raw2 != nullptr && raw1->isValid() && raw2->isValid()) {
+            std::swap(*raw1->_ptr, *raw2->_ptr);
+            return;
+        }
+
         auto it_1 = it1.clone();
         auto it_2 = it2.clone();
         TYPE tmp = it_2->get();
@@ -548,6 +958,20 @@ namespace original
     template <typename TYPE>
     auto original::algorithms::copy(const iterator<TYPE>& begin_src, const iterator<TYPE>& end_src,
                         const iterator<TYPE>& begin_tar) -> iterator<TYPE>* {
+        TYPE* first;
+        TYPE* last;
+        TYPE* target;
+        if (contiguous(begin_src, end_src, true, first, last)
+            && contiguous(begin_tar, static_cast<uint32_t>(last - first), target)) {
+            const int64_t len = last - first;
+            for (int64_t i = 0; i < len; ++i) {
+                target[i] = first[i];
+            }
+            auto it_tar = begin_tar.clone();
+            *it_tar += len;
+            return it_tar;
+        }
+
         auto it_src = begin_src.clone();
         auto it_tar = begin_tar.clone();
         while (!it_src->equal(end_src)){
@@ -565,6 +989,21 @@ namespace original
     requires original::Condition<Callback, TYPE>
     auto original::algorithms::copy(const iterator<TYPE>& begin_src, const iterator<TYPE>& end_src,
                                const iterator<TYPE>& begin_tar, Callback condition) -> iterator<TYPE>* {
+        TYPE* first;
+        TYPE* last;
+        TYPE* target;
+        if (contiguous(begin_src, end_src, true, first, last)
+            && contiguous(begin_tar, static_cast<uint32_t>(last - first), target)) {
+            const int64_t len = last - first;
+            for (int64_t i = 0; i < len; ++i) {
+                if (condition(first[i]))
+                    target[i] = first[i];
+            }
+            auto it_tar = begin_tar.clone();
+            *it_tar += len;
+            return it_tar;
+        }
+
         auto it_src = begin_src.clone();
         auto it_tar = begin_tar.clone();
         while (!it_src->equal(end_src)){
@@ -585,6 +1024,18 @@ namespace original
     template<typename TYPE>
     auto original::algorithms::reverse(const iterator<TYPE>& begin,
                                        const iterator<TYPE>& end) -> iterator<TYPE>* {
+        TYPE* first;
+        TYPE* last;
+        if (contiguous(begin, end, true, first, last)) {
+            const int64_t len = last - first;
+            for (--last; first < last; ++first, --last) {
+                std::swap(*first, *last);
+            }
+            auto left = begin.clone();
+            *left += len / 2;
+            return left;
+        }
+
         auto left = begin.clone();
         auto right = end.clone();
         while (!left->equal(right) && !left->atNext(right)){
@@ -604,7 +1055,7 @@ namespace original
         return compares(it1.get(), it2.get());
     }
 
-    template <typename TYPE, typename Callback>
+    template <uint32_t ARITY, typename TYPE, typename Callback>
     requires original::Compare<Callback, TYPE>
     auto original::algorithms::heapAdjustDown(const iterator<TYPE>& begin, const iterator<TYPE>& range,
                                               const iterator<TYPE>& current, const Callback& compares) -> void
@@ -612,10 +1063,17 @@ namespace original
         if (distance(current, begin) < 0)
             return;
 
+        TYPE* first;
+        TYPE* last;
+        if (contiguous(begin, range, true, first, last)) {
+            rawHeapAdjustDown<ARITY>(first, last - first - 1, distance(current, begin), compares);
+            return;
+        }
+
         auto* it = current.clone();
-        while (distance(*it, begin) * 2 + 1 <= distance(range, begin))
+        while (distance(*it, begin) * ARITY + 1 <= distance(range, begin))
         {
-            auto* child = heapGetPrior(begin, range, *it, compares);
+            auto* child = heapGetPrior<ARITY>(begin, range, *it, compares);
             if (compare(it, child, compares))
             {
                 delete child;
@@ -629,59 +1087,721 @@ namespace original
         delete it;
     }
 
-    template <typename TYPE, typename Callback>
+    template <uint32_t ARITY, typename TYPE, typename Callback>
     requires original::Compare<Callback, TYPE>
     auto original::algorithms::heapAdjustUp(const iterator<TYPE>& begin, const iterator<TYPE>& current,
                                             const Callback& compares) -> void
     {
+        TYPE* first;
+        TYPE* last;
+        if (contiguous(begin, current, true, first, last)) {
+            rawHeapAdjustUp<ARITY>(first, last - first - 1, compares);
+            return;
+        }
+
         auto* it = current.clone();
         while (distance(*it, begin) > 0)
         {
-            auto* parent = frontOf(begin, (distance(*it, begin) - 1) / 2);
-            if (compare(it, parent, compares))
-            {
-                swap(it, parent);
-            }else
+            auto* parent = frontOf(begin, (distance(*it, begin) - 1) / ARITY);
+            if (!compare(it, parent, compares))
             {
                 delete parent;
                 break;
             }
-            delete parent;
+            swap(it, parent);
+            delete it;
+            it = parent;
         }
         delete it;
     }
 
-    template <typename TYPE, typename Callback>
+    template <uint32_t ARITY, typename TYPE, typename Callback>
     requires original::Compare<Callback, TYPE>
     auto original::algorithms::heapInit(const iterator<TYPE>& begin, const iterator<TYPE>& end,
                                         const Callback& compares) -> void
     {
-        auto* it = frontOf(begin, (distance(end, begin) + 1) / 2 - 1);
+        TYPE* first;
+        TYPE* last;
+        if (contiguous(begin, end, true, first, last)) {
+            const int64_t size = last - first;
+            for (int64_t i = size >= 2 ? (size - 2) / ARITY : -1; i >= 0; --i) {
+                rawHeapAdjustDown<ARITY>(first, size - 1, i, compares);
+            }
+            return;
+        }
+
+        if (!begin.isValid() || !end.isValid())
+            return;
+
+        const int64_t size = distance(end, begin) + 1;
+        if (size < 2)
+            return;
+
+        auto* it = frontOf(begin, (size - 2) / ARITY);
         for (; distance(*it, begin) >= 0; it->prev())
         {
-            heapAdjustDown(begin, end, *it, compares);
+            heapAdjustDown<ARITY>(begin, end, *it, compares);
         }
         delete it;
     }
 
-    template <typename TYPE, typename Callback>
+    template <uint32_t ARITY, typename TYPE, typename Callback>
     requires original::Compare<Callback, TYPE>
     auto original::algorithms::heapGetPrior(const iterator<TYPE>& begin, const iterator<TYPE>& range,
                                             const iterator<TYPE>& parent, const Callback& compares) -> iterator<TYPE>*
     {
-        if (distance(parent, begin) * 2 + 2 <= distance(range, begin))
+        const int64_t first = distance(parent, begin) * ARITY + 1;
+        const int64_t last = std::min<int64_t>(first + ARITY - 1, distance(range, begin));
+        auto* prior = frontOf(begin, first);
+        if (first == last)
+            return prior;
+
+        auto* it = prior->clone();
+        for (int64_t i = first + 1; i <= last; ++i)
         {
-            auto* left = frontOf(begin, distance(parent, begin) * 2 + 1);
-            auto* right = frontOf(begin, distance(parent, begin) * 2 + 2);
-            if (compare(left, right, compares))
+            it->next();
+            if (!compare(prior, it, compares))
             {
-                delete right;
-                return left;
+                delete prior;
+                prior = it->clone();
+            }
+        }
+        delete it;
+        return prior;
+    }
+
+    template <typename TYPE, typename Callback>
+    requires original::Compare<Callback, TYPE>
+    auto original::algorithms::sort(const iterator<TYPE>& begin, const iterator<TYPE>& end,
+                                    const Callback& compares) -> void
+    {
+        buffered(begin, end, [&compares](TYPE* first, TYPE* last) {
+            rawSort(first, last, compares);
+        });
+    }
+
+    template <typename TYPE, typename Callback>
+    requires original::Compare<Callback, TYPE>
+    auto original::algorithms::stableSort(const iterator<TYPE>& begin, const iterator<TYPE>& end,
+                                          const Callback& compares) -> void
+    {
+        buffered(begin, end, [&compares](TYPE* first, TYPE* last) {
+            rawStableSort(first, last, compares);
+        });
+    }
+
+    template <typename TYPE, typename Callback>
+    requires original::Compare<Callback, TYPE>
+    auto original::algorithms::partialSort(const iterator<TYPE>& begin, const iterator<TYPE>& end,
+                                           const uint32_t n, const Callback& compares) -> void
+    {
+        buffered(begin, end, [n, &compares](TYPE* first, TYPE* last) {
+            rawPartialSort(first, first + std::min<int64_t>(n, last - first), last, compares);
+        });
+    }
+
+    template <typename TYPE, typename Callback>
+    requires original::Compare<Callback, TYPE>
+    auto original::algorithms::nthElement(const iterator<TYPE>& begin, const iterator<TYPE>& end,
+                                          const uint32_t n, const Callback& compares) -> void
+    {
+        buffered(begin, end, [n, &compares](TYPE* first, TYPE* last) {
+            if (n < last - first)
+                rawNthElement(first, first + n, last, compares);
+        });
+    }
+
+    template <typename Policy, typename TYPE, typename Callback>
+    requires original::ExecutionPolicy<Policy> && original::Condition<Callback, TYPE>
+    auto original::algorithms::allOf(const Policy&, const iterator<TYPE>& begin, const iterator<TYPE>& end,
+                                     const Callback& condition) -> bool
+    {
+        TYPE* first;
+        TYPE* last;
+        if (!ParallelPolicy<Policy> || !contiguous(begin, end, true, first, last))
+            return allOf(begin, end, condition);
+
+        return parallelFindIf(first, last - first, [&condition](const TYPE& e) {
+            return !condition(e);
+        }) == last - first;
+    }
+
+    template <typename Policy, typename TYPE, typename Callback>
+    requires original::ExecutionPolicy<Policy> && original::Condition<Callback, TYPE>
+    auto original::algorithms::anyOf(const Policy&, const iterator<TYPE>& begin, const iterator<TYPE>& end,
+                                     const Callback& condition) -> bool
+    {
+        TYPE* first;
+        TYPE* last;
+        if (!ParallelPolicy<Policy> || !contiguous(begin, end, true, first, last))
+            return anyOf(begin, end, condition);
+
+        return parallelFindIf(first, last - first, condition) != last - first;
+    }
+
+    template <typename Policy, typename TYPE, typename Callback>
+    requires original::ExecutionPolicy<Policy> && original::Condition<Callback, TYPE>
+    auto original::algorithms::noneOf(const Policy& policy, const iterator<TYPE>& begin, const iterator<TYPE>& end,
+                                      const Callback& condition) -> bool
+    {
+        return !anyOf(policy, begin, end, condition);
+    }
+
+    template <typename Policy, typename TYPE>
+    requires original::ExecutionPolicy<Policy>
+    auto original::algorithms::find(const Policy&, const iterator<TYPE>& begin, const iterator<TYPE>& end,
+                                    const TYPE& target) -> iterator<TYPE>*
+    {
+        TYPE* first;
+        TYPE* last;
+        if (!ParallelPolicy<Policy> || !contiguous(begin, end, false, first, last))
+            return find(begin, end, target);
+
+        const int64_t pos = parallelFindIf(first, last - first, [&target](const TYPE& e) {
+            return e == target;
+        });
+        if (pos == last - first)
+            return end.clone();
+        auto it = begin.clone();
+        *it += pos;
+        return it;
+    }
+
+    template <typename Policy, typename TYPE, typename Callback>
+    requires original::ExecutionPolicy<Policy> && original::Condition<Callback, TYPE>
+    auto original::algorithms::find(const Policy&, const iterator<TYPE>& begin, const iterator<TYPE>& end,
+                                    const Callback& condition) -> iterator<TYPE>*
+    {
+        TYPE* first;
+        TYPE* last;
+        if (!ParallelPolicy<Policy> || !contiguous(begin, end, false, first, last))
+            return find(begin, end, condition);
+
+        const int64_t pos = parallelFindIf(first, last - first, condition);
+        if (pos == last - first)
+            return end.clone();
+        auto it = begin.clone();
+        *it += pos;
+        return it;
+    }
+
+    template <typename Policy, typename TYPE>
+    requires original::ExecutionPolicy<Policy>
+    auto original::algorithms::count(const Policy& policy, const iterator<TYPE>& begin, const iterator<TYPE>& end,
+                                     const TYPE& target) -> uint32_t
+    {
+        return count(policy, begin, end, [&target](const TYPE& e) {
+            return e == target;
+        });
+    }
+
+    template <typename Policy, typename TYPE, typename Callback>
+    requires original::ExecutionPolicy<Policy> && original::Condition<Callback, TYPE>
+    auto original::algorithms::count(const Policy&, const iterator<TYPE>& begin, const iterator<TYPE>& end,
+                                     const Callback& condition) -> uint32_t
+    {
+        TYPE* first;
+        TYPE* last;
+        if (!ParallelPolicy<Policy> || !contiguous(begin, end, true, first, last))
+            return count(begin, end, condition);
+
+        std::atomic<uint32_t> cnt{0};
+        parallelChunks(last - first, [first, &cnt, &condition](const int64_t from, const int64_t to) {
+            uint32_t local = 0;
+            for (int64_t i = from; i < to; ++i) {
+                if (condition(first[i]))
+                    local += 1;
+            }
+            cnt.fetch_add(local, std::memory_order_relaxed);
+        });
+        return cnt.load();
+    }
+
+    template <typename Policy, typename TYPE, typename Callback>
+    requires original::ExecutionPolicy<Policy> && original::Operation<Callback, TYPE>
+    auto original::algorithms::forEach(const Policy&, const iterator<TYPE>& begin, const iterator<TYPE>& end,
+                                       Callback operation) -> void
+    {
+        TYPE* first;
+        TYPE* last;
+        if (!ParallelPolicy<Policy> || !contiguous(begin, end, true, first, last)) {
+            forEach(begin, end, operation);
+            return;
+        }
+
+        parallelChunks(last - first, [first, &operation](const int64_t from, const int64_t to) {
+            for (int64_t i = from; i < to; ++i) {
+                operation(first[i]);
+            }
+        });
+    }
+
+    template <typename Policy, typename TYPE>
+    requires original::ExecutionPolicy<Policy>
+    auto original::algorithms::fill(const Policy&, const iterator<TYPE>& begin, const iterator<TYPE>& end,
+                                    const TYPE& value) -> void
+    {
+        TYPE* first;
+        TYPE* last;
+        if (!ParallelPolicy<Policy> || !contiguous(begin, end, true, first, last)) {
+            fill(begin, end, value);
+            return;
+        }
+
+        parallelChunks(last - first, [first, &value](const int64_t from, const int64_t to) {
+            for (int64_t i = from; i < to; ++i) {
+                first[i] = value;
+            }
+        });
+    }
+
+    template <typename Policy, typename TYPE>
+    requires original::ExecutionPolicy<Policy>
+    auto original::algorithms::copy(const Policy&, const iterator<TYPE>& begin_src,
+                                    const iterator<TYPE>& end_src, const iterator<TYPE>& begin_tar) -> iterator<TYPE>*
+    {
+        TYPE* first;
+        TYPE* last;
+        TYPE* target;
+        // Overlapping ranges keep the element by element order of the sequential copy.
+        if (!ParallelPolicy<Policy> || !contiguous(begin_src, end_src, true, first, last)
+            || !contiguous(begin_tar, static_cast<uint32_t>(last - first), target)
+            || (target < last && first < target + (last - first)))
+            return copy(begin_src, end_src, begin_tar);
+
+        const int64_t len = last - first;
+        parallelChunks(len, [first, target](const int64_t from, const int64_t to) {
+            for (int64_t i = from; i < to; ++i) {
+                target[i] = first[i];
+            }
+        });
+        auto it_tar = begin_tar.clone();
+        *it_tar += len;
+        return it_tar;
+    }
+
+    template <typename TYPE, typename Callback>
+    requires original::Operation<Callback, TYPE>
+    auto original::algorithms::forEach(const span<TYPE>& range, Callback operation) -> void
+    {
+        for (TYPE* it = range.fastBegin(); it != range.fastEnd(); ++it) {
+            operation(*it);
+        }
+    }
+
+    template <typename TYPE>
+    auto original::algorithms::fill(const span<TYPE>& range, const TYPE& value) -> void
+    {
+        std::fill(range.fastBegin(), range.fastEnd(), value);
+    }
+
+    template <typename TYPE>
+    auto original::algorithms::count(const span<TYPE>& range, const TYPE& target) -> uint32_t
+    {
+        return std::count(range.fastBegin(), range.fastEnd(), target);
+    }
+
+    template <typename TYPE, typename Callback>
+    requires original::Condition<Callback, TYPE>
+    auto original::algorithms::count(const span<TYPE>& range, const Callback& condition) -> uint32_t
+    {
+        return std::count_if(range.fastBegin(), range.fastEnd(), condition);
+    }
+
+    template <typename TYPE>
+    auto original::algorithms::copy(const span<TYPE>& src, const span<TYPE>& tar) -> span<TYPE>
+    {
+        if (tar.size() < src.size())
+            throw outOfBoundError();
+
+        TYPE* target = tar.fastBegin();
+        if (target > src.fastBegin() && target < src.fastEnd()) {
+            std::copy_backward(src.fastBegin(), src.fastEnd(), target + src.size());
+        } else {
+            std::copy(src.fastBegin(), src.fastEnd(), target);
+        }
+        return tar.subspan(0, src.size());
+    }
+
+    template <typename TYPE, typename Callback>
+    requires original::Compare<Callback, TYPE>
+    auto original::algorithms::sort(const span<TYPE>& range, const Callback& compares) -> void
+    {
+        rawSort(range.fastBegin(), range.fastEnd(), compares);
+    }
+
+    template <typename TYPE, typename Callback>
+    requires original::Compare<Callback, TYPE>
+    auto original::algorithms::stableSort(const span<TYPE>& range, const Callback& compares) -> void
+    {
+        rawStableSort(range.fastBegin(), range.fastEnd(), compares);
+    }
+
+    template <typename TYPE, typename Callback>
+    requires original::Compare<Callback, TYPE>
+    auto original::algorithms::partialSort(const span<TYPE>& range, const uint32_t n,
+                                           const Callback& compares) -> void
+    {
+        rawPartialSort(range.fastBegin(), range.fastBegin() + std::min(n, range.size()), range.fastEnd(), compares);
+    }
+
+    template <typename TYPE, typename Callback>
+    requires original::Compare<Callback, TYPE>
+    auto original::algorithms::nthElement(const span<TYPE>& range, const uint32_t n,
+                                          const Callback& compares) -> void
+    {
+        if (n < range.size())
+            rawNthElement(range.fastBegin(), range.fastBegin() + n, range.fastEnd(), compares);
+    }
+
+    template <typename TYPE>
+    auto original::algorithms::randomAccess(const iterator<TYPE>& it) -> const randomAccessIterator<TYPE>*
+    {
+        if (auto* adaptor = dynamic_cast<const typename iterable<TYPE>::iterAdaptor*>(&it))
+            return randomAccess(adaptor->getIt());
+        return dynamic_cast<const randomAccessIterator<TYPE>*>(&it);
+    }
+
+    template <typename TYPE>
+    auto original::algorithms::contiguous(const iterator<TYPE>& begin, const iterator<TYPE>& end,
+                                          const bool inclusive, TYPE*& first, TYPE*& last) -> bool
+    {
+        auto* raw_begin = randomAccess(begin);
+        auto* raw_end = randomAccess(end);
+        if (raw_begin == nullptr || raw_end == nullptr || raw_begin->_container != raw_end->_container)
+            return false;
+
+        const int64_t size = raw_begin->_container->size();
+        const int64_t end_pos = raw_end->_pos + (inclusive ? 1 : 0);
+        if (raw_begin->_pos < 0 || raw_begin->_pos > raw_end->_pos || end_pos > size)
+            return false;
+
+        first = raw_begin->_ptr;
+        last = raw_begin->_ptr + (end_pos - raw_begin->_pos);
+        return true;
+    }
+
+    template <typename TYPE>
+    auto original::algorithms::contiguous(const iterator<TYPE>& begin, const uint32_t n, TYPE*& first) -> bool
+    {
+        auto* raw_begin = randomAccess(begin);
+        if (raw_begin == nullptr || raw_begin->_pos < 0
+            || raw_begin->_pos + n > static_cast<int64_t>(raw_begin->_container->size()))
+            return false;
+
+        first = raw_begin->_ptr;
+        return true;
+    }
+
+    template <uint32_t ARITY, typename TYPE, typename Callback>
+    auto original::algorithms::rawHeapAdjustDown(TYPE* first, const int64_t last,
+                                                 int64_t current, const Callback& compares) -> void
+    {
+        while (current * ARITY + 1 <= last)
+        {
+            int64_t child = current * ARITY + 1;
+            const int64_t bound = std::min<int64_t>(child + ARITY - 1, last);
+            for (int64_t i = child + 1; i <= bound; ++i) {
+                if (!compares(first[child], first[i]))
+                    child = i;
+            }
+            if (compares(first[current], first[child]))
+                break;
+            std::swap(first[current], first[child]);
+            current = child;
+        }
+    }
+
+    template <uint32_t ARITY, typename TYPE, typename Callback>
+    auto original::algorithms::rawHeapAdjustUp(TYPE* first, int64_t current, const Callback& compares) -> void
+    {
+        while (current > 0)
+        {
+            const int64_t parent = (current - 1) / ARITY;
+            if (!compares(first[current], first[parent]))
+                break;
+            std::swap(first[current], first[parent]);
+            current = parent;
+        }
+    }
+
+    template <typename TYPE, typename Kernel>
+    auto original::algorithms::buffered(const iterator<TYPE>& begin, const iterator<TYPE>& end,
+                                        Kernel kernel) -> void
+    {
+        TYPE* first;
+        TYPE* last;
+        if (contiguous(begin, end, true, first, last)) {
+            kernel(first, last);
+            return;
+        }
+        if (!begin.isValid())
+            return;
+
+        int64_t len = 0;
+        auto* it = begin.clone();
+        for (; it->isValid() && !it->equal(end); it->next()) {
+            len += 1;
+        }
+        if (it->isValid())
+            len += 1;
+        delete it;
+
+        std::allocator<TYPE> alloc;
+        TYPE* buffer = alloc.allocate(len);
+        it = begin.clone();
+        for (int64_t i = 0; i < len; ++i, it->next()) {
+            std::construct_at(buffer + i, std::move(it->get()));
+        }
+        kernel(buffer, buffer + len);
+        delete it;
+        it = begin.clone();
+        for (int64_t i = 0; i < len; ++i, it->next()) {
+            it->get() = std::move(buffer[i]);
+        }
+        delete it;
+        std::destroy_n(buffer, len);
+        alloc.deallocate(buffer, len);
+    }
+
+    template <typename TYPE, typename Callback>
+    auto original::algorithms::rawInsertionSort(TYPE* first, TYPE* last, const Callback& compares) -> void
+    {
+        if (first == last)
+            return;
+        for (TYPE* cur = first + 1; cur != last; ++cur) {
+            if (!compares(*cur, *(cur - 1)))
+                continue;
+            TYPE tmp = std::move(*cur);
+            TYPE* hole = cur;
+            do {
+                *hole = std::move(*(hole - 1));
+                --hole;
+            } while (hole != first && compares(tmp, *(hole - 1)));
+            *hole = std::move(tmp);
+        }
+    }
+
+    template <typename TYPE, typename Callback>
+    auto original::algorithms::rawPartition(TYPE* first, TYPE* last, const Callback& compares) -> TYPE*
+    {
+        // Median of three moved to *first, which then serves as the pivot of a Hoare partition.
+        TYPE* mid = first + (last - first) / 2;
+        TYPE* back = last - 1;
+        if (compares(*mid, *first))
+            std::swap(*mid, *first);
+        if (compares(*back, *mid)) {
+            std::swap(*back, *mid);
+            if (compares(*mid, *first))
+                std::swap(*mid, *first);
+        }
+        std::swap(*first, *mid);
+
+        TYPE* left = first + 1;
+        TYPE* right = last;
+        while (true) {
+            while (compares(*left, *first))
+                ++left;
+            --right;
+            while (compares(*first, *right))
+                --right;
+            if (left >= right)
+                break;
+            std::swap(*left, *right);
+            ++left;
+        }
+        std::swap(*first, *right);
+        return right;
+    }
+
+    template <typename TYPE, typename Callback>
+    auto original::algorithms::rawHeapSelect(TYPE* first, TYPE* middle, TYPE* last,
+                                             const Callback& compares) -> void
+    {
+        // A heap on the reversed order keeps the greatest selected element at the root.
+        const auto reversed = [&compares](const TYPE& t1, const TYPE& t2) {
+            return compares(t2, t1);
+        };
+        const int64_t len = middle - first;
+        for (int64_t i = len / 2 - 1; i >= 0; --i) {
+            rawHeapAdjustDown(first, len - 1, i, reversed);
+        }
+        for (TYPE* cur = middle; cur < last; ++cur) {
+            if (compares(*cur, *first)) {
+                std::swap(*cur, *first);
+                rawHeapAdjustDown(first, len - 1, 0, reversed);
             }
-            delete left;
-            return right;
         }
-        return frontOf(begin, distance(parent, begin) * 2 + 1);
+    }
+
+    template <typename TYPE, typename Callback>
+    auto original::algorithms::rawHeapSort(TYPE* first, TYPE* last, const Callback& compares) -> void
+    {
+        rawPartialSort(first, last, last, compares);
+    }
+
+    template <typename TYPE, typename Callback>
+    auto original::algorithms::rawIntroSort(TYPE* first, TYPE* last, int64_t depth,
+                                            const Callback& compares) -> void
+    {
+        while (last - first > INSERTION_SORT_THRESHOLD) {
+            if (depth == 0) {
+                rawHeapSort(first, last, compares);
+                return;
+            }
+            depth -= 1;
+            TYPE* pivot = rawPartition(first, last, compares);
+            if (pivot - first < last - pivot) {
+                rawIntroSort(first, pivot, depth, compares);
+                first = pivot + 1;
+            } else {
+                rawIntroSort(pivot + 1, last, depth, compares);
+                last = pivot;
+            }
+        }
+        rawInsertionSort(first, last, compares);
+    }
+
+    template <typename TYPE, typename Callback>
+    auto original::algorithms::rawSort(TYPE* first, TYPE* last, const Callback& compares) -> void
+    {
+        int64_t depth = 0;
+        for (int64_t len = last - first; len > 1; len >>= 1) {
+            depth += 2;
+        }
+        rawIntroSort(first, last, depth, compares);
+    }
+
+    template <typename TYPE, typename Callback>
+    auto original::algorithms::rawMerge(TYPE* src, const int64_t left, const int64_t mid, const int64_t right,
+                                        TYPE* dst, const Callback& compares) -> void
+    {
+        int64_t i = left;
+        int64_t j = mid;
+        int64_t k = left;
+        while (i < mid && j < right) {
+            if (compares(src[j], src[i])) {
+                dst[k++] = std::move(src[j++]);
+            } else {
+                dst[k++] = std::move(src[i++]);
+            }
+        }
+        while (i < mid) {
+            dst[k++] = std::move(src[i++]);
+        }
+        while (j < right) {
+            dst[k++] = std::move(src[j++]);
+        }
+    }
+
+    template <typename TYPE, typename Callback>
+    auto original::algorithms::rawStableSort(TYPE* first, TYPE* last, const Callback& compares) -> void
+    {
+        const int64_t len = last - first;
+        if (len <= INSERTION_SORT_THRESHOLD) {
+            rawInsertionSort(first, last, compares);
+            return;
+        }
+
+        // Bottom-up merge sort, ping-ponging between the range and a single scratch buffer.
+        std::allocator<TYPE> alloc;
+        TYPE* buffer = alloc.allocate(len);
+        std::uninitialized_move_n(first, len, buffer);
+        for (int64_t i = 0; i < len; i += INSERTION_SORT_THRESHOLD) {
+            rawInsertionSort(buffer + i, buffer + std::min(i + INSERTION_SORT_THRESHOLD, len), compares);
+        }
+
+        TYPE* src = buffer;
+        TYPE* dst = first;
+        for (int64_t width = INSERTION_SORT_THRESHOLD; width < len; width *= 2) {
+            for (int64_t left = 0; left < len; left += 2 * width) {
+                const int64_t mid = std::min(left + width, len);
+                const int64_t right = std::min(left + 2 * width, len);
+                rawMerge(src, left, mid, right, dst, compares);
+            }
+            std::swap(src, dst);
+        }
+        if (src != first)
+            std::move(src, src + len, first);
+
+        std::destroy_n(buffer, len);
+        alloc.deallocate(buffer, len);
+    }
+
+    template <typename TYPE, typename Callback>
+    auto original::algorithms::rawPartialSort(TYPE* first, TYPE* middle, TYPE* last,
+                                              const Callback& compares) -> void
+    {
+        if (first == middle)
+            return;
+        rawHeapSelect(first, middle, last, compares);
+        const auto reversed = [&compares](const TYPE& t1, const TYPE& t2) {
+            return compares(t2, t1);
+        };
+        for (int64_t i = middle - first - 1; i > 0; --i) {
+            std::swap(first[0], first[i]);
+            rawHeapAdjustDown(first, i - 1, 0, reversed);
+        }
+    }
+
+    template <typename TYPE, typename Callback>
+    auto original::algorithms::rawNthElement(TYPE* first, TYPE* nth, TYPE* last,
+                                             const Callback& compares) -> void
+    {
+        int64_t depth = 0;
+        for (int64_t len = last - first; len > 1; len >>= 1) {
+            depth += 2;
+        }
+        while (last - first > INSERTION_SORT_THRESHOLD) {
+            if (depth == 0) {
+                rawHeapSort(first, last, compares);
+                return;
+            }
+            depth -= 1;
+            TYPE* pivot = rawPartition(first, last, compares);
+            if (pivot == nth)
+                return;
+            if (nth < pivot) {
+                last = pivot;
+            } else {
+                first = pivot + 1;
+            }
+        }
+        rawInsertionSort(first, last, compares);
+    }
+
+    template <typename Kernel>
+    auto original::algorithms::parallelChunks(const int64_t len, Kernel kernel) -> void
+    {
+        auto& pool = threadPool::global();
+        const int64_t chunks = std::clamp<int64_t>(len / PARALLEL_GRAIN, 1, (pool.size() + 1) * 4);
+        pool.parallelFor(chunks, [len, chunks, &kernel](const int64_t i) {
+            kernel(len * i / chunks, len * (i + 1) / chunks);
+        });
+    }
+
+    template <typename TYPE, typename Callback>
+    auto original::algorithms::parallelFindIf(TYPE* first, const int64_t len,
+                                              const Callback& condition) -> int64_t
+    {
+        // Smallest matching index found so far, checked once per block so chunks past it stop early.
+        constexpr int64_t block = 1024;
+        std::atomic<int64_t> found{len};
+        parallelChunks(len, [first, &found, &condition](const int64_t from, const int64_t to) {
+            for (int64_t block_from = from; block_from < to; block_from += block) {
+                if (block_from >= found.load(std::memory_order_relaxed))
+                    return;
+                const int64_t block_to = std::min(block_from + block, to);
+                for (int64_t i = block_from; i < block_to; ++i) {
+                    if (condition(first[i])) {
+                        int64_t cur = found.load();
+                        while (i < cur && !found.compare_exchange_weak(cur, i)) {}
+                        return;
+                    }
+                }
+            }
+        });
+        return found.load();
     }
 
 #endif // ALGORITHMS_H
@@ -0,0 +1,276 @@
+#ifndef ALLOCATOR_H
+#define ALLOCATOR_H
+
+#include <cstdint>
+#include <memory>
+#include <new>
+
+/**
+ * @file allocator.h
+ * @brief Allocators selectable by the node based containers.
+ * @details An allocator hands out uninitialized storage, containers construct and destroy
+ *          the objects themselves. Every allocator provides:
+ *          - rebind_alloc<O>, the same allocator for another object type, together with a
+ *            constructor converting an allocator to its rebound type
+ *          - allocate(size) and deallocate(ptr, size)
+ *          - operator==, true when storage taken from one may be released through the other.
+ *            Lists only relink nodes between each other when their allocators compare equal.
+ */
+
+namespace original {
+
+    /**
+     * @class allocator
+     * @tparam TYPE Type of the allocated objects
+     * @brief Stateless allocator forwarding every request to the global operator new.
+     */
+    template<typename TYPE>
+    class allocator {
+    public:
+        template<typename O>
+        using rebind_alloc = allocator<O>;
+
+        allocator() = default;
+        template<typename O>
+        allocator(const allocator<O>& other);
+        TYPE* allocate(uint32_t size);
+        void deallocate(TYPE* ptr, uint32_t size);
+        bool operator==(const allocator& other) const;
+    };
+
+    /**
+     * @class slotPools
+     * @brief Object pools shared by a poolAllocator and its copies, one for each slot size and alignment.
+     * @details A poolAllocator rebound to another object type keeps using the same slotPools, so a
+     *          container handed a poolAllocator<TYPE> allocates its nodes from storage shared with
+     *          every other container handed a copy of it.
+     */
+    class slotPools {
+        class base {
+        public:
+            const std::size_t size;
+            const std::size_t align;
+            base* next;
+
+            base(std::size_t size, std::size_t align, base* next);
+            virtual ~base() = default;
+        };
+
+    public:
+        template<std::size_t SIZE, std::size_t ALIGN>
+        class pool final : public base {
+            union slot {
+                slot* next;
+                alignas(ALIGN) unsigned char data[SIZE];
+            };
+
+            struct slab {
+                slab* next;
+            };
+
+            static constexpr std::size_t SLAB_ALIGN = alignof(slot) > 64 ? alignof(slot) : 64;
+            static constexpr std::size_t SLAB_HEADER = (sizeof(slab) + alignof(slot) - 1) / alignof(slot) * alignof(slot);
+            static constexpr uint32_t SLAB_MIN_SLOTS = 8;
+            static constexpr uint32_t SLAB_MAX_SLOTS =
+                64 * 1024 / sizeof(slot) > SLAB_MIN_SLOTS ? 64 * 1024 / sizeof(slot) : SLAB_MIN_SLOTS;
+
+            slab* slabs_;
+            slot* free_;
+            slot* bump_;
+            slot* bump_end_;
+            uint32_t next_slots_;
+
+            void grow();
+        public:
+            explicit pool(base* next);
+            pool(const pool& other) = delete;
+            pool& operator=(const pool& other) = delete;
+            void* take();
+            void give(void* p);
+            ~pool() override;
+        };
+
+        slotPools();
+        slotPools(const slotPools& other) = delete;
+        slotPools& operator=(const slotPools& other) = delete;
+        template<std::size_t SIZE, std::size_t ALIGN>
+        pool<SIZE, ALIGN>* get();
+        ~slotPools();
+
+    private:
+        base* pools_;
+    };
+
+    /**
+     * @class poolAllocator
+     * @tparam TYPE Type of the allocated objects
+     * @brief Recycles single objects through a free list, carving new ones out of cache line aligned slabs.
+     * @details Slabs start small and double up to about 64 KiB, so empty containers stay cheap.
+     *          Slabs are not released while the pool lives, even once all their objects are freed;
+     *          the storage goes back to the system when the last allocator sharing the pool is destroyed.
+     *
+     *          Copies of an allocator, also those rebound to another object type, share its slotPools
+     *          and compare equal, independently constructed allocators never do. A pool is not
+     *          synchronized, containers sharing one must not be used from different threads concurrently.
+     *          The containers give every instance its own allocator unless one is passed to their
+     *          constructor, a container moved into takes over the pool of the source together with its
+     *          nodes. Lists constructed from copies of one allocator relink nodes between each other.
+     *
+     *          Requests for more than one object bypass the pool.
+     */
+    template<typename TYPE>
+    class poolAllocator {
+        using pool = slotPools::pool<sizeof(TYPE), alignof(TYPE)>;
+
+        std::shared_ptr<slotPools> pools_;
+        pool* pool_;
+
+        template<typename O>
+        friend class poolAllocator;
+    public:
+        template<typename O>
+        using rebind_alloc = poolAllocator<O>;
+
+        poolAllocator();
+        template<typename O>
+        poolAllocator(const poolAllocator<O>& other);
+        TYPE* allocate(uint32_t size);
+        void deallocate(TYPE* ptr, uint32_t size);
+        bool operator==(const poolAllocator& other) const;
+    };
+}
+
+    template <typename TYPE>
+    auto original::allocator<TYPE>::allocate(const uint32_t size) -> TYPE*
+    {
+        return std::allocator<TYPE>{}.allocate(size);
+    }
+
+    template <typename TYPE>
+    auto original::allocator<TYPE>::deallocate(TYPE* ptr, const uint32_t size) -> void
+    {
+        std::allocator<TYPE>{}.deallocate(ptr, size);
+    }
+
+    template <typename TYPE>
+    auto original::allocator<TYPE>::operator==(const allocator&) const -> bool
+    {
+        return true;
+    }
+
+    template <typename TYPE>
+    template <typename O>
+    original::allocator<TYPE>::allocator(const allocator<O>&) {}
+
+    inline original::slotPools::base::base(const std::size_t size, const std::size_t align, base* next)
+        : size(size), align(align), next(next) {}
+
+    template <std::size_t SIZE, std::size_t ALIGN>
+    original::slotPools::pool<SIZE, ALIGN>::pool(base* next)
+        : base(SIZE, ALIGN, next), slabs_(nullptr), free_(nullptr), bump_(nullptr), bump_end_(nullptr),
+          next_slots_(SLAB_MIN_SLOTS) {}
+
+    template <std::size_t SIZE, std::size_t ALIGN>
+    auto original::slotPools::pool<SIZE, ALIGN>::grow() -> void
+    {
+        auto* raw = static_cast<unsigned char*>(
+            ::operator new(SLAB_HEADER + this->next_slots_ * sizeof(slot), std::align_val_t{SLAB_ALIGN}));
+        auto* new_slab = reinterpret_cast<slab*>(raw);
+        new_slab->next = this->slabs_;
+        this->slabs_ = new_slab;
+        this->bump_ = reinterpret_cast<slot*>(raw + SLAB_HEADER);
+        this->bump_end_ = this->bump_ + this->next_slots_;
+        if (this->next_slots_ < SLAB_MAX_SLOTS)
+            this->next_slots_ = this->next_slots_ * 2 < SLAB_MAX_SLOTS ? this->next_slots_ * 2 : SLAB_MAX_SLOTS;
+    }
+
+    template <std::size_t SIZE, std::size_t ALIGN>
+    auto original::slotPools::pool<SIZE, ALIGN>::take() -> void*
+    {
+        if (this->free_ != nullptr) {
+            slot* s = this->free_;
+            this->free_ = s->next;
+            return s;
+        }
+        if (this->bump_ == this->bump_end_)
+            this->grow();
+        return this->bump_++;
+    }
+
+    template <std::size_t SIZE, std::size_t ALIGN>
+    auto original::slotPools::pool<SIZE, ALIGN>::give(void* p) -> void
+    {
+        auto* s = static_cast<slot*>(p);
+        s->next = this->free_;
+        this->free_ = s;
+    }
+
+    template <std::size_t SIZE, std::size_t ALIGN>
+    original::slotPools::pool<SIZE, ALIGN>::~pool()
+    {
+        while (this->slabs_ != nullptr) {
+            slab* s = this->slabs_;
+            this->slabs_ = s->next;
+            ::operator delete(s, std::align_val_t{SLAB_ALIGN});
+        }
+    }
+
+    inline original::slotPools::slotPools() : pools_(nullptr) {}
+
+    template <std::size_t SIZE, std::size_t ALIGN>
+    auto original::slotPools::get() -> pool<SIZE, ALIGN>*
+    {
+        for (base* p = this->pools_; p != nullptr; p = p->next) {
+            if (p->size == SIZE && p->align == ALIGN)
+                return static_cast<pool<SIZE, ALIGN>*>(p);
+        }
+        auto* created = new pool<SIZE, ALIGN>(this->pools_);
+        this->pools_ = created;
+        return created;
+    }
+
+    inline original::slotPools::~slotPools()
+    {
+        while (this->pools_ != nullptr) {
+            base* p = this->pools_;
+            this->pools_ = p->next;
+            delete p;
+        }
+    }
+
+    template <typename TYPE>
+    original::poolAllocator<TYPE>::poolAllocator()
+        : pools_(std::make_shared<slotPools>()),
+          pool_(this->pools_->template get<sizeof(TYPE), alignof(TYPE)>()) {}
+
+    template <typename TYPE>
+    template <typename O>
+    original::poolAllocator<TYPE>::poolAllocator(const poolAllocator<O>& other)
+        : pools_(other.pools_),
+          pool_(this->pools_->template get<sizeof(TYPE), alignof(TYPE)>()) {}
+
+    template <typename TYPE>
+    auto original::poolAllocator<TYPE>::allocate(const uint32_t size) -> TYPE*
+    {
+        if (size != 1)
+            return std::allocator<TYPE>{}.allocate(size);
+        return static_cast<TYPE*>(this->pool_->take());
+    }
+
+    template <typename TYPE>
+    auto original::poolAllocator<TYPE>::deallocate(TYPE* ptr, const uint32_t size) -> void
+    {
+        if (size != 1) {
+            std::allocator<TYPE>{}.deallocate(ptr, size);
+            return;
+        }
+        this->pool_->give(ptr);
+    }
+
+    template <typename TYPE>
+    auto original::poolAllocator<TYPE>::operator==(const poolAllocator& other) const -> bool
+    {
+        return this->pools_ == other.pools_;
+    }
+
+#endif //ALLOCATOR_H
@@ -7,6 +7,7 @@
 #include "baseArray.h"
 #include "iterationStream.h"
 #include "randomAccessIterator.h"
+#include "span.h"
 #include "error.h"
 
 namespace original{
@@ -40,6 +41,12 @@ namespace original{
         array& operator=(array&& other) noexcept;
         [[nodiscard]] uint32_t size() const override;
         TYPE& data() const;
+        TYPE* fastBegin();
+        TYPE* fastEnd();
+        const TYPE* fastBegin() const;
+        const TYPE* fastEnd() const;
+        span<TYPE> asSpan();
+        span<const TYPE> asSpan() const;
         TYPE get(int64_t index) const override;
         TYPE& operator[](int64_t index) override;
         void set(int64_t index, const TYPE &e) override;
@@ -138,9 +145,7 @@ namespace original{
         if (this == &other)
             return *this;
 
-        if (!this->empty())
-            this->arrDestruct();
-
+        this->arrDestruct();
         this->arrInit(other.size());
         for (uint32_t i = 0; i < this->size_; i++) {
             this->body[i] = other.body[i];
@@ -149,7 +154,7 @@ namespace original{
     }
 
     template<typename TYPE>
-    original::array<TYPE>::array(array&& other) noexcept : size_(0) {
+    original::array<TYPE>::array(array&& other) noexcept : size_(0), body() {
         this->operator=(std::move(other));
     }
 
@@ -158,9 +163,7 @@ namespace original{
         if (this == &other)
             return *this;
 
-        if (!this->empty())
-            this->arrDestruct();
-
+        this->arrDestruct();
         this->body = std::move(other.body);
         this->size_ = other.size_;
         other.arrInit(0);
@@ -183,6 +186,36 @@ namespace original{
         return this->body[0];
     }
 
+    template<typename TYPE>
+    auto original::array<TYPE>::fastBegin() -> TYPE* {
+        return this->body;
+    }
+
+    template<typename TYPE>
+    auto original::array<TYPE>::fastEnd() -> TYPE* {
+        return this->body + this->size();
+    }
+
+    template<typename TYPE>
+    auto original::array<TYPE>::fastBegin() const -> const TYPE* {
+        return this->body;
+    }
+
+    template<typename TYPE>
+    auto original::array<TYPE>::fastEnd() const -> const TYPE* {
+        return this->body + this->size();
+    }
+
+    template<typename TYPE>
+    auto original::array<TYPE>::asSpan() -> span<TYPE> {
+        return span<TYPE>(this->body, this->size());
+    }
+
+    template<typename TYPE>
+    auto original::array<TYPE>::asSpan() const -> span<const TYPE> {
+        return span<const TYPE>(this->body, this->size());
+    }
+
     template <typename TYPE>
     auto original::array<TYPE>::get(int64_t index) const -> TYPE
     {
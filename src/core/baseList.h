@@ -1,5 +1,6 @@
 #ifndef BASELIST_H
 #define BASELIST_H
+#include <utility>
 #include "serial.h"
 
 namespace original {
@@ -10,11 +11,20 @@ namespace original {
         virtual TYPE remove(const TYPE& e);
         virtual void clear();
         virtual void push(int64_t index, const TYPE& e) = 0;
+        virtual void push(int64_t index, TYPE&& e);
         virtual TYPE pop(int64_t index) = 0;
         virtual void pushBegin(const TYPE& e) = 0;
+        virtual void pushBegin(TYPE&& e);
         virtual TYPE popBegin() = 0;
         virtual void pushEnd(const TYPE& e) = 0;
+        virtual void pushEnd(TYPE&& e);
         virtual TYPE popEnd() = 0;
+        template<typename... Args>
+        void emplace(int64_t index, Args&&... args);
+        template<typename... Args>
+        void emplaceBegin(Args&&... args);
+        template<typename... Args>
+        void emplaceEnd(Args&&... args);
     };
 }
 
@@ -31,6 +41,48 @@ namespace original {
         return this->pop(index);
     }
 
+    // Lists that can take the element over should override the rvalue pushes, the defaults copy it.
+    template <typename TYPE>
+    auto original::baseList<TYPE>::push(const int64_t index, TYPE&& e) -> void
+    {
+        this->push(index, static_cast<const TYPE&>(e));
+    }
+
+    template <typename TYPE>
+    auto original::baseList<TYPE>::pushBegin(TYPE&& e) -> void
+    {
+        this->pushBegin(static_cast<const TYPE&>(e));
+    }
+
+    template <typename TYPE>
+    auto original::baseList<TYPE>::pushEnd(TYPE&& e) -> void
+    {
+        this->pushEnd(static_cast<const TYPE&>(e));
+    }
+
+    // Fallback emplaces build a temporary and move it in, implementations hide them
+    // with versions constructing the element directly in its storage.
+    template <typename TYPE>
+    template <typename... Args>
+    auto original::baseList<TYPE>::emplace(const int64_t index, Args&&... args) -> void
+    {
+        this->push(index, TYPE(std::forward<Args>(args)...));
+    }
+
+    template <typename TYPE>
+    template <typename... Args>
+    auto original::baseList<TYPE>::emplaceBegin(Args&&... args) -> void
+    {
+        this->pushBegin(TYPE(std::forward<Args>(args)...));
+    }
+
+    template <typename TYPE>
+    template <typename... Args>
+    auto original::baseList<TYPE>::emplaceEnd(Args&&... args) -> void
+    {
+        this->pushEnd(TYPE(std::forward<Args>(args)...));
+    }
+
     template<typename TYPE>
     auto original::baseList<TYPE>::clear() -> void {
         while (!this->empty()) {
@@ -0,0 +1,319 @@
+#ifndef BITKERNELS_H
+#define BITKERNELS_H
+
+#include <bit>
+#include <cstdint>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define ORIGINAL_BIT_KERNELS_X86 1
+#include <immintrin.h>
+#endif
+
+/**
+ * @file bitKernels.h
+ * @brief Word array kernels behind the bulk operations of bitSet.
+ * @details Each kernel works on n 64 bit words and comes in a scalar, an AVX2 and an AVX-512
+ *          version. The widest version the running CPU supports is picked once, on first use,
+ *          so the library itself is built without any -m flags. On other compilers and
+ *          architectures only the scalar versions exist, and the compiler is left to
+ *          vectorize them.
+ */
+
+namespace original::bitKernels {
+
+    using word = uint64_t;
+
+    /**
+     * @enum level
+     * @brief Instruction set a kernel table is built for.
+     */
+    enum class level {
+        SCALAR,
+        AVX2,
+        AVX512,
+    };
+
+    /**
+     * @class table
+     * @brief One function per kernel, every destination may alias its source.
+     */
+    class table {
+    public:
+        void (*andWords)(word* dst, const word* src, uint32_t n);
+        void (*orWords)(word* dst, const word* src, uint32_t n);
+        void (*xorWords)(word* dst, const word* src, uint32_t n);
+        void (*andNotWords)(word* dst, const word* src, uint32_t n);
+        void (*notWords)(word* dst, uint32_t n);
+        uint64_t (*popcount)(const word* src, uint32_t n);
+        bool (*anyWords)(const word* src, uint32_t n);
+        bool (*allWords)(const word* src, uint32_t n);
+    };
+
+    /**
+     * @brief Widest level the running CPU supports.
+     */
+    level detect();
+
+    /**
+     * @brief Kernels of the given level, or of the widest supported level below it.
+     */
+    const table& kernelsOf(level l);
+
+    /**
+     * @brief Kernels of the detected level.
+     */
+    const table& kernels();
+
+    /**
+     * @brief Set bits of a single word, for lookups too short to go through a kernel.
+     * @details std::popcount turns into a libgcc call on x86 builds without POPCNT, this stays inline.
+     */
+    uint32_t popcountWord(word w);
+}
+
+namespace original::bitKernels::scalar {
+
+    inline void andWords(word* dst, const word* src, const uint32_t n) {
+        for (uint32_t i = 0; i < n; ++i) dst[i] &= src[i];
+    }
+
+    inline void orWords(word* dst, const word* src, const uint32_t n) {
+        for (uint32_t i = 0; i < n; ++i) dst[i] |= src[i];
+    }
+
+    inline void xorWords(word* dst, const word* src, const uint32_t n) {
+        for (uint32_t i = 0; i < n; ++i) dst[i] ^= src[i];
+    }
+
+    inline void andNotWords(word* dst, const word* src, const uint32_t n) {
+        for (uint32_t i = 0; i < n; ++i) dst[i] &= ~src[i];
+    }
+
+    inline void notWords(word* dst, const uint32_t n) {
+        for (uint32_t i = 0; i < n; ++i) dst[i] = ~dst[i];
+    }
+
+    inline uint64_t popcount(const word* src, const uint32_t n) {
+        uint64_t count = 0;
+        for (uint32_t i = 0; i < n; ++i) count += std::popcount(src[i]);
+        return count;
+    }
+
+    inline bool anyWords(const word* src, const uint32_t n) {
+        word acc = 0;
+        for (uint32_t i = 0; i < n; ++i) acc |= src[i];
+        return acc != 0;
+    }
+
+    inline bool allWords(const word* src, const uint32_t n) {
+        word acc = ~static_cast<word>(0);
+        for (uint32_t i = 0; i < n; ++i) acc &= src[i];
+        return acc == ~static_cast<word>(0);
+    }
+}
+
+#ifdef ORIGINAL_BIT_KERNELS_X86
+
+// Binary kernel over 256 (or 512) bit lanes, finishing the tail with the scalar kernel.
+#define ORIGINAL_BIT_KERNEL_BINARY(NAME, TARGET, VEC, WIDTH, LOAD, STORE, OP)              \
+    __attribute__((target(TARGET)))                                                        \
+    inline void NAME(word* dst, const word* src, const uint32_t n) {                       \
+        uint32_t i = 0;                                                                    \
+        for (; i + WIDTH <= n; i += WIDTH) {                                               \
+            const VEC a = LOAD(reinterpret_cast<const VEC*>(dst + i));                     \
+            const VEC b = LOAD(reinterpret_cast<const VEC*>(src + i));                     \
+            STORE(reinterpret_cast<VEC*>(dst + i), OP);                                    \
+        }                                                                                  \
+        scalar::NAME(dst + i, src + i, n - i);                                             \
+    }
+
+namespace original::bitKernels::avx2 {
+
+    ORIGINAL_BIT_KERNEL_BINARY(andWords, "avx2", __m256i, 4, _mm256_loadu_si256, _mm256_storeu_si256,
+                               _mm256_and_si256(a, b))
+    ORIGINAL_BIT_KERNEL_BINARY(orWords, "avx2", __m256i, 4, _mm256_loadu_si256, _mm256_storeu_si256,
+                               _mm256_or_si256(a, b))
+    ORIGINAL_BIT_KERNEL_BINARY(xorWords, "avx2", __m256i, 4, _mm256_loadu_si256, _mm256_storeu_si256,
+                               _mm256_xor_si256(a, b))
+    ORIGINAL_BIT_KERNEL_BINARY(andNotWords, "avx2", __m256i, 4, _mm256_loadu_si256, _mm256_storeu_si256,
+                               _mm256_andnot_si256(b, a))
+
+    __attribute__((target("avx2")))
+    inline void notWords(word* dst, const uint32_t n) {
+        const __m256i ones = _mm256_set1_epi64x(-1);
+        uint32_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            auto* p = reinterpret_cast<__m256i*>(dst + i);
+            _mm256_storeu_si256(p, _mm256_xor_si256(_mm256_loadu_si256(p), ones));
+        }
+        scalar::notWords(dst + i, n - i);
+    }
+
+    // Nibble lookup through vpshufb, byte counts summed into 64 bit lanes by vpsadbw.
+    __attribute__((target("avx2")))
+    inline uint64_t popcount(const word* src, const uint32_t n) {
+        const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                                0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        const __m256i low_mask = _mm256_set1_epi8(0x0f);
+        __m256i acc = _mm256_setzero_si256();
+        uint32_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+            const __m256i lo = _mm256_and_si256(v, low_mask);
+            const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), low_mask);
+            const __m256i bytes = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, lo),
+                                                  _mm256_shuffle_epi8(lookup, hi));
+            acc = _mm256_add_epi64(acc, _mm256_sad_epu8(bytes, _mm256_setzero_si256()));
+        }
+        const uint64_t count = static_cast<uint64_t>(_mm256_extract_epi64(acc, 0))
+                             + static_cast<uint64_t>(_mm256_extract_epi64(acc, 1))
+                             + static_cast<uint64_t>(_mm256_extract_epi64(acc, 2))
+                             + static_cast<uint64_t>(_mm256_extract_epi64(acc, 3));
+        return count + scalar::popcount(src + i, n - i);
+    }
+
+    __attribute__((target("avx2")))
+    inline bool anyWords(const word* src, const uint32_t n) {
+        __m256i acc = _mm256_setzero_si256();
+        uint32_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            acc = _mm256_or_si256(acc, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)));
+        }
+        return !_mm256_testz_si256(acc, acc) || scalar::anyWords(src + i, n - i);
+    }
+
+    __attribute__((target("avx2")))
+    inline bool allWords(const word* src, const uint32_t n) {
+        const __m256i ones = _mm256_set1_epi64x(-1);
+        __m256i acc = ones;
+        uint32_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            acc = _mm256_and_si256(acc, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)));
+        }
+        return _mm256_testc_si256(acc, ones) && scalar::allWords(src + i, n - i);
+    }
+}
+
+namespace original::bitKernels::avx512 {
+
+    ORIGINAL_BIT_KERNEL_BINARY(andWords, "avx512f", __m512i, 8, _mm512_loadu_si512, _mm512_storeu_si512,
+                               _mm512_and_si512(a, b))
+    ORIGINAL_BIT_KERNEL_BINARY(orWords, "avx512f", __m512i, 8, _mm512_loadu_si512, _mm512_storeu_si512,
+                               _mm512_or_si512(a, b))
+    ORIGINAL_BIT_KERNEL_BINARY(xorWords, "avx512f", __m512i, 8, _mm512_loadu_si512, _mm512_storeu_si512,
+                               _mm512_xor_si512(a, b))
+    // Not _mm512_andnot_si512, which trips the same GCC 12 warning as the lane extraction below.
+    ORIGINAL_BIT_KERNEL_BINARY(andNotWords, "avx512f", __m512i, 8, _mm512_loadu_si512, _mm512_storeu_si512,
+                               _mm512_and_si512(a, _mm512_xor_si512(b, _mm512_set1_epi64(-1))))
+
+    __attribute__((target("avx512f")))
+    inline void notWords(word* dst, const uint32_t n) {
+        const __m512i ones = _mm512_set1_epi64(-1);
+        uint32_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            _mm512_storeu_si512(dst + i, _mm512_xor_si512(_mm512_loadu_si512(dst + i), ones));
+        }
+        scalar::notWords(dst + i, n - i);
+    }
+
+    // Needs the VPOPCNTDQ extension on top of AVX-512F, without it AVX2's popcount is used.
+    __attribute__((target("avx512f,avx512vpopcntdq")))
+    inline uint64_t popcount(const word* src, const uint32_t n) {
+        __m512i acc = _mm512_setzero_si512();
+        uint32_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(_mm512_loadu_si512(src + i)));
+        }
+        // Summed through memory: GCC 12 warns about an uninitialized register in every intrinsic
+        // that extracts or reduces the lanes, as they fill an undefined pass-through operand.
+        alignas(64) uint64_t lanes[8];
+        _mm512_store_si512(lanes, acc);
+        uint64_t count = 0;
+        for (const uint64_t lane : lanes) {
+            count += lane;
+        }
+        return count + scalar::popcount(src + i, n - i);
+    }
+
+    __attribute__((target("avx512f")))
+    inline bool anyWords(const word* src, const uint32_t n) {
+        __m512i acc = _mm512_setzero_si512();
+        uint32_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            acc = _mm512_or_si512(acc, _mm512_loadu_si512(src + i));
+        }
+        return _mm512_test_epi64_mask(acc, acc) != 0 || scalar::anyWords(src + i, n - i);
+    }
+
+    __attribute__((target("avx512f")))
+    inline bool allWords(const word* src, const uint32_t n) {
+        const __m512i ones = _mm512_set1_epi64(-1);
+        __m512i acc = ones;
+        uint32_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            acc = _mm512_and_si512(acc, _mm512_loadu_si512(src + i));
+        }
+        return _mm512_cmpneq_epi64_mask(acc, ones) == 0 && scalar::allWords(src + i, n - i);
+    }
+}
+
+#undef ORIGINAL_BIT_KERNEL_BINARY
+
+#endif // ORIGINAL_BIT_KERNELS_X86
+
+    inline auto original::bitKernels::popcountWord(word w) -> uint32_t
+    {
+#if defined(ORIGINAL_BIT_KERNELS_X86) && !defined(__POPCNT__)
+        w -= w >> 1 & 0x5555555555555555;
+        w = (w & 0x3333333333333333) + (w >> 2 & 0x3333333333333333);
+        w = (w + (w >> 4)) & 0x0F0F0F0F0F0F0F0F;
+        return w * 0x0101010101010101 >> 56;
+#else
+        return std::popcount(w);
+#endif
+    }
+
+    inline auto original::bitKernels::detect() -> level
+    {
+#ifdef ORIGINAL_BIT_KERNELS_X86
+        if (__builtin_cpu_supports("avx512f"))
+            return level::AVX512;
+        if (__builtin_cpu_supports("avx2"))
+            return level::AVX2;
+#endif
+        return level::SCALAR;
+    }
+
+    inline auto original::bitKernels::kernelsOf(const level l) -> const table&
+    {
+        static constexpr table scalar_table{
+            scalar::andWords, scalar::orWords, scalar::xorWords, scalar::andNotWords,
+            scalar::notWords, scalar::popcount, scalar::anyWords, scalar::allWords,
+        };
+#ifdef ORIGINAL_BIT_KERNELS_X86
+        static constexpr table avx2_table{
+            avx2::andWords, avx2::orWords, avx2::xorWords, avx2::andNotWords,
+            avx2::notWords, avx2::popcount, avx2::anyWords, avx2::allWords,
+        };
+        static const table avx512_table{
+            avx512::andWords, avx512::orWords, avx512::xorWords, avx512::andNotWords,
+            avx512::notWords,
+            __builtin_cpu_supports("avx512vpopcntdq") ? avx512::popcount : avx2::popcount,
+            avx512::anyWords, avx512::allWords,
+        };
+        const level supported = detect();
+        if (l >= level::AVX512 && supported >= level::AVX512)
+            return avx512_table;
+        if (l >= level::AVX2 && supported >= level::AVX2)
+            return avx2_table;
+#endif
+        return scalar_table;
+    }
+
+    inline auto original::bitKernels::kernels() -> const table&
+    {
+        static const table& detected = kernelsOf(detect());
+        return detected;
+    }
+
+#endif //BITKERNELS_H
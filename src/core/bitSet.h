@@ -1,17 +1,25 @@
 #ifndef BITSET_H
 #define BITSET_H
+#include <algorithm>
+#include <bit>
 #include "array.h"
+#include "bitKernels.h"
 #include "couple.h"
 #include "iterationStream.h"
 
 
 namespace original {
+    class rankSelect;
+
     class bitSet final : public baseArray<bool>, public iterationStream<bool, bitSet>{
             using underlying_type = uint64_t;
 
             static constexpr int64_t BLOCK_MAX_SIZE = sizeof(underlying_type) * 8;
             array<underlying_type> map;
             uint32_t size_;
+            // Bumped by every write so rankSelect can tell its index is stale. Mutable because
+            // Iterator writes through a const container pointer.
+            mutable uint64_t version_;
 
             void bitsetInit(uint32_t size);
             [[nodiscard]] static bool getBitFromBlock(underlying_type block_value, int64_t bit);
@@ -25,6 +33,13 @@ namespace original {
             void writeBit(int64_t bit, int64_t block, bool value);
             static couple<uint32_t, int64_t> toInnerIdx(int64_t index);
             static int64_t toOuterIdx(uint32_t cur_block, int64_t cur_bit);
+            [[nodiscard]] underlying_type* blocks() const;
+            [[nodiscard]] uint32_t blockCount() const;
+            template<typename Callback>
+            void applyRange(uint32_t lo, uint32_t hi, Callback operation);
+            void applyKernel(void (*kernel)(underlying_type*, const underlying_type*, uint32_t),
+                             const bitSet& other, bool clear_missing);
+            [[nodiscard]] uint32_t scanFrom(uint32_t index) const;
         public:
             class Iterator final : public baseIterator<bool> {
                     mutable int64_t cur_bit;
@@ -55,6 +70,42 @@ namespace original {
                     [[nodiscard]] bool isValid() const override;
             };
 
+            /**
+             * @class SetBitIterator
+             * @brief Forward iterator over the indexes of the set bits only.
+             * @details Takes the lowest set bit of the current block with countr_zero and jumps
+             *          over empty blocks, so a scan costs the number of set bits plus the number
+             *          of blocks. The bitSet must not change while it is being iterated.
+             */
+            class SetBitIterator {
+                    const underlying_type* blocks_;
+                    uint32_t blocks_count;
+                    uint32_t cur_block;
+                    underlying_type remaining;
+
+                    SetBitIterator(const underlying_type* blocks, uint32_t blocks_count, uint32_t block);
+                    void skipEmptyBlocks();
+                public:
+                    friend class bitSet;
+                    uint32_t operator*() const;
+                    SetBitIterator& operator++();
+                    bool operator==(const SetBitIterator& other) const;
+            };
+
+            /**
+             * @class SetBitRange
+             * @brief Range of SetBitIterator, for range-for over the set bits.
+             */
+            class SetBitRange {
+                    const bitSet* container_;
+
+                    explicit SetBitRange(const bitSet* container);
+                public:
+                    friend class bitSet;
+                    [[nodiscard]] SetBitIterator begin() const;
+                    [[nodiscard]] SetBitIterator end() const;
+            };
+
             explicit bitSet(uint32_t size);
             bitSet(const std::initializer_list<bool>& lst);
             bitSet(const bitSet& other);
@@ -62,7 +113,29 @@ namespace original {
             bitSet(bitSet&& other) noexcept;
             bitSet& operator=(bitSet&& other) noexcept;
             [[nodiscard]] uint32_t count() const;
+
+            /**
+             * @brief Whether at least one bit is set.
+             */
+            [[nodiscard]] bool any() const;
+
+            /**
+             * @brief Whether no bit is set.
+             */
+            [[nodiscard]] bool none() const;
+
+            /**
+             * @brief Whether every bit is set, true for an empty bitSet.
+             */
+            [[nodiscard]] bool all() const;
             [[nodiscard]] bitSet resize(uint32_t new_size) const;
+
+            /**
+             * @brief Changes the size in place, keeping the bits below both sizes.
+             * @details Shrinking keeps the words for a later growth, growing past them at least
+             *          doubles the storage, so repeated resizing stays amortized O(1) per word.
+             */
+            bitSet& resizeInPlace(uint32_t new_size);
             [[nodiscard]] uint32_t size() const override;
             [[nodiscard]] Iterator* begins() const override;
             [[nodiscard]] Iterator* ends() const override;
@@ -70,9 +143,76 @@ namespace original {
             bool& operator[](int64_t index) override;
             void set(int64_t index, const bool &e) override;
             [[nodiscard]] uint32_t indexOf(const bool &e) const override;
+
+            /**
+             * @brief Index of the first set bit, or size() if no bit is set.
+             */
+            [[nodiscard]] uint32_t findFirst() const;
+
+            /**
+             * @brief Index of the first set bit after pos, or size() if there is none.
+             */
+            [[nodiscard]] uint32_t findNext(uint32_t pos) const;
+
+            /**
+             * @brief Index of the last set bit, or size() if no bit is set.
+             */
+            [[nodiscard]] uint32_t findLast() const;
+
+            /**
+             * @brief The indexes of the set bits in increasing order, for range-for.
+             */
+            [[nodiscard]] SetBitRange setBits() const;
             bitSet& operator&=(const bitSet& other);
             bitSet& operator|=(const bitSet& other);
             bitSet& operator^=(const bitSet& other);
+
+            /**
+             * @brief Clears every bit that is set in other, the in place form of *this & ~other.
+             * @details As with the other compound operators, other is treated as resized to this size.
+             */
+            bitSet& andNot(const bitSet& other);
+
+            /**
+             * @brief Inverts every bit in place.
+             */
+            bitSet& flip();
+
+            /**
+             * @brief Sets every bit in [lo, hi).
+             * @throw outOfBoundError if lo > hi or hi > size().
+             */
+            bitSet& setRange(uint32_t lo, uint32_t hi);
+
+            /**
+             * @brief Clears every bit in [lo, hi).
+             * @throw outOfBoundError if lo > hi or hi > size().
+             */
+            bitSet& clearRange(uint32_t lo, uint32_t hi);
+
+            /**
+             * @brief Inverts every bit in [lo, hi).
+             * @throw outOfBoundError if lo > hi or hi > size().
+             */
+            bitSet& flipRange(uint32_t lo, uint32_t hi);
+
+            /**
+             * @brief Number of set bits in [lo, hi).
+             * @throw outOfBoundError if lo > hi or hi > size().
+             */
+            [[nodiscard]] uint32_t countRange(uint32_t lo, uint32_t hi) const;
+
+            /**
+             * @brief Moves every bit i to i + steps, like std::bitset.
+             * @details Bits moved past size() are dropped and the lowest steps bits are cleared.
+             */
+            bitSet& operator<<=(uint32_t steps);
+
+            /**
+             * @brief Moves every bit i to i - steps, like std::bitset.
+             * @details Bits moved below 0 are dropped and the highest steps bits are cleared.
+             */
+            bitSet& operator>>=(uint32_t steps);
             [[nodiscard]] std::string className() const override;
 
             template<typename Callback = transform<bool>>
@@ -82,6 +222,7 @@ namespace original {
             friend bitSet operator|(const bitSet& lbs, const bitSet& rbs);
             friend bitSet operator^(const bitSet& lbs, const bitSet& rbs);
             friend bitSet operator~(const bitSet& bs);
+            friend class rankSelect;
     };
 
     bitSet operator&(const bitSet& lbs, const bitSet& rbs);
@@ -94,6 +235,7 @@ namespace original {
     {
         this->map = array<underlying_type>((size + BLOCK_MAX_SIZE - 1) / BLOCK_MAX_SIZE);
         this->size_ = size;
+        this->version_ += 1;
     }
 
     inline auto original::bitSet::getBitFromBlock(const underlying_type block_value, const int64_t bit) -> bool {
@@ -110,12 +252,15 @@ namespace original {
 
     inline auto original::bitSet::clearHigherBitsFromBlock(const underlying_type block_value, const int64_t bit) -> underlying_type
     {
+        if (bit == BLOCK_MAX_SIZE - 1) return block_value;
         return block_value & (static_cast<underlying_type>(1) << bit + 1) - static_cast<underlying_type>(1);
     }
 
     inline auto original::bitSet::clearRedundantBits() -> void
     {
-        this->map.set(-1, clearHigherBitsFromBlock(this->map.get(-1), toInnerIdx(this->size() - 1).second()));
+        if (this->size() == 0) return;
+        underlying_type& last = this->blocks()[this->blockCount() - 1];
+        last = clearHigherBitsFromBlock(last, toInnerIdx(this->size() - 1).second());
     }
 
     inline auto original::bitSet::getBit(const int64_t bit, const int64_t block) const -> bool {
@@ -124,10 +269,12 @@ namespace original {
 
     inline auto original::bitSet::setBit(const int64_t bit, const int64_t block) -> void {
         this->map.set(block, setBitFromBlock(this->map.get(block), bit));
+        this->version_ += 1;
     }
 
     inline auto original::bitSet::clearBit(const int64_t bit, const int64_t block) -> void {
         this->map.set(block, clearBitFromBlock(this->map.get(block), bit));
+        this->version_ += 1;
     }
 
     inline auto original::bitSet::writeBit(const int64_t bit, const int64_t block, const bool value) -> void {
@@ -143,6 +290,117 @@ namespace original {
         return cur_block *  BLOCK_MAX_SIZE + cur_bit;
     }
 
+    inline auto original::bitSet::blocks() const -> underlying_type*
+    {
+        return &this->map.data();
+    }
+
+    // Blocks holding the size() bits, map can have more after resizeInPlace() shrank it. Every bit
+    // from size() on is kept clear, in those blocks too.
+    inline auto original::bitSet::blockCount() const -> uint32_t
+    {
+        return (this->size_ + BLOCK_MAX_SIZE - 1) / BLOCK_MAX_SIZE;
+    }
+
+    // Calls operation(block, mask) on each block of [lo, hi), mask selecting the bits inside.
+    template<typename Callback>
+    auto original::bitSet::applyRange(const uint32_t lo, const uint32_t hi, Callback operation) -> void
+    {
+        if (lo > hi || hi > this->size()) throw outOfBoundError();
+        if (lo == hi) return;
+
+        constexpr underlying_type full = ~static_cast<underlying_type>(0);
+        underlying_type* blocks = this->blocks();
+        const uint32_t first = lo / BLOCK_MAX_SIZE;
+        const uint32_t last = (hi - 1) / BLOCK_MAX_SIZE;
+        const underlying_type first_mask = full << lo % BLOCK_MAX_SIZE;
+        const underlying_type last_mask = full >> (BLOCK_MAX_SIZE - 1 - (hi - 1) % BLOCK_MAX_SIZE);
+        if (first == last) {
+            operation(blocks[first], first_mask & last_mask);
+        } else {
+            operation(blocks[first], first_mask);
+            for (uint32_t i = first + 1; i < last; ++i) {
+                operation(blocks[i], full);
+            }
+            operation(blocks[last], last_mask);
+        }
+        this->version_ += 1;
+    }
+
+    // Only the blocks both sets have are combined, clear_missing zeroes the blocks other lacks
+    // instead of keeping them. Bits of other beyond this size are then cleared again.
+    inline auto original::bitSet::applyKernel(void (*kernel)(underlying_type*, const underlying_type*, uint32_t),
+                                              const bitSet& other, const bool clear_missing) -> void
+    {
+        const uint32_t common = min(this->blockCount(), other.blockCount());
+        kernel(this->blocks(), other.blocks(), common);
+        if (clear_missing) {
+            std::fill(this->blocks() + common, this->blocks() + this->blockCount(), 0);
+        }
+        this->clearRedundantBits();
+        this->version_ += 1;
+    }
+
+    // Bits past size() are always clear, so the last block needs no extra masking.
+    inline auto original::bitSet::scanFrom(const uint32_t index) const -> uint32_t
+    {
+        if (index >= this->size()) return this->size();
+
+        auto idx = toInnerIdx(index);
+        const underlying_type* blocks = this->blocks();
+        underlying_type block = blocks[idx.first()] & ~static_cast<underlying_type>(0) << idx.second();
+        for (uint32_t i = idx.first(); ; block = blocks[i]) {
+            if (block != 0) return toOuterIdx(i, std::countr_zero(block));
+            if (++i == this->blockCount()) return this->size();
+        }
+    }
+
+    inline original::bitSet::SetBitIterator::SetBitIterator(const underlying_type* blocks,
+                                                            const uint32_t blocks_count, const uint32_t block)
+        : blocks_(blocks), blocks_count(blocks_count), cur_block(block),
+          remaining(block < blocks_count ? blocks[block] : 0)
+    {
+        this->skipEmptyBlocks();
+    }
+
+    inline auto original::bitSet::SetBitIterator::skipEmptyBlocks() -> void
+    {
+        while (this->remaining == 0 && this->cur_block < this->blocks_count) {
+            this->cur_block += 1;
+            this->remaining = this->cur_block < this->blocks_count ? this->blocks_[this->cur_block] : 0;
+        }
+    }
+
+    inline auto original::bitSet::SetBitIterator::operator*() const -> uint32_t
+    {
+        return toOuterIdx(this->cur_block, std::countr_zero(this->remaining));
+    }
+
+    inline auto original::bitSet::SetBitIterator::operator++() -> SetBitIterator&
+    {
+        this->remaining &= this->remaining - 1;
+        this->skipEmptyBlocks();
+        return *this;
+    }
+
+    inline auto original::bitSet::SetBitIterator::operator==(const SetBitIterator& other) const -> bool
+    {
+        return this->cur_block == other.cur_block && this->remaining == other.remaining;
+    }
+
+    inline original::bitSet::SetBitRange::SetBitRange(const bitSet* container) : container_(container) {}
+
+    inline auto original::bitSet::SetBitRange::begin() const -> SetBitIterator
+    {
+        return SetBitIterator(this->container_->blocks(), this->container_->blockCount(), 0);
+    }
+
+    inline auto original::bitSet::SetBitRange::end() const -> SetBitIterator
+    {
+        const uint32_t blocks_count = this->container_->blockCount();
+        return SetBitIterator(this->container_->blocks(), blocks_count, blocks_count);
+    }
+
     inline original::bitSet::Iterator::Iterator(const int64_t bit, const int64_t block, underlying_type* block_p, const bitSet* container)
         : cur_bit(bit), cur_block(block), block_(block_p), container_(container) {}
 
@@ -206,6 +464,7 @@ namespace original {
         auto new_idx = toInnerIdx(toOuterIdx(this->cur_block, this->cur_bit) + steps);
         this->cur_block = new_idx.first();
         this->cur_bit = new_idx.second();
+        this->block_ = &this->container_->map.data() + this->cur_block;
     }
 
     inline auto original::bitSet::Iterator::operator-=(const int64_t steps) const -> void
@@ -213,6 +472,7 @@ namespace original {
         auto new_idx = toInnerIdx(toOuterIdx(this->cur_block, this->cur_bit) - steps);
         this->cur_block = new_idx.first();
         this->cur_bit = new_idx.second();
+        this->block_ = &this->container_->map.data() + this->cur_block;
     }
 
     inline auto original::bitSet::Iterator::operator-(const iterator &other) const -> int64_t {
@@ -247,6 +507,7 @@ namespace original {
         if (!this->isValid()) throw outOfBoundError();
         *this->block_ = data ?
          setBitFromBlock(*this->block_, this->cur_bit) : clearBitFromBlock(*this->block_, this->cur_bit);
+        this->container_->version_ += 1;
     }
 
     inline auto original::bitSet::Iterator::isValid() const -> bool {
@@ -255,7 +516,7 @@ namespace original {
     }
 
     inline original::bitSet::bitSet(const uint32_t size)
-        : size_()
+        : size_(), version_()
     {
         this->bitsetInit(size);
     }
@@ -277,6 +538,7 @@ namespace original {
         if (this == &other) return *this;
         this->map = other.map;
         this->size_ = other.size_;
+        this->version_ += 1;
         return *this;
     }
 
@@ -292,20 +554,29 @@ namespace original {
 
         this->map = std::move(other.map);
         this->size_ = other.size_;
+        this->version_ += 1;
         other.bitsetInit(0);
         return *this;
     }
 
     inline auto original::bitSet::count() const -> uint32_t {
-        uint32_t count = 0;
-        for (const auto& e : this->map) {
-            auto n = e;
-            while (n) {
-                n &= n - 1;
-                count += 1;
-            }
-        }
-        return count;
+        return bitKernels::kernels().popcount(this->blocks(), this->blockCount());
+    }
+
+    inline auto original::bitSet::any() const -> bool {
+        return bitKernels::kernels().anyWords(this->blocks(), this->blockCount());
+    }
+
+    inline auto original::bitSet::none() const -> bool {
+        return !this->any();
+    }
+
+    inline auto original::bitSet::all() const -> bool {
+        if (this->size() == 0) return true;
+
+        auto last = toInnerIdx(this->size() - 1);
+        return bitKernels::kernels().allWords(this->blocks(), last.first())
+            && this->blocks()[last.first()] == clearHigherBitsFromBlock(~static_cast<underlying_type>(0), last.second());
     }
 
     inline auto original::bitSet::resize(const uint32_t new_size) const -> bitSet {
@@ -314,15 +585,27 @@ namespace original {
         }
 
         auto nb = bitSet(new_size);
-        const uint32_t blocks_min = min(nb.map.size(),
-                                        this->map.size());
-        for (uint32_t i = 0; i < blocks_min; i++) {
-            nb.map.set(i, this->map.get(i));
-        }
+        std::copy_n(this->blocks(), min(nb.blockCount(), this->blockCount()), nb.blocks());
         nb.clearRedundantBits();
         return nb;
     }
 
+    inline auto original::bitSet::resizeInPlace(const uint32_t new_size) -> bitSet& {
+        if (new_size < this->size()) {
+            this->clearRange(new_size, this->size());
+        }
+
+        const uint32_t needed = (new_size + BLOCK_MAX_SIZE - 1) / BLOCK_MAX_SIZE;
+        if (needed > this->map.size()) {
+            array<underlying_type> grown(max(needed, 2 * this->map.size()));
+            std::copy_n(this->blocks(), this->blockCount(), &grown.data());
+            this->map = std::move(grown);
+        }
+        this->size_ = new_size;
+        this->version_ += 1;
+        return *this;
+    }
+
     inline auto original::bitSet::size() const -> uint32_t {
         return this->size_;
     }
@@ -332,8 +615,8 @@ namespace original {
     }
 
     inline auto original::bitSet::ends() const -> Iterator* {
-        return new Iterator(toInnerIdx(this->size() - 1).second(), this->map.size() - 1,
-                    &this->map.data() + this->map.size() - 1, this);
+        return new Iterator(toInnerIdx(this->size() - 1).second(), this->blockCount() - 1,
+                    &this->map.data() + this->blockCount() - 1, this);
     }
 
     inline auto original::bitSet::get(int64_t index) const -> bool {
@@ -355,54 +638,137 @@ namespace original {
     }
 
     inline auto original::bitSet::indexOf(const bool &e) const -> uint32_t {
-        for (uint32_t i = 0; i < this->size(); i++) {
-            if (auto idx = toInnerIdx(i);
-                e == this->getBit(idx.second(), idx.first())) {
-                return i;
-            }
+        if (e) return this->findFirst();
+
+        for (uint32_t i = 0; i < this->blockCount(); i++) {
+            if (const underlying_type block = ~this->map.get(i); block != 0)
+                return min(static_cast<uint32_t>(toOuterIdx(i, std::countr_zero(block))), this->size());
         }
         return this->size();
     }
 
-    inline auto original::bitSet::operator&=(const bitSet &other) -> bitSet& {
-        if (this->size() != other.size()) {
-            const auto resized = other.resize(this->size());
-            for (uint32_t i = 0; i < this->map.size(); i++) {
-                this->map.set(i, this->map.get(i) & resized.map.get(i));
-            }
-        }else {
-            for (uint32_t i = 0; i < this->map.size(); i++) {
-                this->map.set(i, this->map.get(i) & other.map.get(i));
-            }
+    inline auto original::bitSet::findFirst() const -> uint32_t {
+        return this->scanFrom(0);
+    }
+
+    inline auto original::bitSet::findNext(const uint32_t pos) const -> uint32_t {
+        if (pos >= this->size()) return this->size();
+        return this->scanFrom(pos + 1);
+    }
+
+    inline auto original::bitSet::findLast() const -> uint32_t {
+        for (int64_t i = this->blockCount() - 1; i >= 0; i--) {
+            if (const underlying_type block = this->map.get(i); block != 0)
+                return toOuterIdx(i, BLOCK_MAX_SIZE - 1 - std::countl_zero(block));
         }
+        return this->size();
+    }
+
+    inline auto original::bitSet::setBits() const -> SetBitRange {
+        return SetBitRange(this);
+    }
+
+    inline auto original::bitSet::operator&=(const bitSet &other) -> bitSet& {
+        this->applyKernel(bitKernels::kernels().andWords, other, true);
         return *this;
     }
 
     inline auto original::bitSet::operator|=(const bitSet &other) -> bitSet& {
-        if (this->size() != other.size()) {
-            const auto resized = other.resize(this->size());
-            for (uint32_t i = 0; i < this->map.size(); i++) {
-                this->map.set(i, this->map.get(i) | resized.map.get(i));
-            }
-        }else {
-            for (uint32_t i = 0; i < this->map.size(); i++) {
-                this->map.set(i, this->map.get(i) | other.map.get(i));
-            }
-        }
+        this->applyKernel(bitKernels::kernels().orWords, other, false);
         return *this;
     }
 
     inline auto original::bitSet::operator^=(const bitSet &other) -> bitSet& {
-        if (this->size() != other.size()) {
-            const auto resized = other.resize(this->size());
-            for (uint32_t i = 0; i < this->map.size(); i++) {
-                this->map.set(i, this->map.get(i) ^ resized.map.get(i));
-            }
-        }else {
-            for (uint32_t i = 0; i < this->map.size(); i++) {
-                this->map.set(i, this->map.get(i) ^ other.map.get(i));
-            }
+        this->applyKernel(bitKernels::kernels().xorWords, other, false);
+        return *this;
+    }
+
+    inline auto original::bitSet::andNot(const bitSet &other) -> bitSet& {
+        this->applyKernel(bitKernels::kernels().andNotWords, other, false);
+        return *this;
+    }
+
+    inline auto original::bitSet::flip() -> bitSet& {
+        bitKernels::kernels().notWords(this->blocks(), this->blockCount());
+        this->clearRedundantBits();
+        this->version_ += 1;
+        return *this;
+    }
+
+    inline auto original::bitSet::setRange(const uint32_t lo, const uint32_t hi) -> bitSet& {
+        this->applyRange(lo, hi, [](underlying_type& block, const underlying_type mask) {
+            block |= mask;
+        });
+        return *this;
+    }
+
+    inline auto original::bitSet::clearRange(const uint32_t lo, const uint32_t hi) -> bitSet& {
+        this->applyRange(lo, hi, [](underlying_type& block, const underlying_type mask) {
+            block &= ~mask;
+        });
+        return *this;
+    }
+
+    inline auto original::bitSet::flipRange(const uint32_t lo, const uint32_t hi) -> bitSet& {
+        this->applyRange(lo, hi, [](underlying_type& block, const underlying_type mask) {
+            block ^= mask;
+        });
+        return *this;
+    }
+
+    inline auto original::bitSet::countRange(const uint32_t lo, const uint32_t hi) const -> uint32_t {
+        if (lo > hi || hi > this->size()) throw outOfBoundError();
+        if (lo == hi) return 0;
+
+        constexpr underlying_type full = ~static_cast<underlying_type>(0);
+        const underlying_type* blocks = this->blocks();
+        const uint32_t first = lo / BLOCK_MAX_SIZE;
+        const uint32_t last = (hi - 1) / BLOCK_MAX_SIZE;
+        const underlying_type first_mask = full << lo % BLOCK_MAX_SIZE;
+        const underlying_type last_mask = full >> (BLOCK_MAX_SIZE - 1 - (hi - 1) % BLOCK_MAX_SIZE);
+        if (first == last)
+            return bitKernels::popcountWord(blocks[first] & first_mask & last_mask);
+        return bitKernels::popcountWord(blocks[first] & first_mask)
+             + bitKernels::kernels().popcount(blocks + first + 1, last - first - 1)
+             + bitKernels::popcountWord(blocks[last] & last_mask);
+    }
+
+    inline auto original::bitSet::operator<<=(const uint32_t steps) -> bitSet& {
+        if (steps >= this->size()) {
+            return this->clearRange(0, this->size());
+        }
+
+        underlying_type* blocks = this->blocks();
+        const uint32_t n = this->blockCount();
+        const uint32_t block_steps = steps / BLOCK_MAX_SIZE;
+        const uint32_t bit_steps = steps % BLOCK_MAX_SIZE;
+        for (uint32_t i = n - 1; i > block_steps; --i) {
+            const underlying_type carry = bit_steps == 0 ? 0 : blocks[i - block_steps - 1] >> (BLOCK_MAX_SIZE - bit_steps);
+            blocks[i] = blocks[i - block_steps] << bit_steps | carry;
+        }
+        blocks[block_steps] = blocks[0] << bit_steps;
+        std::fill(blocks, blocks + block_steps, 0);
+        this->clearRedundantBits();
+        this->version_ += 1;
+        return *this;
+    }
+
+    inline auto original::bitSet::operator>>=(const uint32_t steps) -> bitSet& {
+        if (steps >= this->size()) {
+            return this->clearRange(0, this->size());
+        }
+
+        underlying_type* blocks = this->blocks();
+        const uint32_t n = this->blockCount();
+        const uint32_t block_steps = steps / BLOCK_MAX_SIZE;
+        const uint32_t bit_steps = steps % BLOCK_MAX_SIZE;
+        for (uint32_t i = 0; i + block_steps + 1 < n; ++i) {
+            const underlying_type carry = bit_steps == 0 ? 0 : blocks[i + block_steps + 1] << (BLOCK_MAX_SIZE - bit_steps);
+            blocks[i] = blocks[i + block_steps] >> bit_steps | carry;
         }
+        blocks[n - block_steps - 1] = blocks[n - 1] >> bit_steps;
+        std::fill(blocks + n - block_steps, blocks + n, 0);
+        this->version_ += 1;
         return *this;
     }
 
@@ -427,11 +793,7 @@ namespace original {
 
     inline auto original::operator~(const bitSet &bs) -> bitSet {
         bitSet nbs(bs);
-        for (uint32_t i = 0; i < nbs.map.size(); i++) {
-            nbs.map.set(i, ~nbs.map.get(i));
-        }
-        nbs.clearRedundantBits();
-        return nbs;
+        return nbs.flip();
     }
 
 #endif //BITSET_H
@@ -3,13 +3,24 @@
 
 #include "baseList.h"
 #include "couple.h"
+#include "span.h"
 #include "vector.h"
 
 namespace original {
+    // About 4 KiB worth of elements per block, but never fewer than 16 of them.
     template<typename TYPE>
-    class blocksList final : public baseList<TYPE>, public iterationStream<TYPE, blocksList<TYPE>>{
-        static constexpr uint32_t BLOCK_MAX_SIZE = 16;
+    constexpr uint32_t blocksListBlockSize()
+    {
+        return sizeof(TYPE) * 16 >= 4096 ? 16 : static_cast<uint32_t>(4096 / sizeof(TYPE));
+    }
+
+    template<typename TYPE, uint32_t BLOCK_SIZE = blocksListBlockSize<TYPE>()>
+    class blocksList final : public baseList<TYPE>, public iterationStream<TYPE, blocksList<TYPE, BLOCK_SIZE>>{
+        static constexpr uint32_t BLOCK_MAX_SIZE = BLOCK_SIZE;
         static constexpr uint32_t POS_INIT = (BLOCK_MAX_SIZE - 1) / 2 + 1;
+        // An empty list starts with first_ one past POS_INIT, which has to stay inside the block.
+        static_assert(POS_INIT + 1 < BLOCK_SIZE, "blocks need to hold at least 4 elements");
+        static constexpr uint32_t SPARE_BLOCKS_MAX = 4;
 
         vector<TYPE*> map;
         uint32_t size_;
@@ -17,10 +28,16 @@ namespace original {
         uint32_t last_;
         uint32_t first_block;
         uint32_t last_block;
+        TYPE* spare_blocks[SPARE_BLOCKS_MAX];
+        uint32_t spare_cnt;
 
         void blocksListInit();
         void blocksListDestruct() const;
         static TYPE* blockArrayInit();
+        TYPE* takeBlock();
+        void releaseBlock(TYPE* block);
+        void releaseSpareBlocks();
+        void trimBlocks(bool is_first);
         [[nodiscard]] static uint32_t innerIdxToAbsIdx(uint32_t block, uint32_t pos);
         [[nodiscard]] uint32_t firstAbsIdx() const;
         [[nodiscard]] uint32_t lastAbsIdx() const;
@@ -32,6 +49,8 @@ namespace original {
         [[nodiscard]] int64_t innerIdxToOuterIdx(uint32_t block, uint32_t pos) const;
         TYPE& getElem(uint32_t block, uint32_t pos) const;
         void setElem(uint32_t block, uint32_t pos, const TYPE& e);
+        template<typename... Args>
+        void emplaceElem(uint32_t block, uint32_t pos, Args&&... args);
         [[nodiscard]] bool growNeeded(uint32_t increment, bool is_first) const;
         void moveElements(uint32_t start_block, uint32_t start_pos, uint32_t len, int64_t offset);
         void addBlock(bool is_first);
@@ -73,32 +92,55 @@ namespace original {
         explicit blocksList();
         blocksList(const std::initializer_list<TYPE>& lst);
         explicit blocksList(const array<TYPE>& arr);
+        blocksList(const iterator<TYPE>& begin, const iterator<TYPE>& end);
         blocksList(const blocksList& other);
         blocksList& operator=(const blocksList& other);
         blocksList(blocksList&& other) noexcept;
         blocksList& operator=(blocksList&& other) noexcept;
         TYPE get(int64_t index) const override;
         [[nodiscard]] uint32_t size() const override;
+        [[nodiscard]] uint32_t capacity() const;
+        void reserve(uint32_t new_capacity);
+        void shrinkToFit();
+        [[nodiscard]] static constexpr uint32_t blockSize();
+        [[nodiscard]] uint32_t blockCount() const;
+        span<TYPE> blockSpan(uint32_t index);
+        span<const TYPE> blockSpan(uint32_t index) const;
         Iterator* begins() const override;
         Iterator* ends() const override;
         TYPE& operator[](int64_t index) override;
         void set(int64_t index, const TYPE &e) override;
         uint32_t indexOf(const TYPE &e) const override;
         void push(int64_t index, const TYPE &e) override;
+        void push(int64_t index, TYPE &&e) override;
         TYPE pop(int64_t index) override;
         void pushBegin(const TYPE &e) override;
+        void pushBegin(TYPE &&e) override;
         TYPE popBegin() override;
         void pushEnd(const TYPE &e) override;
+        void pushEnd(TYPE &&e) override;
+        void pushEnd(const iterator<TYPE>& begin, const iterator<TYPE>& end);
         TYPE popEnd() override;
+        template<typename... Args>
+        void emplace(int64_t index, Args&&... args);
+        template<typename... Args>
+        void emplaceBegin(Args&&... args);
+        template<typename... Args>
+        void emplaceEnd(Args&&... args);
         [[nodiscard]] std::string className() const override;
         ~blocksList() override;
     };
-}// namespace original
 
+    // blocksList with its default block size as a single parameter template, which the container adapters
+    // accept as their list also on compilers without relaxed template template argument matching.
     template <typename TYPE>
-    auto original::blocksList<TYPE>::blocksListInit() -> void
+    using defaultBlocksList = blocksList<TYPE>;
+}// namespace original
+
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::blocksListInit() -> void
     {
-        this->map = vector({blockArrayInit()});
+        this->map = vector({this->takeBlock()});
         this->size_ = 0;
         this->first_ = POS_INIT + 1;
         this->last_ = POS_INIT;
@@ -106,16 +148,16 @@ namespace original {
         this->last_block = this->map.size() / 2;
     }
 
-    template <typename TYPE>
-    auto original::blocksList<TYPE>::blocksListDestruct() const -> void
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::blocksListDestruct() const -> void
     {
         for (auto* block : this->map) {
             delete[] block;
         }
     }
 
-    template<typename TYPE>
-    auto original::blocksList<TYPE>::blockArrayInit() -> TYPE* {
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::blockArrayInit() -> TYPE* {
         auto arr = new TYPE[BLOCK_MAX_SIZE];
         for (uint32_t i = 0; i < BLOCK_MAX_SIZE; i++) {
             arr[i] = TYPE{};
@@ -123,82 +165,144 @@ namespace original {
         return arr;
     }
 
-    template <typename TYPE>
-    auto original::blocksList<TYPE>::innerIdxToAbsIdx(const uint32_t block, const uint32_t pos) -> uint32_t
+    // Blocks that emptied out are kept in a small cache, so push and pop churn at the ends reuses
+    // them instead of going back to the allocator.
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::takeBlock() -> TYPE*
+    {
+        if (this->spare_cnt > 0) {
+            this->spare_cnt -= 1;
+            return this->spare_blocks[this->spare_cnt];
+        }
+        return blockArrayInit();
+    }
+
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::releaseBlock(TYPE* block) -> void
+    {
+        if (this->spare_cnt < SPARE_BLOCKS_MAX) {
+            this->spare_blocks[this->spare_cnt] = block;
+            this->spare_cnt += 1;
+        } else {
+            delete[] block;
+        }
+    }
+
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::releaseSpareBlocks() -> void
+    {
+        for (uint32_t i = 0; i < this->spare_cnt; ++i) {
+            delete[] this->spare_blocks[i];
+        }
+        this->spare_cnt = 0;
+    }
+
+    // Called after a pop moved first_block or last_block inwards. One empty block stays on that
+    // side for the next push, the one beyond it goes to the cache.
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::trimBlocks(const bool is_first) -> void
+    {
+        if (is_first) {
+            if (this->first_block > 1) {
+                this->releaseBlock(this->map.popBegin());
+                this->first_block -= 1;
+                this->last_block -= 1;
+            }
+        } else if (this->map.size() > this->last_block + 2) {
+            this->releaseBlock(this->map.popEnd());
+        }
+    }
+
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::innerIdxToAbsIdx(const uint32_t block, const uint32_t pos) -> uint32_t
     {
         return block * BLOCK_MAX_SIZE + pos;
     }
 
-    template <typename TYPE>
-    auto original::blocksList<TYPE>::firstAbsIdx() const -> uint32_t
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::firstAbsIdx() const -> uint32_t
     {
         return innerIdxToAbsIdx(this->first_block, this->first_);
     }
 
-    template <typename TYPE>
-    auto original::blocksList<TYPE>::lastAbsIdx() const -> uint32_t
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::lastAbsIdx() const -> uint32_t
     {
         return innerIdxToAbsIdx(this->last_block, this->last_);
     }
 
-    template <typename TYPE>
-    auto original::blocksList<TYPE>::absIdxToOuterIdx(const uint32_t absIdx) const -> int64_t
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::absIdxToOuterIdx(const uint32_t absIdx) const -> int64_t
     {
         return absIdx - this->firstAbsIdx();
     }
 
-    template <typename TYPE>
-    auto original::blocksList<TYPE>::outerIdxToAbsIdx(const int64_t outerIdx) const -> uint32_t
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::outerIdxToAbsIdx(const int64_t outerIdx) const -> uint32_t
     {
         return this->firstAbsIdx() + outerIdx;
     }
 
-    template <typename TYPE>
-    auto original::blocksList<TYPE>::absIdxToInnerIdx(const uint32_t absIdx) -> couple<uint32_t, uint32_t>
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::absIdxToInnerIdx(const uint32_t absIdx) -> couple<uint32_t, uint32_t>
     {
         return {absIdx / BLOCK_MAX_SIZE, absIdx % BLOCK_MAX_SIZE};
     }
 
-    template<typename TYPE>
-    auto original::blocksList<TYPE>::innerIdxOffset(const uint32_t block, const uint32_t pos,
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::innerIdxOffset(const uint32_t block, const uint32_t pos,
                                                     const int64_t offset) -> couple<uint32_t, uint32_t>
     {
         return absIdxToInnerIdx(static_cast<uint32_t>(static_cast<int64_t>(innerIdxToAbsIdx(block, pos)) + offset));
     }
 
-    template<typename TYPE>
-    auto original::blocksList<TYPE>::outerIdxToInnerIdx(const int64_t outerIdx) const -> couple<uint32_t, uint32_t>
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::outerIdxToInnerIdx(const int64_t outerIdx) const -> couple<uint32_t, uint32_t>
     {
         return absIdxToInnerIdx(this->outerIdxToAbsIdx(outerIdx));
     }
 
-    template<typename TYPE>
-    auto original::blocksList<TYPE>::innerIdxToOuterIdx(const uint32_t block, const uint32_t pos) const -> int64_t
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::innerIdxToOuterIdx(const uint32_t block, const uint32_t pos) const -> int64_t
     {
         return this->absIdxToOuterIdx(innerIdxToAbsIdx(block, pos));
     }
 
-    template<typename TYPE>
-    auto original::blocksList<TYPE>::getElem(uint32_t block, uint32_t pos) const -> TYPE&
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::getElem(uint32_t block, uint32_t pos) const -> TYPE&
     {
         return this->map.get(block)[pos];
     }
 
-    template<typename TYPE>
-    auto original::blocksList<TYPE>::setElem(uint32_t block, uint32_t pos, const TYPE& e) -> void
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::setElem(uint32_t block, uint32_t pos, const TYPE& e) -> void
     {
         this->map.get(block)[pos] = e;
     }
 
-    template<typename TYPE>
-    auto original::blocksList<TYPE>::growNeeded(const uint32_t increment, bool is_first) const -> bool
+    // Slots of a block are always constructed, so emplacing assigns a value built from args.
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    template<typename... Args>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::emplaceElem(uint32_t block, uint32_t pos, Args&&... args) -> void
+    {
+        if constexpr (sizeof...(Args) == 1 && (std::is_same_v<std::remove_cvref_t<Args>, TYPE> && ...))
+        {
+            ((this->map.get(block)[pos] = std::forward<Args>(args)), ...);
+        }else
+        {
+            this->map.get(block)[pos] = TYPE(std::forward<Args>(args)...);
+        }
+    }
+
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::growNeeded(const uint32_t increment, bool is_first) const -> bool
     {
         return is_first ? firstAbsIdx() < increment
         : lastAbsIdx() + increment > innerIdxToAbsIdx(this->map.size() - 1, BLOCK_MAX_SIZE - 1);
     }
 
-    template <typename TYPE>
-    auto original::blocksList<TYPE>::moveElements(const uint32_t start_block, const uint32_t start_pos,
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::moveElements(const uint32_t start_block, const uint32_t start_pos,
                                                   const uint32_t len, const int64_t offset) -> void
     {
         if (offset > 0)
@@ -207,8 +311,8 @@ namespace original {
             {
                 auto idx = innerIdxOffset(start_block, start_pos, len - 1 - i);
                 auto idx_offset = innerIdxOffset(start_block, start_pos, len - 1 - i + offset);
-                this->setElem(idx_offset.first(), idx_offset.second(),
-                              this->getElem(idx.first(), idx.second()));
+                this->getElem(idx_offset.first(), idx_offset.second()) =
+                    std::move(this->getElem(idx.first(), idx.second()));
             }
         }else
         {
@@ -216,21 +320,21 @@ namespace original {
             {
                 auto idx = innerIdxOffset(start_block, start_pos, i);
                 auto idx_offset = innerIdxOffset(start_block, start_pos, i + offset);
-                this->setElem(idx_offset.first(), idx_offset.second(),
-                              this->getElem(idx.first(), idx.second()));
+                this->getElem(idx_offset.first(), idx_offset.second()) =
+                    std::move(this->getElem(idx.first(), idx.second()));
             }
         }
     }
 
-    template <typename TYPE>
-    auto original::blocksList<TYPE>::addBlock(bool is_first) -> void
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::addBlock(bool is_first) -> void
     {
-        auto* new_block = blockArrayInit();
+        auto* new_block = this->takeBlock();
         is_first ? this->map.pushBegin(new_block) : this->map.pushEnd(new_block);
     }
 
-    template<typename TYPE>
-    auto original::blocksList<TYPE>::adjust(const uint32_t increment, const bool is_first) -> void
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::adjust(const uint32_t increment, const bool is_first) -> void
     {
         if (this->growNeeded(increment, is_first)){
             uint32_t new_blocks_cnt = increment / BLOCK_MAX_SIZE + 1;
@@ -244,12 +348,12 @@ namespace original {
         }
     }
 
-    template <typename TYPE>
-    original::blocksList<TYPE>::Iterator::Iterator(const int64_t pos, const int64_t block, TYPE** data_ptr, const blocksList* container)
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    original::blocksList<TYPE, BLOCK_SIZE>::Iterator::Iterator(const int64_t pos, const int64_t block, TYPE** data_ptr, const blocksList* container)
         : cur_pos(pos), cur_block(block), data_(data_ptr), container_(container) {}
 
-    template <typename TYPE>
-    auto original::blocksList<TYPE>::Iterator::equalPtr(const iterator<TYPE>* other) const -> bool
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::Iterator::equalPtr(const iterator<TYPE>* other) const -> bool
     {
         auto* other_it = dynamic_cast<const Iterator*>(other);
         return other_it != nullptr
@@ -259,14 +363,14 @@ namespace original {
                && this->container_ == other_it->container_;
     }
 
-    template <typename TYPE>
-    original::blocksList<TYPE>::Iterator::Iterator(const Iterator& other) : Iterator(0, 0, nullptr, nullptr)
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    original::blocksList<TYPE, BLOCK_SIZE>::Iterator::Iterator(const Iterator& other) : Iterator(0, 0, nullptr, nullptr)
     {
         this->operator=(other);
     }
 
-    template <typename TYPE>
-    auto original::blocksList<TYPE>::Iterator::operator=(const Iterator& other) -> Iterator&
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::Iterator::operator=(const Iterator& other) -> Iterator&
     {
         if (this == &other)
             return *this;
@@ -278,54 +382,54 @@ namespace original {
         return *this;
     }
 
-    template <typename TYPE>
-    auto original::blocksList<TYPE>::Iterator::clone() const -> Iterator*
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::Iterator::clone() const -> Iterator*
     {
         return new Iterator(*this);
     }
 
-    template <typename TYPE>
-    auto original::blocksList<TYPE>::Iterator::hasNext() const -> bool
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::Iterator::hasNext() const -> bool
     {
         return blocksList::innerIdxToAbsIdx(this->cur_block, this->cur_pos) < this->container_->lastAbsIdx();
     }
 
-    template <typename TYPE>
-    auto original::blocksList<TYPE>::Iterator::hasPrev() const -> bool
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::Iterator::hasPrev() const -> bool
     {
         return blocksList::innerIdxToAbsIdx(this->cur_block, this->cur_pos) > this->container_->firstAbsIdx();
     }
 
-    template <typename TYPE>
-    auto original::blocksList<TYPE>::Iterator::next() const -> void
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::Iterator::next() const -> void
     {
         this->operator+=(1);
     }
 
-    template <typename TYPE>
-    auto original::blocksList<TYPE>::Iterator::prev() const -> void
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::Iterator::prev() const -> void
     {
         this->operator-=(1);
     }
 
-    template <typename TYPE>
-    auto original::blocksList<TYPE>::Iterator::operator+=(const int64_t steps) const -> void
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::Iterator::operator+=(const int64_t steps) const -> void
     {
         auto new_idx = innerIdxOffset(this->cur_block, this->cur_pos, steps);
         this->cur_block = new_idx.first();
         this->cur_pos = new_idx.second();
     }
 
-    template <typename TYPE>
-    auto original::blocksList<TYPE>::Iterator::operator-=(const int64_t steps) const -> void
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::Iterator::operator-=(const int64_t steps) const -> void
     {
         auto new_idx = innerIdxOffset(this->cur_block, this->cur_pos, -steps);
         this->cur_block = new_idx.first();
         this->cur_pos = new_idx.second();
     }
 
-    template <typename TYPE>
-    auto original::blocksList<TYPE>::Iterator::operator-(const iterator<TYPE>& other) const -> int64_t
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::Iterator::operator-(const iterator<TYPE>& other) const -> int64_t
     {
         auto* other_it = dynamic_cast<const Iterator*>(&other);
         if (other_it == nullptr)
@@ -341,8 +445,8 @@ namespace original {
                static_cast<int64_t>(innerIdxToAbsIdx(other_it->cur_block, other_it->cur_pos));
     }
 
-    template <typename TYPE>
-    auto original::blocksList<TYPE>::Iterator::getPrev() const -> Iterator*
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::Iterator::getPrev() const -> Iterator*
     {
         if (!this->isValid()) throw outOfBoundError();
         auto* it = this->clone();
@@ -350,8 +454,8 @@ namespace original {
         return it;
     }
 
-    template <typename TYPE>
-    auto original::blocksList<TYPE>::Iterator::getNext() const -> Iterator*
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::Iterator::getNext() const -> Iterator*
     {
         if (!this->isValid()) throw outOfBoundError();
         auto* it = this->clone();
@@ -359,36 +463,36 @@ namespace original {
         return it;
     }
 
-    template <typename TYPE>
-    auto original::blocksList<TYPE>::Iterator::get() -> TYPE&
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::Iterator::get() -> TYPE&
     {
         if (!this->isValid()) throw outOfBoundError();
         return this->data_[this->cur_block][this->cur_pos];
     }
 
-    template <typename TYPE>
-    auto original::blocksList<TYPE>::Iterator::get() const -> TYPE
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::Iterator::get() const -> TYPE
     {
         if (!this->isValid()) throw outOfBoundError();
         return this->data_[this->cur_block][this->cur_pos];
     }
 
-    template <typename TYPE>
-    auto original::blocksList<TYPE>::Iterator::set(const TYPE& data) -> void
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::Iterator::set(const TYPE& data) -> void
     {
         if (!this->isValid()) throw outOfBoundError();
         this->data_[this->cur_block][this->cur_pos] = data;
     }
 
-    template <typename TYPE>
-    auto original::blocksList<TYPE>::Iterator::isValid() const -> bool
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::Iterator::isValid() const -> bool
     {
         return this->container_->innerIdxToOuterIdx(this->cur_block, this->cur_pos) >= 0 &&
                this->container_->innerIdxToOuterIdx(this->cur_block, this->cur_pos) < this->container_->size();
     }
 
-    template <typename TYPE>
-    auto original::blocksList<TYPE>::Iterator::atPrev(const iterator<TYPE>* other) const -> bool
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::Iterator::atPrev(const iterator<TYPE>* other) const -> bool
     {
         auto* other_it = dynamic_cast<const Iterator*>(other);
         if (other_it == nullptr)
@@ -396,8 +500,8 @@ namespace original {
         return this->operator-(*other_it) == -1;
     }
 
-    template <typename TYPE>
-    auto original::blocksList<TYPE>::Iterator::atNext(const iterator<TYPE>* other) const -> bool
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::Iterator::atNext(const iterator<TYPE>* other) const -> bool
     {
         auto* other_it = dynamic_cast<const Iterator*>(other);
         if (other_it == nullptr)
@@ -405,20 +509,20 @@ namespace original {
         return this->operator-(*other_it) == 1;
     }
 
-    template<typename TYPE>
-    auto original::blocksList<TYPE>::Iterator::className() const -> std::string {
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::Iterator::className() const -> std::string {
         return "blocksList::Iterator";
     }
 
-    template<typename TYPE>
-    original::blocksList<TYPE>::blocksList()
-        : map(), size_(), first_(), last_(), first_block(), last_block()
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    original::blocksList<TYPE, BLOCK_SIZE>::blocksList()
+        : map(), size_(), first_(), last_(), first_block(), last_block(), spare_blocks(), spare_cnt()
     {
         this->blocksListInit();
     }
 
-    template<typename TYPE>
-    original::blocksList<TYPE>::blocksList(const std::initializer_list<TYPE>& lst) : blocksList() {
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    original::blocksList<TYPE, BLOCK_SIZE>::blocksList(const std::initializer_list<TYPE>& lst) : blocksList() {
         this->adjust(lst.size(), false);
         for (const auto& e : lst) {
             auto new_idx = innerIdxOffset(this->last_block, this->last_, 1);
@@ -429,8 +533,8 @@ namespace original {
         }
     }
 
-    template<typename TYPE>
-    original::blocksList<TYPE>::blocksList(const array<TYPE>& arr) : blocksList() {
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    original::blocksList<TYPE, BLOCK_SIZE>::blocksList(const array<TYPE>& arr) : blocksList() {
         this->adjust(arr.size(), false);
         for (const auto& e : arr) {
             auto new_idx = innerIdxOffset(this->last_block, this->last_, 1);
@@ -441,19 +545,25 @@ namespace original {
         }
     }
 
-    template<typename TYPE>
-    original::blocksList<TYPE>::blocksList(const blocksList& other) : blocksList() {
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    original::blocksList<TYPE, BLOCK_SIZE>::blocksList(const iterator<TYPE>& begin, const iterator<TYPE>& end) : blocksList() {
+        this->pushEnd(begin, end);
+    }
+
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    original::blocksList<TYPE, BLOCK_SIZE>::blocksList(const blocksList& other) : blocksList() {
         this->operator=(other);
     }
 
-    template<typename TYPE>
-    original::blocksList<TYPE>& original::blocksList<TYPE>::operator=(const blocksList& other) {
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    original::blocksList<TYPE, BLOCK_SIZE>& original::blocksList<TYPE, BLOCK_SIZE>::operator=(const blocksList& other) {
         if (this == &other) return *this;
 
+        this->blocksListDestruct();
         this->map = vector<TYPE*>{};
 
         for (int64_t i = 0; i < other.map.size(); ++i) {
-            auto* block = blockArrayInit();
+            auto* block = this->takeBlock();
             for (uint32_t j = 0; j < BLOCK_MAX_SIZE; ++j) {
                 block[j] = other.getElem(i, j);
             }
@@ -468,14 +578,14 @@ namespace original {
         return *this;
     }
 
-    template <typename TYPE>
-    original::blocksList<TYPE>::blocksList(blocksList&& other) noexcept : blocksList()
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    original::blocksList<TYPE, BLOCK_SIZE>::blocksList(blocksList&& other) noexcept : blocksList()
     {
         this->operator=(std::move(other));
     }
 
-    template <typename TYPE>
-    auto original::blocksList<TYPE>::operator=(blocksList&& other) noexcept -> blocksList&
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::operator=(blocksList&& other) noexcept -> blocksList&
     {
         if (this == &other)
             return *this;
@@ -488,51 +598,97 @@ namespace original {
         this->first_block = other.first_block;
         this->last_block = other.last_block;
         this->size_ = other.size_;
-        other.blocksListDestruct();
+        other.blocksListInit();
         return *this;
     }
 
-    template<typename TYPE>
-    auto original::blocksList<TYPE>::get(int64_t index) const -> TYPE {
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::get(int64_t index) const -> TYPE {
         if (this->indexOutOfBound(this->parseNegIndex(index))) throw outOfBoundError();
         index = this->parseNegIndex(index);
         auto inner_idx = this->outerIdxToInnerIdx(index);
         return this->getElem(inner_idx.first(), inner_idx.second());
     }
 
-    template<typename TYPE>
-    auto original::blocksList<TYPE>::size() const -> uint32_t {
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::size() const -> uint32_t {
         return this->size_;
     }
 
-    template<typename TYPE>
-    auto original::blocksList<TYPE>::begins() const -> Iterator* {
+    // Number of elements the list can hold before pushing at the end needs a new block.
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::capacity() const -> uint32_t {
+        return innerIdxToAbsIdx(this->map.size() - 1, BLOCK_MAX_SIZE - 1) - this->firstAbsIdx() + 1;
+    }
+
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::reserve(const uint32_t new_capacity) -> void {
+        if (new_capacity <= this->capacity())
+            return;
+
+        const uint32_t new_blocks_cnt = (new_capacity - this->capacity() + BLOCK_MAX_SIZE - 1) / BLOCK_MAX_SIZE;
+        this->map.reserve(this->map.size() + new_blocks_cnt);
+        for (uint32_t i = 0; i < new_blocks_cnt; ++i) {
+            this->addBlock(false);
+        }
+    }
+
+    // Frees every block that holds no element.
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::shrinkToFit() -> void {
+        this->releaseSpareBlocks();
+        if (this->empty()) {
+            this->blocksListDestruct();
+            this->blocksListInit();
+            return;
+        }
+        if (this->first_block == 0 && this->last_block == this->map.size() - 1) {
+            this->map.shrinkToFit();
+            return;
+        }
+
+        vector<TYPE*> new_map;
+        new_map.reserve(this->last_block - this->first_block + 1);
+        for (uint32_t i = 0; i < this->map.size(); ++i) {
+            if (i < this->first_block || i > this->last_block) {
+                delete[] this->map.get(i);
+            } else {
+                new_map.pushEnd(this->map.get(i));
+            }
+        }
+        this->map = std::move(new_map);
+        this->last_block -= this->first_block;
+        this->first_block = 0;
+    }
+
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::begins() const -> Iterator* {
         return new Iterator(this->first_, this->first_block, &this->map.data(), this);
     }
 
-    template<typename TYPE>
-    auto original::blocksList<TYPE>::ends() const -> Iterator* {
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::ends() const -> Iterator* {
         return new Iterator(this->last_, this->last_block, &this->map.data(), this);
     }
 
-    template<typename TYPE>
-    auto original::blocksList<TYPE>::operator[](int64_t index) -> TYPE& {
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::operator[](int64_t index) -> TYPE& {
         if (this->indexOutOfBound(this->parseNegIndex(index))) throw outOfBoundError();
         index = this->parseNegIndex(index);
         auto inner_idx = this->outerIdxToInnerIdx(index);
         return this->getElem(inner_idx.first(), inner_idx.second());
     }
 
-    template<typename TYPE>
-    auto original::blocksList<TYPE>::set(int64_t index, const TYPE &e) -> void {
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::set(int64_t index, const TYPE &e) -> void {
         if (this->indexOutOfBound(index)) throw outOfBoundError();
         index = this->parseNegIndex(index);
         auto inner_idx = this->outerIdxToInnerIdx(index);
         this->setElem(inner_idx.first(), inner_idx.second(), e);
     }
 
-    template<typename TYPE>
-    auto original::blocksList<TYPE>::indexOf(const TYPE &e) const -> uint32_t {
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::indexOf(const TYPE &e) const -> uint32_t {
         for (uint32_t i = 0; i < this->size(); ++i) {
             if (auto idx = this->outerIdxToInnerIdx(i);
                 this->getElem(idx.first(), idx.second()) == e)
@@ -541,24 +697,39 @@ namespace original {
         return this->size();
     }
 
-    template<typename TYPE>
-    auto original::blocksList<TYPE>::push(int64_t index, const TYPE& e) -> void
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::push(const int64_t index, const TYPE& e) -> void
+    {
+        this->emplace(index, e);
+    }
+
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::push(const int64_t index, TYPE&& e) -> void
+    {
+        this->emplace(index, std::move(e));
+    }
+
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    template<typename... Args>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::emplace(int64_t index, Args&&... args) -> void
     {
         if (this->parseNegIndex(index) == this->size())
         {
-            this->pushEnd(e);
+            this->emplaceEnd(std::forward<Args>(args)...);
         } else if (this->parseNegIndex(index) == 0)
         {
-            this->pushBegin(e);
+            this->emplaceBegin(std::forward<Args>(args)...);
         } else{
             if (this->indexOutOfBound(index))
                 throw outOfBoundError();
 
+            // args may refer to an element that is about to be shifted
+            TYPE e(std::forward<Args>(args)...);
             index = this->parseNegIndex(index);
             const bool is_first = index <= (this->size() - 1) / 2;
             this->adjust(1, is_first);
             if (is_first){
-                this->moveElements(this->first_block, this->first_, index + 1, -1);
+                this->moveElements(this->first_block, this->first_, index, -1);
                 auto new_idx = innerIdxOffset(this->first_block, this->first_, -1);
                 this->first_block = new_idx.first();
                 this->first_ = new_idx.second();
@@ -571,12 +742,12 @@ namespace original {
             }
             this->size_ += 1;
             auto idx = outerIdxToInnerIdx(index);
-            this->setElem(idx.first(), idx.second(), e);
+            this->emplaceElem(idx.first(), idx.second(), std::move(e));
         }
     }
 
-    template<typename TYPE>
-    auto original::blocksList<TYPE>::pop(int64_t index) -> TYPE
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::pop(int64_t index) -> TYPE
     {
         if (this->parseNegIndex(index) == 0)
             return this->popBegin();
@@ -587,8 +758,9 @@ namespace original {
 
         index = this->parseNegIndex(index);
         auto idx = outerIdxToInnerIdx(index);
-        TYPE res = this->getElem(idx.first(), idx.second());
-        if (index <= (this->size() - 1) / 2){
+        TYPE res = std::move(this->getElem(idx.first(), idx.second()));
+        const bool is_first = index <= (this->size() - 1) / 2;
+        if (is_first){
             moveElements(this->first_block, this->first_, index, 1);
             auto new_idx = innerIdxOffset(this->first_block, this->first_, 1);
             this->first_block = new_idx.first();
@@ -601,65 +773,153 @@ namespace original {
             this->last_ = new_idx.second();
         }
         this->size_ -= 1;
+        this->trimBlocks(is_first);
         return res;
     }
 
-    template<typename TYPE>
-    auto original::blocksList<TYPE>::pushBegin(const TYPE& e) -> void
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::pushBegin(const TYPE& e) -> void
+    {
+        this->emplaceBegin(e);
+    }
+
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::pushBegin(TYPE&& e) -> void
+    {
+        this->emplaceBegin(std::move(e));
+    }
+
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    template<typename... Args>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::emplaceBegin(Args&&... args) -> void
     {
         this->adjust(1, true);
         auto new_idx = innerIdxOffset(this->first_block, this->first_, -1);
         this->first_block = new_idx.first();
         this->first_ = new_idx.second();
-        this->setElem(this->first_block, this->first_, e);
+        this->emplaceElem(this->first_block, this->first_, std::forward<Args>(args)...);
         this->size_ += 1;
     }
 
-    template<typename TYPE>
-    auto original::blocksList<TYPE>::popBegin() -> TYPE
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::popBegin() -> TYPE
     {
         if (this->empty()) throw noElementError();
 
-        TYPE res = this->getElem(this->first_block, this->first_);
+        TYPE res = std::move(this->getElem(this->first_block, this->first_));
         auto new_idx = innerIdxOffset(this->first_block, this->first_, 1);
         this->first_block = new_idx.first();
         this->first_ = new_idx.second();
         this->size_ -= 1;
+        this->trimBlocks(true);
         return res;
     }
 
-    template<typename TYPE>
-    auto original::blocksList<TYPE>::pushEnd(const TYPE& e) -> void
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::pushEnd(const TYPE& e) -> void
+    {
+        this->emplaceEnd(e);
+    }
+
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::pushEnd(TYPE&& e) -> void
+    {
+        this->emplaceEnd(std::move(e));
+    }
+
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::pushEnd(const iterator<TYPE>& begin, const iterator<TYPE>& end) -> void
+    {
+        uint32_t len = 0;
+        auto* it = begin.clone();
+        for (; it->isValid() && !it->equal(end); it->next()) {
+            len += 1;
+        }
+        delete it;
+
+        this->reserve(this->size() + len);
+        it = begin.clone();
+        for (uint32_t i = 0; i < len; ++i, it->next()) {
+            auto new_idx = innerIdxOffset(this->last_block, this->last_, 1);
+            this->last_block = new_idx.first();
+            this->last_ = new_idx.second();
+            this->emplaceElem(this->last_block, this->last_, it->getElem());
+            this->size_ += 1;
+        }
+        delete it;
+    }
+
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    template<typename... Args>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::emplaceEnd(Args&&... args) -> void
     {
         this->adjust(1, false);
         auto new_idx = innerIdxOffset(this->last_block, this->last_, 1);
         this->last_block = new_idx.first();
         this->last_ = new_idx.second();
-        this->setElem(this->last_block, this->last_, e);
+        this->emplaceElem(this->last_block, this->last_, std::forward<Args>(args)...);
         this->size_ += 1;
     }
 
-    template<typename TYPE>
-    auto original::blocksList<TYPE>::popEnd() -> TYPE
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::popEnd() -> TYPE
     {
         if (this->empty()) throw noElementError();
 
-        TYPE res = this->getElem(this->last_block, this->last_);
+        TYPE res = std::move(this->getElem(this->last_block, this->last_));
         auto new_idx = innerIdxOffset(this->last_block, this->last_, -1);
         this->last_block = new_idx.first();
         this->last_ = new_idx.second();
         this->size_ -= 1;
+        this->trimBlocks(false);
         return res;
     }
 
-    template<typename TYPE>
-    auto original::blocksList<TYPE>::className() const -> std::string {
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    constexpr auto original::blocksList<TYPE, BLOCK_SIZE>::blockSize() -> uint32_t
+    {
+        return BLOCK_MAX_SIZE;
+    }
+
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::blockCount() const -> uint32_t
+    {
+        return this->empty() ? 0 : this->last_block - this->first_block + 1;
+    }
+
+    // The index-th block holding elements, cut down to its live elements: the first block
+    // starts at first_ and the last one ends at last_.
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::blockSpan(const uint32_t index) const -> span<const TYPE>
+    {
+        if (index >= this->blockCount()) throw outOfBoundError();
+
+        const uint32_t block = this->first_block + index;
+        const uint32_t begin = block == this->first_block ? this->first_ : 0;
+        const uint32_t end = block == this->last_block ? this->last_ + 1 : BLOCK_MAX_SIZE;
+        return span<const TYPE>(this->map.get(block) + begin, end - begin);
+    }
+
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::blockSpan(const uint32_t index) -> span<TYPE>
+    {
+        if (index >= this->blockCount()) throw outOfBoundError();
+
+        const uint32_t block = this->first_block + index;
+        const uint32_t begin = block == this->first_block ? this->first_ : 0;
+        const uint32_t end = block == this->last_block ? this->last_ + 1 : BLOCK_MAX_SIZE;
+        return span<TYPE>(this->map.get(block) + begin, end - begin);
+    }
+
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    auto original::blocksList<TYPE, BLOCK_SIZE>::className() const -> std::string {
         return "blocksList";
     }
 
-    template<typename TYPE>
-    original::blocksList<TYPE>::~blocksList() {
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    original::blocksList<TYPE, BLOCK_SIZE>::~blocksList() {
         this->blocksListDestruct();
+        this->releaseSpareBlocks();
     }
 
 #endif //BLOCKSLIST_H
@@ -2,25 +2,32 @@
 #define CHAIN_H
 #pragma once
 
+#include <cstdlib>
+#include <utility>
 #include "doubleDirectionIterator.h"
 #include "array.h"
 #include "baseList.h"
+#include "allocator.h"
 #include "iterationStream.h"
 
 
 namespace original {
-    template <typename TYPE>
-    class chain final : public baseList<TYPE>, public iterationStream<TYPE, chain<TYPE>>{
+    template <typename TYPE, typename ALLOC = allocator<TYPE>>
+    class chain final : public baseList<TYPE>, public iterationStream<TYPE, chain<TYPE, ALLOC>>{
         class chainNode final : public wrapper<TYPE>{
             public:
                 friend class iterator<TYPE>;
                 friend class chain;
+                friend class fastNodeIterator<chainNode, TYPE>;
+                friend class fastNodeIterator<const chainNode, const TYPE>;
             private:
                 TYPE data_;
                 chainNode* prev;
                 chainNode* next;
             protected:
                 explicit chainNode(const TYPE& data = TYPE{}, chainNode* prev = nullptr, chainNode* next = nullptr);
+                template<typename... Args>
+                explicit chainNode(std::in_place_t, Args&&... args);
                 chainNode(const chainNode& other);
                 chainNode& operator=(const chainNode& other);
                 TYPE& getVal() override;
@@ -36,13 +43,30 @@ namespace original {
         uint32_t size_;
         chainNode* begin_;
         chainNode* end_;
+        // Node of the last non-const indexed access, walks start from it when it is the closest known node.
+        // Const lookups only read it, so they can run concurrently.
+        chainNode* finger_;
+        uint32_t finger_pos_;
+
+        typename ALLOC::template rebind_alloc<chainNode> allocator_;
 
+        template<typename... Args>
+        chainNode* createNode(Args&&... args);
+        void destroyNode(chainNode* node);
         chainNode* findNode(int64_t index) const;
+        chainNode* findNode(int64_t index);
+        chainNode* pivotNode() const;
+        void unlinkRange(chainNode* first, chainNode* last, uint32_t count, uint32_t first_pos);
+        void linkRange(int64_t index, chainNode* first, chainNode* last, uint32_t count);
+        void moveElements(chainNode* first, uint32_t count, chainNode*& new_first, chainNode*& new_last);
         void chainInit();
         void firstAdd(chainNode* node);
         chainNode* lastDelete();
         void chainDestruction();
     public:
+        using FastIterator = fastNodeIterator<chainNode, TYPE>;
+        using ConstFastIterator = fastNodeIterator<const chainNode, const TYPE>;
+
         class Iterator final : public doubleDirectionIterator<TYPE>
         {
             explicit Iterator(chainNode* ptr);
@@ -57,6 +81,7 @@ namespace original {
         };
 
         explicit chain();
+        explicit chain(const ALLOC& alloc);
         chain(const chain& other);
         chain(const std::initializer_list<TYPE>& list);
         explicit chain(const array<TYPE>& arr);
@@ -64,34 +89,62 @@ namespace original {
         chain(chain&& other) noexcept;
         chain& operator=(chain&& other) noexcept;
         void operator+=(chain& other);
+        void splice(int64_t index, chain& other);
+        void splice(int64_t index, chain& other, int64_t first, int64_t last);
+        void concat(chain& other);
+        chain split(int64_t index);
         [[nodiscard]] uint32_t size() const override;
         TYPE get(int64_t index) const override;
+        TYPE get(int64_t index);
         TYPE& operator[](int64_t index) override;
         void set(int64_t index, const TYPE &e) override;
         uint32_t indexOf(const TYPE &e) const override;
         void pushBegin(const TYPE &e) override;
+        void pushBegin(TYPE &&e) override;
         void push(int64_t index, const TYPE &e) override;
+        void push(int64_t index, TYPE &&e) override;
         void pushEnd(const TYPE &e) override;
+        void pushEnd(TYPE &&e) override;
+        template<typename... Args>
+        void emplace(int64_t index, Args&&... args);
+        template<typename... Args>
+        void emplaceBegin(Args&&... args);
+        template<typename... Args>
+        void emplaceEnd(Args&&... args);
         TYPE popBegin() override;
         TYPE pop(int64_t index) override;
         TYPE popEnd() override;
+        FastIterator fastBegin();
+        FastIterator fastEnd();
+        ConstFastIterator fastBegin() const;
+        ConstFastIterator fastEnd() const;
         Iterator* begins() const override;
         Iterator* ends() const override;
         [[nodiscard]] std::string className() const override;
         ~chain() override;
     };
-}
 
+    // chain with its default allocator as a single parameter template, which the container adapters
+    // accept as their list also on compilers without relaxed template template argument matching.
     template <typename TYPE>
-    original::chain<TYPE>::chainNode::chainNode(const TYPE& data, chainNode* prev, chainNode* next)
+    using defaultChain = chain<TYPE>;
+}
+
+    template <typename TYPE, typename ALLOC>
+    original::chain<TYPE, ALLOC>::chainNode::chainNode(const TYPE& data, chainNode* prev, chainNode* next)
     : data_(data), prev(prev), next(next) {}
 
-    template<typename TYPE>
-    original::chain<TYPE>::chainNode::chainNode(const chainNode& other)
+    template <typename TYPE, typename ALLOC>
+    template <typename... Args>
+    original::chain<TYPE, ALLOC>::chainNode::chainNode(std::in_place_t, Args&&... args)
+    : data_(std::forward<Args>(args)...), prev(nullptr), next(nullptr) {}
+
+    template <typename TYPE, typename ALLOC>
+    original::chain<TYPE, ALLOC>::chainNode::chainNode(const chainNode& other)
             : data_(other.data_), prev(other.prev), next(other.next) {}
 
-    template<typename TYPE>
-    auto original::chain<TYPE>::chainNode::operator=(const chainNode& other) -> chainNode& {
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::chainNode::operator=(const chainNode& other) -> chainNode& {
         if (this != &other) {
             data_ = other.data_;
             prev = other.prev;
@@ -100,82 +153,188 @@ namespace original {
         return *this;
     }
 
-    template <typename TYPE>
-    auto original::chain<TYPE>::chainNode::getVal() -> TYPE&
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::chainNode::getVal() -> TYPE&
     {
         return this->data_;
     }
 
-    template <typename TYPE>
-    auto original::chain<TYPE>::chainNode::getVal() const -> const TYPE&
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::chainNode::getVal() const -> const TYPE&
     {
         return this->data_;
     }
 
-    template <typename TYPE>
-    auto original::chain<TYPE>::chainNode::setVal(TYPE data) -> void
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::chainNode::setVal(TYPE data) -> void
     {
         this->data_ = data;
     }
 
-    template <typename TYPE>
-    auto original::chain<TYPE>::chainNode::getPPrev() const -> chainNode* {
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::chainNode::getPPrev() const -> chainNode* {
         return this->prev;
     }
 
-    template <typename TYPE>
-    auto original::chain<TYPE>::chainNode::getPNext() const -> chainNode* {
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::chainNode::getPNext() const -> chainNode* {
         return this->next;
     }
 
-    template <typename TYPE>
-    auto original::chain<TYPE>::chainNode::setPPrev(chainNode* new_prev) -> void {
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::chainNode::setPPrev(chainNode* new_prev) -> void {
         this->prev = new_prev;
     }
 
-    template <typename TYPE>
-    auto original::chain<TYPE>::chainNode::setPNext(chainNode* new_next) -> void {
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::chainNode::setPNext(chainNode* new_next) -> void {
         this->next = new_next;
     }
 
-    template <typename TYPE>
-    auto original::chain<TYPE>::chainNode::connect(chainNode* prev, chainNode* next) -> void
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::chainNode::connect(chainNode* prev, chainNode* next) -> void
     {
         if (prev != nullptr) prev->setPNext(next);
         if (next != nullptr) next->setPPrev(prev);
     }
 
-    template<typename TYPE>
-    auto original::chain<TYPE>::findNode(int64_t index) const -> chainNode* {
-        const bool reverse_visit = index <= this->size() / 2 ? 0 : 1;
-        chainNode* cur;
-        if (!reverse_visit){
-            cur = this->begin_;
-            for(uint32_t i = 0; i < index; i++)
-            {
-                cur = cur->getPNext();
-            }
-        } else{
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::findNode(const int64_t index) const -> chainNode* {
+        chainNode* cur = this->begin_;
+        int64_t pos = 0;
+        if (index > static_cast<int64_t>(this->size()) - 1 - index){
             cur = this->end_;
-            for(uint32_t i = this->size() - 1; i > index; i -= 1)
-            {
-                cur = cur->getPPrev();
-            }
+            pos = this->size() - 1;
+        }
+        if (this->finger_ != nullptr
+            && std::abs(index - static_cast<int64_t>(this->finger_pos_)) < std::abs(index - pos)){
+            cur = this->finger_;
+            pos = this->finger_pos_;
+        }
+        for (; pos < index; pos += 1){
+            cur = cur->getPNext();
+        }
+        for (; pos > index; pos -= 1){
+            cur = cur->getPPrev();
         }
         return cur;
     }
 
-    template <typename TYPE>
-    auto original::chain<TYPE>::chainInit() -> void
+    // Same lookup, leaving the finger on the found node.
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::findNode(const int64_t index) -> chainNode* {
+        auto* cur = std::as_const(*this).findNode(index);
+        this->finger_ = cur;
+        this->finger_pos_ = index;
+        return cur;
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::pivotNode() const -> chainNode*
+    {
+        return this->size() == 0 ? this->end_ : this->begin_->getPPrev();
+    }
+
+    // Takes the count nodes from first to last, first being at first_pos, out of the chain without freeing them.
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::unlinkRange(chainNode* first, chainNode* last,
+                                                   const uint32_t count, const uint32_t first_pos) -> void
+    {
+        auto* prev = first->getPPrev();
+        auto* next = last->getPNext();
+        chainNode::connect(prev, next);
+        first->setPPrev(nullptr);
+        last->setPNext(nullptr);
+        if (first == this->begin_) this->begin_ = next;
+        if (next == nullptr) this->end_ = prev;
+        this->size_ -= count;
+
+        if (this->finger_ != nullptr && this->finger_pos_ >= first_pos){
+            if (this->finger_pos_ < first_pos + count){
+                this->finger_ = nullptr;
+            } else{
+                this->finger_pos_ -= count;
+            }
+        }
+    }
+
+    // Links the count nodes from first to last in front of the element at index, and leaves the finger on last.
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::linkRange(const int64_t index, chainNode* first, chainNode* last,
+                                                 const uint32_t count) -> void
+    {
+        auto* prev = index == 0 ? this->pivotNode() : this->findNode(index - 1);
+        auto* next = prev->getPNext();
+        chainNode::connect(prev, first);
+        chainNode::connect(last, next);
+        if (index == 0) this->begin_ = first;
+        if (next == nullptr) this->end_ = last;
+        this->size_ += count;
+        this->finger_ = last;
+        this->finger_pos_ = index + count - 1;
+    }
+
+    // Builds count detached nodes of this chain holding the elements moved out of the nodes from first on.
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::moveElements(chainNode* first, const uint32_t count,
+                                                    chainNode*& new_first, chainNode*& new_last) -> void
+    {
+        new_first = nullptr;
+        new_last = nullptr;
+        try {
+            for (uint32_t i = 0; i < count; i += 1){
+                auto* node = this->createNode(std::in_place, std::move(first->getVal()));
+                if (new_first == nullptr){
+                    new_first = node;
+                } else{
+                    chainNode::connect(new_last, node);
+                }
+                new_last = node;
+                first = first->getPNext();
+            }
+        } catch (...) {
+            while (new_first != nullptr){
+                auto* next = new_first->getPNext();
+                this->destroyNode(new_first);
+                new_first = next;
+            }
+            throw;
+        }
+    }
+
+    template <typename TYPE, typename ALLOC>
+    template <typename... Args>
+    auto original::chain<TYPE, ALLOC>::createNode(Args&&... args) -> chainNode*
     {
-        auto* pivot = new chainNode();
+        auto* node = this->allocator_.allocate(1);
+        try {
+            return new (node) chainNode(std::forward<Args>(args)...);
+        } catch (...) {
+            this->allocator_.deallocate(node, 1);
+            throw;
+        }
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::destroyNode(chainNode* node) -> void
+    {
+        node->~chainNode();
+        this->allocator_.deallocate(node, 1);
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::chainInit() -> void
+    {
+        auto* pivot = this->createNode();
         this->size_ = 0;
         this->begin_ = pivot->getPNext();
         this->end_ = pivot;
+        this->finger_ = nullptr;
+        this->finger_pos_ = 0;
     }
 
-    template <typename TYPE>
-    auto original::chain<TYPE>::firstAdd(chainNode* node) -> void
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::firstAdd(chainNode* node) -> void
     {
         chainNode::connect(this->end_, node);
         this->begin_ = node;
@@ -183,81 +342,88 @@ namespace original {
         this->size_ += 1;
     }
 
-    template <typename TYPE>
-    auto original::chain<TYPE>::lastDelete() -> chainNode*
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::lastDelete() -> chainNode*
     {
         auto* last = this->end_;
-        delete last->getPPrev();
+        this->destroyNode(last->getPPrev());
         this->chainInit();
         return last;
     }
 
-    template <typename TYPE>
-    auto original::chain<TYPE>::chainDestruction() -> void
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::chainDestruction() -> void
     {
         auto* current = this->end_;
         while (current) {
             auto* prev = current->getPPrev();
-            delete current;
+            this->destroyNode(current);
             current = prev;
         }
     }
 
-    template<typename TYPE>
-    original::chain<TYPE>::Iterator::Iterator(chainNode* ptr)
+    template <typename TYPE, typename ALLOC>
+    original::chain<TYPE, ALLOC>::Iterator::Iterator(chainNode* ptr)
         : doubleDirectionIterator<TYPE>::doubleDirectionIterator(ptr) {}
 
-    template<typename TYPE>
-    original::chain<TYPE>::Iterator::Iterator(const Iterator& other)
+    template <typename TYPE, typename ALLOC>
+    original::chain<TYPE, ALLOC>::Iterator::Iterator(const Iterator& other)
         : doubleDirectionIterator<TYPE>::doubleDirectionIterator(nullptr) {
         this->operator=(other);
     }
 
-    template<typename TYPE>
-    auto original::chain<TYPE>::Iterator::operator=(const Iterator& other) -> Iterator& {
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::Iterator::operator=(const Iterator& other) -> Iterator& {
         if (this == &other) return *this;
         doubleDirectionIterator<TYPE>::operator=(other);
         return *this;
     }
 
-    template<typename TYPE>
-    auto original::chain<TYPE>::Iterator::clone() const -> Iterator* {
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::Iterator::clone() const -> Iterator* {
         return new Iterator(*this);
     }
 
-    template<typename TYPE>
-    auto original::chain<TYPE>::Iterator::atPrev(const iterator<TYPE> *other) const -> bool {
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::Iterator::atPrev(const iterator<TYPE> *other) const -> bool {
         auto other_it = dynamic_cast<const Iterator*>(other);
         return other_it != nullptr && this->_ptr->getPNext() == other_it->_ptr;
     }
 
-    template<typename TYPE>
-    auto original::chain<TYPE>::Iterator::atNext(const iterator<TYPE> *other) const -> bool {
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::Iterator::atNext(const iterator<TYPE> *other) const -> bool {
         auto other_it = dynamic_cast<const Iterator*>(other);
         return other_it != nullptr && other_it->_ptr->getPNext() == this->_ptr;
     }
 
-    template<typename TYPE>
-    auto original::chain<TYPE>::Iterator::className() const -> std::string {
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::Iterator::className() const -> std::string {
         return "chain::Iterator";
     }
 
-    template <typename TYPE>
-    original::chain<TYPE>::chain() : size_(0)
+    template <typename TYPE, typename ALLOC>
+    original::chain<TYPE, ALLOC>::chain() : size_(0)
     {
         chainInit();
     }
 
-    template<typename TYPE>
-    original::chain<TYPE>::chain(const chain& other) : chain(){
+    // Lists constructed from copies of one allocator share its pool and splice in O(1).
+    template <typename TYPE, typename ALLOC>
+    original::chain<TYPE, ALLOC>::chain(const ALLOC& alloc) : size_(0), allocator_(alloc)
+    {
+        chainInit();
+    }
+
+    template <typename TYPE, typename ALLOC>
+    original::chain<TYPE, ALLOC>::chain(const chain& other) : chain(){
         this->operator=(other);
     }
 
-    template <typename TYPE>
-    original::chain<TYPE>::chain(const std::initializer_list<TYPE>& list)
+    template <typename TYPE, typename ALLOC>
+    original::chain<TYPE, ALLOC>::chain(const std::initializer_list<TYPE>& list)
         : chain() {
         for (const auto& e : list) {
-            auto* cur_node = new chainNode(e);
+            auto* cur_node = this->createNode(e);
             if (this->size() == 0)
             {
                 this->firstAdd(cur_node);
@@ -270,11 +436,11 @@ namespace original {
         }
     }
 
-    template <typename TYPE>
-    original::chain<TYPE>::chain(const array<TYPE>& arr)
+    template <typename TYPE, typename ALLOC>
+    original::chain<TYPE, ALLOC>::chain(const array<TYPE>& arr)
         : chain() {
         for (uint32_t i = 0; i < arr.size(); i++) {
-            auto* cur_node = new chainNode(arr.get(i));
+            auto* cur_node = this->createNode(arr.get(i));
             if (this->size() == 0)
             {
                 this->firstAdd(cur_node);
@@ -287,76 +453,135 @@ namespace original {
         }
     }
 
-    template<typename TYPE>
-    original::chain<TYPE>& original::chain<TYPE>::operator=(const chain& other){
+    template <typename TYPE, typename ALLOC>
+    original::chain<TYPE, ALLOC>& original::chain<TYPE, ALLOC>::operator=(const chain& other){
         if (this == &other) return *this;
         this->chainDestruction();
         this->size_ = other.size_;
         if (this->size() != 0){
             auto* other_ = other.begin_->getPPrev();
-            auto* pivot = new chainNode(other_->getVal());
+            auto* pivot = this->createNode(other_->getVal());
             other_ = other_->getPNext();
-            chainNode::connect(pivot, new chainNode(other_->getVal()));
+            chainNode::connect(pivot, this->createNode(other_->getVal()));
             this->begin_ = pivot->getPNext();
             auto* this_ = this->begin_;
             while (other_ != other.end_){
                 other_ = other_->getPNext();
-                chainNode::connect(this_, new chainNode(other_->getVal()));
+                chainNode::connect(this_, this->createNode(other_->getVal()));
                 this_ = this_->getPNext();
             }
             this->end_ = this_;
+            this->finger_ = nullptr;
         } else{
             this->chainInit();
         }
         return *this;
     }
 
-    template <typename TYPE>
-    original::chain<TYPE>::chain(chain&& other) noexcept : chain()
+    template <typename TYPE, typename ALLOC>
+    original::chain<TYPE, ALLOC>::chain(chain&& other) noexcept : chain()
     {
         this->operator=(std::move(other));
     }
 
-    template <typename TYPE>
-    auto original::chain<TYPE>::operator=(chain&& other) noexcept -> chain&
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::operator=(chain&& other) noexcept -> chain&
     {
         if (this == &other)
             return *this;
 
         this->chainDestruction();
+        std::swap(this->allocator_, other.allocator_);
         this->begin_ = other.begin_;
         this->end_ = other.end_;
         this->size_ = other.size_;
+        this->finger_ = other.finger_;
+        this->finger_pos_ = other.finger_pos_;
         other.chainInit();
         return *this;
     }
 
-    template <typename TYPE>
-    auto original::chain<TYPE>::operator+=(chain& other) -> void
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::operator+=(chain& other) -> void
     {
-        if (other.empty()) return;
+        this->concat(other);
+    }
 
-        this->size_ += other.size_;
-        delete other.begin_->getPPrev();
-        chainNode::connect(this->end_, other.begin_);
-        this->end_ = other.end_;
-        other.chainInit();
+    // Moves every node of other in front of the element at index, other is left empty.
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::splice(const int64_t index, chain& other) -> void
+    {
+        this->splice(index, other, 0, other.size());
     }
 
-    template <typename TYPE>
-    auto original::chain<TYPE>::size() const -> uint32_t
+    // Moves the nodes of other in [first, last) in front of the element at index. Nodes are relinked
+    // when the allocators of both chains compare equal, otherwise the elements are moved into new nodes.
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::splice(int64_t index, chain& other, int64_t first, int64_t last) -> void
+    {
+        if (this == &other) throw valueError();
+        index = this->parseNegIndex(index);
+        first = other.parseNegIndex(first);
+        last = other.parseNegIndex(last);
+        if (index < 0 || index > this->size() || first < 0 || first > last || last > other.size()){
+            throw outOfBoundError();
+        }
+        if (first == last) return;
+
+        const uint32_t count = last - first;
+        auto* first_node = first == 0 ? other.begin_ : other.findNode(first);
+        auto* last_node = last == other.size() ? other.end_ : other.findNode(last - 1);
+        if (this->allocator_ == other.allocator_){
+            other.unlinkRange(first_node, last_node, count, first);
+            this->linkRange(index, first_node, last_node, count);
+            return;
+        }
+
+        chainNode* new_first;
+        chainNode* new_last;
+        this->moveElements(first_node, count, new_first, new_last);
+        other.unlinkRange(first_node, last_node, count, first);
+        while (first_node != nullptr){
+            auto* next = first_node->getPNext();
+            other.destroyNode(first_node);
+            first_node = next;
+        }
+        this->linkRange(index, new_first, new_last, count);
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::concat(chain& other) -> void
+    {
+        this->splice(this->size(), other);
+    }
+
+    // Cuts the chain before index and returns the elements from index on as a new chain.
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::split(int64_t index) -> chain
+    {
+        index = this->parseNegIndex(index);
+        if (index < 0 || index > this->size()){
+            throw outOfBoundError();
+        }
+        chain tail;
+        tail.splice(0, *this, index, this->size());
+        return tail;
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::size() const -> uint32_t
     {
         return this->size_;
     }
 
-    template <typename TYPE>
-    auto original::chain<TYPE>::className() const -> std::string
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::className() const -> std::string
     {
         return "chain";
     }
 
-    template <typename TYPE>
-    auto original::chain<TYPE>::get(int64_t index) const -> TYPE
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::get(int64_t index) const -> TYPE
     {
         if (this->indexOutOfBound(index)){
             throw outOfBoundError();
@@ -365,8 +590,9 @@ namespace original {
         return cur->getVal();
     }
 
-    template <typename TYPE>
-    auto original::chain<TYPE>::operator[](const int64_t index) -> TYPE&
+    // Unlike the const overload, moves the finger, which makes scanning by index linear.
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::get(int64_t index) -> TYPE
     {
         if (this->indexOutOfBound(index)){
             throw outOfBoundError();
@@ -375,8 +601,18 @@ namespace original {
         return cur->getVal();
     }
 
-    template <typename TYPE>
-    auto original::chain<TYPE>::set(int64_t index, const TYPE &e) -> void
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::operator[](const int64_t index) -> TYPE&
+    {
+        if (this->indexOutOfBound(index)){
+            throw outOfBoundError();
+        }
+        chainNode* cur = this->findNode(this->parseNegIndex(index));
+        return cur->getVal();
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::set(int64_t index, const TYPE &e) -> void
     {
         if (this->indexOutOfBound(index)){
             throw outOfBoundError();
@@ -385,8 +621,8 @@ namespace original {
         cur->setVal(e);
     }
 
-    template <typename TYPE>
-    auto original::chain<TYPE>::indexOf(const TYPE &e) const -> uint32_t {
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::indexOf(const TYPE &e) const -> uint32_t {
         uint32_t i = 0;
         for (chainNode* current = this->begin_; current != nullptr; current = current->getPNext()) {
             if (current->getVal() == e) {
@@ -397,10 +633,47 @@ namespace original {
         return this->size();
     }
 
-    template <typename TYPE>
-    auto original::chain<TYPE>::pushBegin(const TYPE &e) -> void
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::pushBegin(const TYPE &e) -> void
+    {
+        this->emplaceBegin(e);
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::pushBegin(TYPE &&e) -> void
     {
-        auto* new_node = new chainNode(e);
+        this->emplaceBegin(std::move(e));
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::push(const int64_t index, const TYPE &e) -> void
+    {
+        this->emplace(index, e);
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::push(const int64_t index, TYPE &&e) -> void
+    {
+        this->emplace(index, std::move(e));
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::pushEnd(const TYPE &e) -> void
+    {
+        this->emplaceEnd(e);
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::pushEnd(TYPE &&e) -> void
+    {
+        this->emplaceEnd(std::move(e));
+    }
+
+    template <typename TYPE, typename ALLOC>
+    template <typename... Args>
+    auto original::chain<TYPE, ALLOC>::emplaceBegin(Args&&... args) -> void
+    {
+        auto* new_node = this->createNode(std::in_place, std::forward<Args>(args)...);
         if (this->size() == 0){
             this->firstAdd(new_node);
         } else{
@@ -409,34 +682,38 @@ namespace original {
             chainNode::connect(pivot, new_node);
             this->begin_ = new_node;
             this->size_ += 1;
+            this->finger_pos_ += 1;
         }
     }
 
-    template <typename TYPE>
-    auto original::chain<TYPE>::push(int64_t index, const TYPE &e) -> void
+    template <typename TYPE, typename ALLOC>
+    template <typename... Args>
+    auto original::chain<TYPE, ALLOC>::emplace(int64_t index, Args&&... args) -> void
     {
         index = this->parseNegIndex(index);
         if (index == 0){
-            this->pushBegin(e);
+            this->emplaceBegin(std::forward<Args>(args)...);
         } else if (index == this->size()){
-            this->pushEnd(e);
+            this->emplaceEnd(std::forward<Args>(args)...);
         } else{
             if (this->indexOutOfBound(index)){
                 throw outOfBoundError();
             }
-            auto* new_node = new chainNode(e);
+            auto* new_node = this->createNode(std::in_place, std::forward<Args>(args)...);
             chainNode* cur = this->findNode(index);
             auto* prev = cur->getPPrev();
             chainNode::connect(prev, new_node);
             chainNode::connect(new_node, cur);
             this->size_ += 1;
+            this->finger_ = new_node;
         }
     }
 
-    template <typename TYPE>
-    auto original::chain<TYPE>::pushEnd(const TYPE &e) -> void
+    template <typename TYPE, typename ALLOC>
+    template <typename... Args>
+    auto original::chain<TYPE, ALLOC>::emplaceEnd(Args&&... args) -> void
     {
-        auto* new_node = new chainNode(e);
+        auto* new_node = this->createNode(std::in_place, std::forward<Args>(args)...);
         if (this->size() == 0){
             this->firstAdd(new_node);
         } else{
@@ -446,23 +723,24 @@ namespace original {
         }
     }
 
-    template <typename TYPE>
-    auto original::chain<TYPE>::popBegin() -> TYPE
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::popBegin() -> TYPE
     {
-        TYPE res;
         if (this->size() == 0){
             throw noElementError();
         }
+        TYPE res = std::move(this->begin_->getVal());
         if (this->size() == 1){
-            auto* del = this->lastDelete();
-            res = del->getVal();
-            delete del;
-            this->chainInit();
+            this->destroyNode(this->lastDelete());
         } else{
-            res = this->begin_->getVal();
             auto* new_begin = this->begin_->getPNext();
             auto* pivot = this->begin_->getPPrev();
-            delete this->begin_;
+            if (this->finger_ == this->begin_){
+                this->finger_ = new_begin;
+            } else{
+                this->finger_pos_ -= 1;
+            }
+            this->destroyNode(this->begin_);
             this->begin_ = new_begin;
             chainNode::connect(pivot, this->begin_);
             this->size_ -= 1;
@@ -470,8 +748,8 @@ namespace original {
         return res;
     }
 
-    template <typename TYPE>
-    auto original::chain<TYPE>::pop(int64_t index) -> TYPE
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::pop(int64_t index) -> TYPE
     {
         index = this->parseNegIndex(index);
         if (index == 0){
@@ -483,33 +761,33 @@ namespace original {
         if (this->indexOutOfBound(index)){
             throw outOfBoundError();
         }
-        TYPE res;
         chainNode* cur = this->findNode(index);
-        res = cur->getVal();
+        TYPE res = std::move(cur->getVal());
         auto* prev = cur->getPPrev();
         auto* next = cur->getPNext();
         chainNode::connect(prev, next);
-        delete cur;
+        this->destroyNode(cur);
         this->size_ -= 1;
+        this->finger_ = next;
         return res;
     }
 
-    template <typename TYPE>
-    auto original::chain<TYPE>::popEnd() -> TYPE
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::popEnd() -> TYPE
     {
-        TYPE res;
         if (this->size() == 0){
             throw noElementError();
         }
+        TYPE res = std::move(this->end_->getVal());
         if (this->size() == 1){
-            auto* del = this->lastDelete();
-            res = del->getVal();
-            delete del;
-            this->chainInit();
+            this->destroyNode(this->lastDelete());
         } else{
-            res = this->end_->getVal();
             auto* new_end = this->end_->getPPrev();
-            delete this->end_;
+            if (this->finger_ == this->end_){
+                this->finger_ = new_end;
+                this->finger_pos_ -= 1;
+            }
+            this->destroyNode(this->end_);
             this->end_ = new_end;
             chainNode::connect(this->end_, nullptr);
             this->size_ -= 1;
@@ -517,18 +795,38 @@ namespace original {
         return res;
     }
 
-    template<typename TYPE>
-    auto original::chain<TYPE>::begins() const -> Iterator* {
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::fastBegin() -> FastIterator {
+        return FastIterator(this->begin_);
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::fastEnd() -> FastIterator {
+        return FastIterator();
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::fastBegin() const -> ConstFastIterator {
+        return ConstFastIterator(this->begin_);
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::fastEnd() const -> ConstFastIterator {
+        return ConstFastIterator();
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::begins() const -> Iterator* {
         return new Iterator(this->begin_);
     }
 
-    template<typename TYPE>
-    auto original::chain<TYPE>::ends() const -> Iterator* {
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::ends() const -> Iterator* {
         return new Iterator(this->end_);
     }
 
-    template <typename TYPE>
-    original::chain<TYPE>::~chain() {
+    template <typename TYPE, typename ALLOC>
+    original::chain<TYPE, ALLOC>::~chain() {
         this->chainDestruction();
     }
 
@@ -0,0 +1,717 @@
+#ifndef CIRCULARQUEUE_H
+#define CIRCULARQUEUE_H
+
+#include <limits>
+#include <memory>
+#include "array.h"
+#include "baseList.h"
+#include "iterationStream.h"
+
+namespace original {
+    /**
+     * @class circularQueue
+     * @tparam TYPE Type of the elements
+     * @brief Growable ring buffer list.
+     * @details The elements live in one buffer whose size is a power of two, the first one at any
+     *          slot and the others wrapping around the end. Both ends push and pop in O(1) without
+     *          moving other elements, an index is turned into a slot with a mask. Growing doubles
+     *          the buffer and lays the elements out again from its start.
+     */
+    template <typename TYPE>
+    class circularQueue final : public baseList<TYPE>, public iterationStream<TYPE, circularQueue<TYPE>>{
+        static constexpr uint32_t INNER_SIZE_INIT = 16;
+
+        uint32_t size_;
+        uint32_t max_size;
+        uint32_t inner_begin;
+        TYPE* body;
+
+        void circularQueueInit();
+        void circularQueueDestruct() const;
+        static TYPE* circularArrayInit(uint32_t size);
+        static void circularArrayFree(TYPE* arr, uint32_t size);
+        [[nodiscard]] static uint32_t roundUpSize(uint32_t size);
+        [[nodiscard]] uint32_t toInnerIdx(int64_t index) const;
+        TYPE* slot(int64_t index) const;
+        void grow(uint32_t new_size);
+        void adjust(uint32_t increment);
+    public:
+        class Iterator final : public baseIterator<TYPE>
+        {
+            mutable int64_t cur_pos;
+            const circularQueue* container_;
+
+            explicit Iterator(int64_t pos, const circularQueue* container);
+            bool equalPtr(const iterator<TYPE> *other) const override;
+        public:
+            friend circularQueue;
+            Iterator(const Iterator& other);
+            Iterator& operator=(const Iterator& other);
+            Iterator* clone() const override;
+            [[nodiscard]] bool hasNext() const override;
+            [[nodiscard]] bool hasPrev() const override;
+            void next() const override;
+            void prev() const override;
+            void operator+=(int64_t steps) const override;
+            void operator-=(int64_t steps) const override;
+            int64_t operator-(const iterator<TYPE>& other) const override;
+            Iterator* getPrev() const override;
+            Iterator* getNext() const override;
+            TYPE& get() override;
+            TYPE get() const override;
+            void set(const TYPE &data) override;
+            [[nodiscard]] bool isValid() const override;
+            bool atPrev(const iterator<TYPE> *other) const override;
+            bool atNext(const iterator<TYPE> *other) const override;
+            [[nodiscard]] std::string className() const override;
+        };
+
+        friend Iterator;
+        explicit circularQueue();
+        circularQueue(const std::initializer_list<TYPE>& list);
+        explicit circularQueue(const array<TYPE>& arr);
+        circularQueue(const iterator<TYPE>& begin, const iterator<TYPE>& end);
+        circularQueue(const circularQueue& other);
+        circularQueue& operator=(const circularQueue& other);
+        circularQueue(circularQueue&& other) noexcept;
+        circularQueue& operator=(circularQueue&& other) noexcept;
+        [[nodiscard]] uint32_t size() const override;
+        [[nodiscard]] uint32_t capacity() const;
+        void reserve(uint32_t new_capacity);
+        void shrinkToFit();
+        TYPE get(int64_t index) const override;
+        TYPE& operator[](int64_t index) override;
+        void set(int64_t index, const TYPE &e) override;
+        uint32_t indexOf(const TYPE &e) const override;
+        void pushBegin(const TYPE &e) override;
+        void pushBegin(TYPE &&e) override;
+        void push(int64_t index, const TYPE &e) override;
+        void push(int64_t index, TYPE &&e) override;
+        void pushEnd(const TYPE &e) override;
+        void pushEnd(TYPE &&e) override;
+        void pushEnd(const iterator<TYPE>& begin, const iterator<TYPE>& end);
+        template<typename... Args>
+        void emplace(int64_t index, Args&&... args);
+        template<typename... Args>
+        void emplaceBegin(Args&&... args);
+        template<typename... Args>
+        void emplaceEnd(Args&&... args);
+        TYPE popBegin() override;
+        TYPE pop(int64_t index) override;
+        TYPE popEnd() override;
+        Iterator* begins() const override;
+        Iterator* ends() const override;
+        [[nodiscard]] std::string className() const override;
+        ~circularQueue() override;
+    };
+}
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::circularQueueInit() -> void
+    {
+        this->size_ = 0;
+        this->max_size = INNER_SIZE_INIT;
+        this->inner_begin = 0;
+        this->body = circularQueue::circularArrayInit(INNER_SIZE_INIT);
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::circularQueueDestruct() const -> void
+    {
+        for (uint32_t i = 0; i < this->size(); ++i) {
+            std::destroy_at(this->slot(i));
+        }
+        circularQueue::circularArrayFree(this->body, this->max_size);
+    }
+
+    // Allocates raw storage for size elements, no element is constructed.
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::circularArrayInit(const uint32_t size) -> TYPE*
+    {
+        return std::allocator<TYPE>{}.allocate(size);
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::circularArrayFree(TYPE* arr, const uint32_t size) -> void
+    {
+        std::allocator<TYPE>{}.deallocate(arr, size);
+    }
+
+    // Smallest power of two buffer size holding size elements.
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::roundUpSize(const uint32_t size) -> uint32_t
+    {
+        uint32_t new_size = INNER_SIZE_INIT;
+        while (new_size < size) {
+            new_size *= 2;
+        }
+        return new_size;
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::toInnerIdx(const int64_t index) const -> uint32_t
+    {
+        return (this->inner_begin + static_cast<uint32_t>(index)) & (this->max_size - 1);
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::slot(const int64_t index) const -> TYPE*
+    {
+        return this->body + this->toInnerIdx(index);
+    }
+
+    // Moves the elements to a new buffer of new_size slots, the first one at slot 0.
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::grow(const uint32_t new_size) -> void
+    {
+        TYPE* new_body = circularQueue::circularArrayInit(new_size);
+        for (uint32_t i = 0; i < this->size(); ++i) {
+            TYPE* old_slot = this->slot(i);
+            std::construct_at(new_body + i, std::move(*old_slot));
+            std::destroy_at(old_slot);
+        }
+        circularQueue::circularArrayFree(this->body, this->max_size);
+        this->body = new_body;
+        this->max_size = new_size;
+        this->inner_begin = 0;
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::adjust(const uint32_t increment) -> void
+    {
+        if (this->size() + increment > this->max_size) {
+            this->grow(roundUpSize(this->size() + increment));
+        }
+    }
+
+    template <typename TYPE>
+    original::circularQueue<TYPE>::Iterator::Iterator(const int64_t pos, const circularQueue* container)
+        : cur_pos(pos), container_(container) {}
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::Iterator::equalPtr(const iterator<TYPE>* other) const -> bool
+    {
+        auto* other_it = dynamic_cast<const Iterator*>(other);
+        return other_it != nullptr
+               && this->cur_pos == other_it->cur_pos
+               && this->container_ == other_it->container_;
+    }
+
+    template <typename TYPE>
+    original::circularQueue<TYPE>::Iterator::Iterator(const Iterator& other) : Iterator(0, nullptr)
+    {
+        this->operator=(other);
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::Iterator::operator=(const Iterator& other) -> Iterator&
+    {
+        if (this == &other)
+            return *this;
+
+        this->cur_pos = other.cur_pos;
+        this->container_ = other.container_;
+        return *this;
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::Iterator::clone() const -> Iterator*
+    {
+        return new Iterator(*this);
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::Iterator::hasNext() const -> bool
+    {
+        return this->cur_pos < static_cast<int64_t>(this->container_->size()) - 1;
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::Iterator::hasPrev() const -> bool
+    {
+        return this->cur_pos > 0;
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::Iterator::next() const -> void
+    {
+        this->cur_pos += 1;
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::Iterator::prev() const -> void
+    {
+        this->cur_pos -= 1;
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::Iterator::operator+=(const int64_t steps) const -> void
+    {
+        this->cur_pos += steps;
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::Iterator::operator-=(const int64_t steps) const -> void
+    {
+        this->cur_pos -= steps;
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::Iterator::operator-(const iterator<TYPE>& other) const -> int64_t
+    {
+        auto* other_it = dynamic_cast<const Iterator*>(&other);
+        if (other_it == nullptr)
+            return this > &other ?
+                std::numeric_limits<int64_t>::max() :
+                std::numeric_limits<int64_t>::min();
+        if (this->container_ != other_it->container_)
+            return this->container_ > other_it->container_ ?
+                std::numeric_limits<int64_t>::max() :
+                std::numeric_limits<int64_t>::min();
+
+        return this->cur_pos - other_it->cur_pos;
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::Iterator::getPrev() const -> Iterator*
+    {
+        if (!this->isValid()) throw outOfBoundError();
+        auto* it = this->clone();
+        it->prev();
+        return it;
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::Iterator::getNext() const -> Iterator*
+    {
+        if (!this->isValid()) throw outOfBoundError();
+        auto* it = this->clone();
+        it->next();
+        return it;
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::Iterator::get() -> TYPE&
+    {
+        if (!this->isValid()) throw outOfBoundError();
+        return *this->container_->slot(this->cur_pos);
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::Iterator::get() const -> TYPE
+    {
+        if (!this->isValid()) throw outOfBoundError();
+        return *this->container_->slot(this->cur_pos);
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::Iterator::set(const TYPE& data) -> void
+    {
+        if (!this->isValid()) throw outOfBoundError();
+        *this->container_->slot(this->cur_pos) = data;
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::Iterator::isValid() const -> bool
+    {
+        return this->container_ != nullptr
+               && this->cur_pos >= 0
+               && this->cur_pos < this->container_->size();
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::Iterator::atPrev(const iterator<TYPE>* other) const -> bool
+    {
+        auto* other_it = dynamic_cast<const Iterator*>(other);
+        if (other_it == nullptr)
+            return false;
+        return this->operator-(*other_it) == -1;
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::Iterator::atNext(const iterator<TYPE>* other) const -> bool
+    {
+        auto* other_it = dynamic_cast<const Iterator*>(other);
+        if (other_it == nullptr)
+            return false;
+        return this->operator-(*other_it) == 1;
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::Iterator::className() const -> std::string
+    {
+        return "circularQueue::Iterator";
+    }
+
+    template <typename TYPE>
+    original::circularQueue<TYPE>::circularQueue() : size_(), max_size(), inner_begin(), body()
+    {
+        this->circularQueueInit();
+    }
+
+    template <typename TYPE>
+    original::circularQueue<TYPE>::circularQueue(const std::initializer_list<TYPE>& list) : circularQueue()
+    {
+        this->adjust(list.size());
+        for (const TYPE& e : list) {
+            std::construct_at(this->slot(this->size()), e);
+            this->size_ += 1;
+        }
+    }
+
+    template <typename TYPE>
+    original::circularQueue<TYPE>::circularQueue(const array<TYPE>& arr) : circularQueue()
+    {
+        this->adjust(arr.size());
+        for (uint32_t i = 0; i < arr.size(); ++i) {
+            std::construct_at(this->slot(this->size()), arr.get(i));
+            this->size_ += 1;
+        }
+    }
+
+    template <typename TYPE>
+    original::circularQueue<TYPE>::circularQueue(const iterator<TYPE>& begin, const iterator<TYPE>& end)
+        : circularQueue()
+    {
+        this->pushEnd(begin, end);
+    }
+
+    template <typename TYPE>
+    original::circularQueue<TYPE>::circularQueue(const circularQueue& other) : circularQueue()
+    {
+        this->operator=(other);
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::operator=(const circularQueue& other) -> circularQueue&
+    {
+        if (this == &other)
+            return *this;
+
+        this->circularQueueDestruct();
+        this->max_size = other.max_size;
+        this->inner_begin = 0;
+        this->size_ = 0;
+        this->body = circularQueue::circularArrayInit(this->max_size);
+        for (uint32_t i = 0; i < other.size(); ++i) {
+            std::construct_at(this->body + i, *other.slot(i));
+            this->size_ += 1;
+        }
+        return *this;
+    }
+
+    template <typename TYPE>
+    original::circularQueue<TYPE>::circularQueue(circularQueue&& other) noexcept : circularQueue()
+    {
+        this->operator=(std::move(other));
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::operator=(circularQueue&& other) noexcept -> circularQueue&
+    {
+        if (this == &other)
+            return *this;
+
+        this->circularQueueDestruct();
+        this->body = other.body;
+        this->max_size = other.max_size;
+        this->inner_begin = other.inner_begin;
+        this->size_ = other.size_;
+        other.circularQueueInit();
+        return *this;
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::size() const -> uint32_t
+    {
+        return this->size_;
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::capacity() const -> uint32_t
+    {
+        return this->max_size;
+    }
+
+    // The buffer size stays a power of two, so at least new_capacity slots are reserved.
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::reserve(const uint32_t new_capacity) -> void
+    {
+        if (new_capacity <= this->capacity())
+            return;
+
+        this->grow(roundUpSize(new_capacity));
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::shrinkToFit() -> void
+    {
+        const uint32_t new_size = roundUpSize(this->size());
+        if (new_size >= this->max_size)
+            return;
+
+        this->grow(new_size);
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::get(int64_t index) const -> TYPE
+    {
+        if (this->indexOutOfBound(index))
+        {
+            throw outOfBoundError();
+        }
+        return *this->slot(this->parseNegIndex(index));
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::operator[](int64_t index) -> TYPE&
+    {
+        if (this->indexOutOfBound(index))
+        {
+            throw outOfBoundError();
+        }
+        return *this->slot(this->parseNegIndex(index));
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::set(int64_t index, const TYPE& e) -> void
+    {
+        if (this->indexOutOfBound(index))
+        {
+            throw outOfBoundError();
+        }
+        *this->slot(this->parseNegIndex(index)) = e;
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::indexOf(const TYPE& e) const -> uint32_t
+    {
+        for (uint32_t i = 0; i < this->size(); i += 1)
+        {
+            if (*this->slot(i) == e)
+            {
+                return i;
+            }
+        }
+        return this->size();
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::pushBegin(const TYPE& e) -> void
+    {
+        this->emplaceBegin(e);
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::pushBegin(TYPE&& e) -> void
+    {
+        this->emplaceBegin(std::move(e));
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::push(const int64_t index, const TYPE& e) -> void
+    {
+        this->emplace(index, e);
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::push(const int64_t index, TYPE&& e) -> void
+    {
+        this->emplace(index, std::move(e));
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::pushEnd(const TYPE& e) -> void
+    {
+        this->emplaceEnd(e);
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::pushEnd(TYPE&& e) -> void
+    {
+        this->emplaceEnd(std::move(e));
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::pushEnd(const iterator<TYPE>& begin, const iterator<TYPE>& end) -> void
+    {
+        uint32_t len = 0;
+        auto* it = begin.clone();
+        for (; it->isValid() && !it->equal(end); it->next())
+        {
+            len += 1;
+        }
+        delete it;
+
+        this->adjust(len);
+        it = begin.clone();
+        for (uint32_t i = 0; i < len; i += 1, it->next())
+        {
+            std::construct_at(this->slot(this->size()), it->getElem());
+            this->size_ += 1;
+        }
+        delete it;
+    }
+
+    template <typename TYPE>
+    template <typename... Args>
+    auto original::circularQueue<TYPE>::emplaceBegin(Args&&... args) -> void
+    {
+        if (this->size() == this->max_size)
+        {
+            // args may refer to an element of this queue, build the new one before grow() relocates them
+            TYPE e(std::forward<Args>(args)...);
+            this->adjust(1);
+            std::construct_at(this->slot(-1), std::move(e));
+        }else
+        {
+            std::construct_at(this->slot(-1), std::forward<Args>(args)...);
+        }
+        // Only once the element exists, a throwing constructor leaves the queue as it was
+        this->inner_begin = this->toInnerIdx(-1);
+        this->size_ += 1;
+    }
+
+    // The elements on the shorter side of index shift by one slot to make room.
+    template <typename TYPE>
+    template <typename... Args>
+    auto original::circularQueue<TYPE>::emplace(int64_t index, Args&&... args) -> void
+    {
+        if (this->parseNegIndex(index) == this->size())
+        {
+            this->emplaceEnd(std::forward<Args>(args)...);
+        }else if (this->parseNegIndex(index) == 0)
+        {
+            this->emplaceBegin(std::forward<Args>(args)...);
+        }else
+        {
+            if (this->indexOutOfBound(index))
+            {
+                throw outOfBoundError();
+            }
+            TYPE e(std::forward<Args>(args)...);
+            this->adjust(1);
+            index = this->parseNegIndex(index);
+            // The range only grows once its new end slot holds an object, later steps assign to live slots.
+            if (index <= (this->size() - 1) / 2)
+            {
+                std::construct_at(this->slot(-1), std::move(*this->slot(0)));
+                this->inner_begin = this->toInnerIdx(-1);
+                this->size_ += 1;
+                for (int64_t i = 1; i < index; ++i) {
+                    *this->slot(i) = std::move(*this->slot(i + 1));
+                }
+            }else
+            {
+                std::construct_at(this->slot(this->size()), std::move(*this->slot(this->size() - 1)));
+                this->size_ += 1;
+                for (int64_t i = this->size() - 2; i > index; --i) {
+                    *this->slot(i) = std::move(*this->slot(i - 1));
+                }
+            }
+            *this->slot(index) = std::move(e);
+        }
+    }
+
+    template <typename TYPE>
+    template <typename... Args>
+    auto original::circularQueue<TYPE>::emplaceEnd(Args&&... args) -> void
+    {
+        if (this->size() == this->max_size)
+        {
+            TYPE e(std::forward<Args>(args)...);
+            this->adjust(1);
+            std::construct_at(this->slot(this->size()), std::move(e));
+        }else
+        {
+            std::construct_at(this->slot(this->size()), std::forward<Args>(args)...);
+        }
+        this->size_ += 1;
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::popBegin() -> TYPE
+    {
+        if (this->size() == 0){
+            throw noElementError();
+        }
+        TYPE* first = this->slot(0);
+        TYPE res = std::move(*first);
+        std::destroy_at(first);
+        this->inner_begin = this->toInnerIdx(1);
+        this->size_ -= 1;
+        return res;
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::pop(int64_t index) -> TYPE
+    {
+        if (this->parseNegIndex(index) == 0)
+        {
+            return this->popBegin();
+        }
+        if (this->parseNegIndex(index) == this->size() - 1)
+        {
+            return this->popEnd();
+        }
+        if (this->indexOutOfBound(index)){
+            throw outOfBoundError();
+        }
+        index = this->parseNegIndex(index);
+        TYPE res = std::move(*this->slot(index));
+        if (index <= (this->size() - 1) / 2)
+        {
+            for (int64_t i = index; i > 0; --i) {
+                *this->slot(i) = std::move(*this->slot(i - 1));
+            }
+            std::destroy_at(this->slot(0));
+            this->inner_begin = this->toInnerIdx(1);
+        }else
+        {
+            for (int64_t i = index; i < this->size() - 1; ++i) {
+                *this->slot(i) = std::move(*this->slot(i + 1));
+            }
+            std::destroy_at(this->slot(this->size() - 1));
+        }
+        this->size_ -= 1;
+        return res;
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::popEnd() -> TYPE
+    {
+        if (this->size() == 0){
+            throw noElementError();
+        }
+        TYPE* last = this->slot(this->size() - 1);
+        TYPE res = std::move(*last);
+        std::destroy_at(last);
+        this->size_ -= 1;
+        return res;
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::begins() const -> Iterator*
+    {
+        return new Iterator(0, this);
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::ends() const -> Iterator*
+    {
+        return new Iterator(static_cast<int64_t>(this->size()) - 1, this);
+    }
+
+    template <typename TYPE>
+    auto original::circularQueue<TYPE>::className() const -> std::string
+    {
+        return "circularQueue";
+    }
+
+    template <typename TYPE>
+    original::circularQueue<TYPE>::~circularQueue()
+    {
+        this->circularQueueDestruct();
+    }
+
+#endif //CIRCULARQUEUE_H
@@ -0,0 +1,242 @@
+#ifndef CONCURRENTPRIQUE_H
+#define CONCURRENTPRIQUE_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include "comparator.h"
+#include "error.h"
+#include "prique.h"
+#include "types.h"
+#include "vector.h"
+
+/**
+ * @file concurrentPrique.h
+ * @brief Priority queue shared by many producer and consumer threads.
+ */
+
+namespace original {
+
+    /**
+     * @class concurrentPrique
+     * @tparam TYPE Type of the elements
+     * @tparam Callback Comparator type, the element comparing first is popped first, as in prique
+     * @brief Relaxed priority queue made of several locked prique shards (a multi-queue).
+     * @details push() puts the element into a random shard whose lock is free. tryPop() locks
+     *          two random shards and pops the better of their two tops, so threads rarely wait
+     *          on each other and nobody serializes on a single heap.
+     *
+     *          The order is relaxed: a popped element is the best of two shards, not always the
+     *          best of the whole queue, yet it is close to it and no element is starved. With a
+     *          single shard the order is exact. tryPop() only fails when every shard was seen
+     *          empty.
+     */
+    template<typename TYPE, template <typename> typename Callback = increaseComparator>
+    requires Compare<Callback<TYPE>, TYPE>
+    class concurrentPrique {
+        static constexpr std::size_t CACHE_LINE = 64;
+
+        struct alignas(CACHE_LINE) shard {
+            mutable std::mutex mutex;
+            prique<TYPE, Callback, vector> heap;
+        };
+
+        Callback<TYPE> compare_;
+        uint32_t shards_cnt_;
+        std::unique_ptr<shard[]> shards_;
+        alignas(CACHE_LINE) std::atomic<int64_t> size_;
+
+        static uint32_t randomIndex(uint32_t bound);
+        template<typename T>
+        void pushShard(T&& e);
+        bool popAny(TYPE& e);
+    public:
+        explicit concurrentPrique(uint32_t shards = defaultShards(), const Callback<TYPE>& compare = Callback<TYPE>{});
+        concurrentPrique(const concurrentPrique& other) = delete;
+        concurrentPrique& operator=(const concurrentPrique& other) = delete;
+
+        /**
+         * @brief Number of queued elements, only a snapshot while other threads run.
+         */
+        [[nodiscard]] uint32_t size() const;
+        [[nodiscard]] bool empty() const;
+
+        void push(const TYPE& e);
+        void push(TYPE&& e);
+
+        /**
+         * @brief Pops a top priority element into e.
+         * @return false when the queue was found empty.
+         */
+        bool tryPop(TYPE& e);
+
+        /**
+         * @brief The best element over all shards at the time each one is visited.
+         * @throw noElementError if the queue is empty.
+         */
+        TYPE top() const;
+
+        /**
+         * @brief Two shards per hardware thread, so that two random picks rarely collide.
+         */
+        static uint32_t defaultShards();
+    };
+}
+
+    template <typename TYPE, template <typename> class Callback>
+    requires original::Compare<Callback<TYPE>, TYPE>
+    original::concurrentPrique<TYPE, Callback>::concurrentPrique(const uint32_t shards, const Callback<TYPE>& compare)
+        : compare_(compare), shards_cnt_(shards), shards_(), size_(0)
+    {
+        if (shards == 0)
+            throw valueError();
+        this->shards_ = std::make_unique<shard[]>(shards);
+        for (uint32_t i = 0; i < shards; ++i) {
+            this->shards_[i].heap = prique<TYPE, Callback, vector>(vector<TYPE>{}, compare);
+        }
+    }
+
+    // Per thread xorshift generator, the picks only need to spread threads over the shards.
+    template <typename TYPE, template <typename> class Callback>
+    requires original::Compare<Callback<TYPE>, TYPE>
+    auto original::concurrentPrique<TYPE, Callback>::randomIndex(const uint32_t bound) -> uint32_t
+    {
+        thread_local uint64_t state = std::hash<std::thread::id>{}(std::this_thread::get_id()) | 1;
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return static_cast<uint32_t>(((state >> 32) * bound) >> 32);
+    }
+
+    template <typename TYPE, template <typename> class Callback>
+    requires original::Compare<Callback<TYPE>, TYPE>
+    template <typename T>
+    auto original::concurrentPrique<TYPE, Callback>::pushShard(T&& e) -> void
+    {
+        uint32_t idx = randomIndex(this->shards_cnt_);
+        for (uint32_t attempt = 0; attempt < this->shards_cnt_; ++attempt) {
+            if (this->shards_[idx].mutex.try_lock()) {
+                std::lock_guard lock(this->shards_[idx].mutex, std::adopt_lock);
+                this->shards_[idx].heap.push(std::forward<T>(e));
+                this->size_.fetch_add(1, std::memory_order_release);
+                return;
+            }
+            idx = randomIndex(this->shards_cnt_);
+        }
+        std::lock_guard lock(this->shards_[idx].mutex);
+        this->shards_[idx].heap.push(std::forward<T>(e));
+        this->size_.fetch_add(1, std::memory_order_release);
+    }
+
+    // Fallback of tryPop(): pops the top of the first non empty shard, starting at a random one.
+    template <typename TYPE, template <typename> class Callback>
+    requires original::Compare<Callback<TYPE>, TYPE>
+    auto original::concurrentPrique<TYPE, Callback>::popAny(TYPE& e) -> bool
+    {
+        const uint32_t start = randomIndex(this->shards_cnt_);
+        for (uint32_t i = 0; i < this->shards_cnt_; ++i) {
+            shard& cur = this->shards_[(start + i) % this->shards_cnt_];
+            std::lock_guard lock(cur.mutex);
+            if (!cur.heap.empty()) {
+                e = cur.heap.pop();
+                this->size_.fetch_sub(1, std::memory_order_release);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template <typename TYPE, template <typename> class Callback>
+    requires original::Compare<Callback<TYPE>, TYPE>
+    auto original::concurrentPrique<TYPE, Callback>::size() const -> uint32_t
+    {
+        return std::max<int64_t>(this->size_.load(std::memory_order_acquire), 0);
+    }
+
+    template <typename TYPE, template <typename> class Callback>
+    requires original::Compare<Callback<TYPE>, TYPE>
+    auto original::concurrentPrique<TYPE, Callback>::empty() const -> bool
+    {
+        return this->size() == 0;
+    }
+
+    template <typename TYPE, template <typename> class Callback>
+    requires original::Compare<Callback<TYPE>, TYPE>
+    auto original::concurrentPrique<TYPE, Callback>::push(const TYPE& e) -> void
+    {
+        this->pushShard(e);
+    }
+
+    template <typename TYPE, template <typename> class Callback>
+    requires original::Compare<Callback<TYPE>, TYPE>
+    auto original::concurrentPrique<TYPE, Callback>::push(TYPE&& e) -> void
+    {
+        this->pushShard(std::move(e));
+    }
+
+    template <typename TYPE, template <typename> class Callback>
+    requires original::Compare<Callback<TYPE>, TYPE>
+    auto original::concurrentPrique<TYPE, Callback>::tryPop(TYPE& e) -> bool
+    {
+        for (uint32_t attempt = 0; attempt < this->shards_cnt_; ++attempt) {
+            if (this->size_.load(std::memory_order_acquire) <= 0)
+                break;
+            shard& first = this->shards_[randomIndex(this->shards_cnt_)];
+            shard& second = this->shards_[randomIndex(this->shards_cnt_)];
+            if (&first == &second) {
+                if (!first.mutex.try_lock())
+                    continue;
+            } else if (std::try_lock(first.mutex, second.mutex) != -1) {
+                continue;
+            }
+
+            shard* best = nullptr;
+            if (!first.heap.empty())
+                best = &first;
+            if (&first != &second && !second.heap.empty()
+                && (best == nullptr || this->compare_(second.heap.top(), best->heap.top())))
+                best = &second;
+            if (best != nullptr) {
+                e = best->heap.pop();
+                this->size_.fetch_sub(1, std::memory_order_release);
+            }
+            first.mutex.unlock();
+            if (&first != &second)
+                second.mutex.unlock();
+            if (best != nullptr)
+                return true;
+        }
+        return this->popAny(e);
+    }
+
+    template <typename TYPE, template <typename> class Callback>
+    requires original::Compare<Callback<TYPE>, TYPE>
+    auto original::concurrentPrique<TYPE, Callback>::top() const -> TYPE
+    {
+        std::optional<TYPE> res;
+        for (uint32_t i = 0; i < this->shards_cnt_; ++i) {
+            std::lock_guard lock(this->shards_[i].mutex);
+            if (this->shards_[i].heap.empty())
+                continue;
+            TYPE cur = this->shards_[i].heap.top();
+            if (!res || this->compare_(cur, *res))
+                res.emplace(std::move(cur));
+        }
+        if (!res)
+            throw noElementError();
+        return std::move(*res);
+    }
+
+    template <typename TYPE, template <typename> class Callback>
+    requires original::Compare<Callback<TYPE>, TYPE>
+    auto original::concurrentPrique<TYPE, Callback>::defaultShards() -> uint32_t
+    {
+        return std::max(std::thread::hardware_concurrency(), 1u) * 2;
+    }
+
+#endif //CONCURRENTPRIQUE_H
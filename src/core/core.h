@@ -14,22 +14,28 @@
  * accessing core components of the library.
  */
 
+#include "addressablePrique.h"
 #include "algorithms.h"
+#include "allocator.h"
 #include "array.h"
 #include "baseArray.h"
 #include "baseList.h"
+#include "bitKernels.h"
 #include "bitSet.h"
 #include "blocksList.h"
 #include "chain.h"
+#include "circularQueue.h"
 #include "cloneable.h"
 #include "comparable.h"
 #include "comparator.h"
+#include "concurrentPrique.h"
 #include "container.h"
 #include "containerAdapter.h"
 #include "couple.h"
 #include "deque.h"
 #include "doubleDirectionIterator.h"
 #include "error.h"
+#include "execution.h"
 #include "filter.h"
 #include "filterStream.h"
 #include "forwardChain.h"
@@ -37,14 +43,22 @@
 #include "iterationStream.h"
 #include "iterator.h"
 #include "maths.h"
+#include "mpmcQueue.h"
 #include "printable.h"
 #include "prique.h"
 #include "queue.h"
 #include "randomAccessIterator.h"
+#include "rankSelect.h"
+#include "roaringBitmap.h"
+#include "ropeList.h"
 #include "serial.h"
 #include "singleDirectionIterator.h"
+#include "smallVector.h"
+#include "span.h"
+#include "spscQueue.h"
 #include "stack.h"
 #include "stepIterator.h"
+#include "threadPool.h"
 #include "transform.h"
 #include "transformStream.h"
 #include "types.h"
@@ -5,7 +5,7 @@
 #include "containerAdapter.h"
 
 namespace original{
-    template<typename TYPE, template <typename> typename SERIAL = chain>
+    template<typename TYPE, template <typename> typename SERIAL = defaultChain>
     class deque final : public containerAdapter<TYPE, SERIAL>{
     public:
         explicit deque(const SERIAL<TYPE>& serial = SERIAL<TYPE>{});
@@ -16,7 +16,13 @@ namespace original{
         deque(deque&& other) noexcept;
         deque& operator=(deque&& other) noexcept;
         void pushBegin(const TYPE &e);
+        void pushBegin(TYPE &&e);
         void pushEnd(const TYPE &e);
+        void pushEnd(TYPE &&e);
+        template<typename... Args>
+        void emplaceBegin(Args&&... args);
+        template<typename... Args>
+        void emplaceEnd(Args&&... args);
         TYPE popBegin();
         TYPE popEnd();
         TYPE head() const;
@@ -77,6 +83,28 @@ namespace original{
         this->serial_.pushEnd(e);
     }
 
+    template<typename TYPE, template <typename> typename SERIAL>
+    auto original::deque<TYPE, SERIAL>::pushBegin(TYPE &&e) -> void {
+        this->serial_.pushBegin(std::move(e));
+    }
+
+    template<typename TYPE, template <typename> typename SERIAL>
+    auto original::deque<TYPE, SERIAL>::pushEnd(TYPE &&e) -> void {
+        this->serial_.pushEnd(std::move(e));
+    }
+
+    template<typename TYPE, template <typename> typename SERIAL>
+    template<typename... Args>
+    auto original::deque<TYPE, SERIAL>::emplaceBegin(Args&&... args) -> void {
+        this->serial_.emplaceBegin(std::forward<Args>(args)...);
+    }
+
+    template<typename TYPE, template <typename> typename SERIAL>
+    template<typename... Args>
+    auto original::deque<TYPE, SERIAL>::emplaceEnd(Args&&... args) -> void {
+        this->serial_.emplaceEnd(std::forward<Args>(args)...);
+    }
+
     template<typename TYPE, template <typename> typename SERIAL>
     auto original::deque<TYPE, SERIAL>::popBegin() -> TYPE {
         return this->serial_.popBegin();
@@ -0,0 +1,62 @@
+#ifndef EXECUTION_H
+#define EXECUTION_H
+
+#include <concepts>
+#include <type_traits>
+
+/**
+ * @file execution.h
+ * @brief Execution policy tags for the algorithms overloads.
+ * @details A policy passed as the first argument of an algorithm selects how it runs:
+ *          sequentially, split over the shared thread pool, or split over the pool with
+ *          each chunk free to be vectorized. Policies only apply to contiguous ranges,
+ *          other ranges always run sequentially.
+ */
+
+namespace original::execution {
+
+    /**
+     * @class sequencedPolicy
+     * @brief Runs the algorithm on the calling thread, in order.
+     */
+    class sequencedPolicy {};
+
+    /**
+     * @class parallelPolicy
+     * @brief Splits the range into chunks processed concurrently by the thread pool.
+     */
+    class parallelPolicy {};
+
+    /**
+     * @class parallelUnsequencedPolicy
+     * @brief Like parallelPolicy, and element accesses inside a chunk may also be interleaved.
+     */
+    class parallelUnsequencedPolicy {};
+
+    inline constexpr sequencedPolicy seq{};
+    inline constexpr parallelPolicy par{};
+    inline constexpr parallelUnsequencedPolicy parUnseq{};
+}
+
+namespace original {
+
+    /**
+     * @concept ExecutionPolicy
+     * @brief Satisfied by the policy tags of original::execution.
+     */
+    template <typename Policy>
+    concept ExecutionPolicy =
+        std::same_as<std::remove_cvref_t<Policy>, execution::sequencedPolicy> ||
+        std::same_as<std::remove_cvref_t<Policy>, execution::parallelPolicy> ||
+        std::same_as<std::remove_cvref_t<Policy>, execution::parallelUnsequencedPolicy>;
+
+    /**
+     * @concept ParallelPolicy
+     * @brief Satisfied by the policies that may run on several threads.
+     */
+    template <typename Policy>
+    concept ParallelPolicy =
+        ExecutionPolicy<Policy> && !std::same_as<std::remove_cvref_t<Policy>, execution::sequencedPolicy>;
+}
+
+#endif //EXECUTION_H
@@ -1,22 +1,28 @@
 #ifndef FORWARDCHAIN_H
 #define FORWARDCHAIN_H
 
+#include <utility>
 #include "singleDirectionIterator.h"
 #include "array.h"
 #include "baseList.h"
+#include "allocator.h"
 
 namespace original {
-    template <typename TYPE>
-    class forwardChain final : public baseList<TYPE>, public iterationStream<TYPE, forwardChain<TYPE>>{
+    template <typename TYPE, typename ALLOC = allocator<TYPE>>
+    class forwardChain final : public baseList<TYPE>, public iterationStream<TYPE, forwardChain<TYPE, ALLOC>>{
         class forwardChainNode final : public wrapper<TYPE>{
             public:
                 friend class iterator<TYPE>;
                 friend class forwardChain;
+                friend class fastNodeIterator<forwardChainNode, TYPE>;
+                friend class fastNodeIterator<const forwardChainNode, const TYPE>;
             private:
                 TYPE data_;
                 forwardChainNode* next;
             protected:
                 explicit forwardChainNode(const TYPE& data = TYPE{}, forwardChainNode* next = nullptr);
+                template<typename... Args>
+                explicit forwardChainNode(std::in_place_t, Args&&... args);
                 forwardChainNode(const forwardChainNode& other);
                 forwardChainNode& operator=(const forwardChainNode& other);
                 TYPE& getVal() override;
@@ -30,14 +36,31 @@ namespace original {
 
         uint32_t size_;
         forwardChainNode* begin_;
+        // Node of the last non-const indexed access, walks to a later index start from it instead of
+        // the head. Const lookups only read it, so they can run concurrently.
+        forwardChainNode* finger_;
+        uint32_t finger_pos_;
+
+        typename ALLOC::template rebind_alloc<forwardChainNode> allocator_;
 
+        template<typename... Args>
+        forwardChainNode* createNode(Args&&... args);
+        void destroyNode(forwardChainNode* node);
         forwardChainNode* beginNode() const;
         forwardChainNode* findNode(int64_t index) const;
+        forwardChainNode* findNode(int64_t index);
+        forwardChainNode* nodeBefore(int64_t index) const;
+        void linkRange(int64_t index, forwardChainNode* first, forwardChainNode* last, uint32_t count);
+        void moveElements(forwardChainNode* first, uint32_t count,
+                          forwardChainNode*& new_first, forwardChainNode*& new_last);
         void chainInit();
         void firstAdd(forwardChainNode* node);
         forwardChainNode* lastDelete();
         void chainDestruction();
     public:
+        using FastIterator = fastNodeIterator<forwardChainNode, TYPE>;
+        using ConstFastIterator = fastNodeIterator<const forwardChainNode, const TYPE>;
+
         class Iterator final : public singleDirectionIterator<TYPE>
         {
             explicit Iterator(forwardChainNode* ptr);
@@ -52,40 +75,70 @@ namespace original {
         };
 
         explicit forwardChain();
+        explicit forwardChain(const ALLOC& alloc);
         forwardChain(const forwardChain& other);
         forwardChain(std::initializer_list<TYPE> list);
         explicit forwardChain(const array<TYPE>& arr);
         forwardChain& operator=(const forwardChain& other);
         forwardChain(forwardChain&& other) noexcept;
         forwardChain& operator=(forwardChain&& other) noexcept;
+        void operator+=(forwardChain& other);
+        void splice(int64_t index, forwardChain& other);
+        void splice(int64_t index, forwardChain& other, int64_t first, int64_t last);
+        void concat(forwardChain& other);
+        forwardChain split(int64_t index);
         [[nodiscard]] uint32_t size() const override;
         TYPE get(int64_t index) const override;
+        TYPE get(int64_t index);
         TYPE& operator[](int64_t index) override;
         void set(int64_t index, const TYPE &e) override;
         uint32_t indexOf(const TYPE &e) const override;
         void pushBegin(const TYPE &e) override;
+        void pushBegin(TYPE &&e) override;
         void push(int64_t index, const TYPE &e) override;
+        void push(int64_t index, TYPE &&e) override;
         void pushEnd(const TYPE &e) override;
+        void pushEnd(TYPE &&e) override;
+        template<typename... Args>
+        void emplace(int64_t index, Args&&... args);
+        template<typename... Args>
+        void emplaceBegin(Args&&... args);
+        template<typename... Args>
+        void emplaceEnd(Args&&... args);
         TYPE popBegin() override;
         TYPE pop(int64_t index) override;
         TYPE popEnd() override;
+        FastIterator fastBegin();
+        FastIterator fastEnd();
+        ConstFastIterator fastBegin() const;
+        ConstFastIterator fastEnd() const;
         Iterator* begins() const override;
         Iterator* ends() const override;
         [[nodiscard]] std::string className() const override;
         ~forwardChain() override;
     };
-}
 
+    // forwardChain with its default allocator as a single parameter template, which the container adapters
+    // accept as their list also on compilers without relaxed template template argument matching.
     template <typename TYPE>
-    original::forwardChain<TYPE>::forwardChainNode::forwardChainNode(const TYPE& data, forwardChainNode* next)
+    using defaultForwardChain = forwardChain<TYPE>;
+}
+
+    template <typename TYPE, typename ALLOC>
+    original::forwardChain<TYPE, ALLOC>::forwardChainNode::forwardChainNode(const TYPE& data, forwardChainNode* next)
         : data_(data), next(next) {}
 
-    template<typename TYPE>
-    original::forwardChain<TYPE>::forwardChainNode::forwardChainNode(const forwardChainNode &other)
+    template <typename TYPE, typename ALLOC>
+    template <typename... Args>
+    original::forwardChain<TYPE, ALLOC>::forwardChainNode::forwardChainNode(std::in_place_t, Args&&... args)
+        : data_(std::forward<Args>(args)...), next(nullptr) {}
+
+    template <typename TYPE, typename ALLOC>
+    original::forwardChain<TYPE, ALLOC>::forwardChainNode::forwardChainNode(const forwardChainNode &other)
         : data_(other.data_), next(other.next) {}
 
-    template<typename TYPE>
-    auto original::forwardChain<TYPE>::forwardChainNode::operator=(
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::forwardChainNode::operator=(
         const forwardChainNode &other) -> forwardChainNode & {
         if (this != &other) {
             data_ = other.data_;
@@ -94,149 +147,242 @@ namespace original {
         return *this;
     }
 
-    template<typename TYPE>
-    auto original::forwardChain<TYPE>::forwardChainNode::getVal() -> TYPE& {
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::forwardChainNode::getVal() -> TYPE& {
         return this->data_;
     }
 
-    template<typename TYPE>
-    auto original::forwardChain<TYPE>::forwardChainNode::getVal() const -> const TYPE& {
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::forwardChainNode::getVal() const -> const TYPE& {
         return this->data_;
     }
 
-    template<typename TYPE>
-    auto original::forwardChain<TYPE>::forwardChainNode::setVal(TYPE data) -> void {
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::forwardChainNode::setVal(TYPE data) -> void {
         this->data_ = data;
     }
 
-    template<typename TYPE>
-    auto original::forwardChain<TYPE>::forwardChainNode::getPPrev() const -> forwardChainNode* {
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::forwardChainNode::getPPrev() const -> forwardChainNode* {
         throw unSupportedMethodError();
     }
 
-    template<typename TYPE>
-    auto original::forwardChain<TYPE>::forwardChainNode::getPNext() const -> forwardChainNode* {
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::forwardChainNode::getPNext() const -> forwardChainNode* {
         return this->next;
     }
 
-    template<typename TYPE>
-    auto original::forwardChain<TYPE>::forwardChainNode::setPNext(forwardChainNode *new_next) -> void {
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::forwardChainNode::setPNext(forwardChainNode *new_next) -> void {
         this->next = new_next;
     }
 
-    template<typename TYPE>
-    auto original::forwardChain<TYPE>::forwardChainNode::connect(
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::forwardChainNode::connect(
         forwardChainNode *prev, forwardChainNode *next) -> void {
         if (prev != nullptr) prev->setPNext(next);
     }
 
-    template <typename TYPE>
-    auto original::forwardChain<TYPE>::beginNode() const -> forwardChainNode*
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::beginNode() const -> forwardChainNode*
     {
         return this->begin_->getPNext();
     }
 
-    template<typename TYPE>
-    auto original::forwardChain<TYPE>::findNode(const int64_t index) const -> forwardChainNode* {
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::findNode(const int64_t index) const -> forwardChainNode* {
         if (this->size() == 0) return this->begin_;
         auto* cur = this->beginNode();
-        for(uint32_t i = 0; i < index; i++)
-        {
+        int64_t pos = 0;
+        if (this->finger_ != nullptr && this->finger_pos_ <= index){
+            cur = this->finger_;
+            pos = this->finger_pos_;
+        }
+        for (; pos < index; pos += 1){
             cur = cur->getPNext();
         }
         return cur;
     }
 
-    template <typename TYPE>
-    auto original::forwardChain<TYPE>::chainInit() -> void
+    // Same lookup, leaving the finger on the found node.
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::findNode(const int64_t index) -> forwardChainNode* {
+        auto* cur = std::as_const(*this).findNode(index);
+        if (this->size() != 0){
+            this->finger_ = cur;
+            this->finger_pos_ = index;
+        }
+        return cur;
+    }
+
+    // The pivot for index 0, so that every position has a node to link after.
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::nodeBefore(const int64_t index) const -> forwardChainNode*
+    {
+        return index == 0 ? this->begin_ : this->findNode(index - 1);
+    }
+
+    // Links the count nodes from first to last in front of the element at index, and leaves the finger on last.
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::linkRange(const int64_t index, forwardChainNode* first,
+                                                        forwardChainNode* last, const uint32_t count) -> void
+    {
+        auto* prev = this->nodeBefore(index);
+        forwardChainNode::connect(last, prev->getPNext());
+        forwardChainNode::connect(prev, first);
+        this->size_ += count;
+        this->finger_ = last;
+        this->finger_pos_ = index + count - 1;
+    }
+
+    // Builds count detached nodes of this chain holding the elements moved out of the nodes from first on.
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::moveElements(forwardChainNode* first, const uint32_t count,
+                                                           forwardChainNode*& new_first,
+                                                           forwardChainNode*& new_last) -> void
+    {
+        new_first = nullptr;
+        new_last = nullptr;
+        try {
+            for (uint32_t i = 0; i < count; i += 1){
+                auto* node = this->createNode(std::in_place, std::move(first->getVal()));
+                if (new_first == nullptr){
+                    new_first = node;
+                } else{
+                    forwardChainNode::connect(new_last, node);
+                }
+                new_last = node;
+                first = first->getPNext();
+            }
+        } catch (...) {
+            while (new_first != nullptr){
+                auto* next = new_first->getPNext();
+                this->destroyNode(new_first);
+                new_first = next;
+            }
+            throw;
+        }
+    }
+
+    template <typename TYPE, typename ALLOC>
+    template <typename... Args>
+    auto original::forwardChain<TYPE, ALLOC>::createNode(Args&&... args) -> forwardChainNode*
+    {
+        auto* node = this->allocator_.allocate(1);
+        try {
+            return new (node) forwardChainNode(std::forward<Args>(args)...);
+        } catch (...) {
+            this->allocator_.deallocate(node, 1);
+            throw;
+        }
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::destroyNode(forwardChainNode* node) -> void
+    {
+        node->~forwardChainNode();
+        this->allocator_.deallocate(node, 1);
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::chainInit() -> void
     {
-        auto* pivot = new forwardChainNode();
+        auto* pivot = this->createNode();
         this->size_ = 0;
         this->begin_ = pivot;
+        this->finger_ = nullptr;
+        this->finger_pos_ = 0;
     }
 
-    template <typename TYPE>
-    auto original::forwardChain<TYPE>::firstAdd(forwardChainNode* node) -> void
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::firstAdd(forwardChainNode* node) -> void
     {
         forwardChainNode::connect(this->findNode(0), node);
         this->size_ += 1;
     }
 
-    template <typename TYPE>
-    auto original::forwardChain<TYPE>::lastDelete() -> forwardChainNode*
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::lastDelete() -> forwardChainNode*
     {
         auto* last = this->beginNode();
-        delete this->begin_;
+        this->destroyNode(this->begin_);
         this->chainInit();
         return last;
     }
 
-    template <typename TYPE>
-    auto original::forwardChain<TYPE>::chainDestruction() -> void
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::chainDestruction() -> void
     {
         auto* cur = this->begin_;
         while (cur)
         {
             auto* next = cur->getPNext();
-            delete cur;
+            this->destroyNode(cur);
             cur = next;
         }
     }
 
-    template<typename TYPE>
-    original::forwardChain<TYPE>::Iterator::Iterator(forwardChainNode *ptr)
+    template <typename TYPE, typename ALLOC>
+    original::forwardChain<TYPE, ALLOC>::Iterator::Iterator(forwardChainNode *ptr)
         : singleDirectionIterator<TYPE>(ptr) {}
 
-    template<typename TYPE>
-    original::forwardChain<TYPE>::Iterator::Iterator(const Iterator &other)
+    template <typename TYPE, typename ALLOC>
+    original::forwardChain<TYPE, ALLOC>::Iterator::Iterator(const Iterator &other)
         : singleDirectionIterator<TYPE>(nullptr) {
         this->operator=(other);
     }
 
-    template<typename TYPE>
-    auto original::forwardChain<TYPE>::Iterator::operator=(const Iterator &other) -> Iterator & {
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::Iterator::operator=(const Iterator &other) -> Iterator & {
         if (this == &other) return *this;
         singleDirectionIterator<TYPE>::operator=(other);
         return *this;
     }
 
-    template<typename TYPE>
-    auto original::forwardChain<TYPE>::Iterator::clone() const -> Iterator* {
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::Iterator::clone() const -> Iterator* {
         return new Iterator(*this);
     }
 
-    template<typename TYPE>
-    auto original::forwardChain<TYPE>::Iterator::atPrev(const iterator<TYPE> *other) const -> bool {
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::Iterator::atPrev(const iterator<TYPE> *other) const -> bool {
         auto other_it = dynamic_cast<const Iterator*>(other);
         return other_it != nullptr && this->_ptr->getPNext() == other_it->_ptr;
     }
 
-    template<typename TYPE>
-    auto original::forwardChain<TYPE>::Iterator::atNext(const iterator<TYPE> *other) const -> bool {
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::Iterator::atNext(const iterator<TYPE> *other) const -> bool {
         auto other_it = dynamic_cast<const Iterator*>(other);
         return other_it != nullptr && other_it->_ptr->getPNext() == this->_ptr;
     }
 
-    template<typename TYPE>
-    auto original::forwardChain<TYPE>::Iterator::className() const -> std::string {
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::Iterator::className() const -> std::string {
         return "forwardChain::Iterator";
     }
 
-    template<typename TYPE>
-    original::forwardChain<TYPE>::forwardChain() : size_(0)
+    template <typename TYPE, typename ALLOC>
+    original::forwardChain<TYPE, ALLOC>::forwardChain() : size_(0)
+    {
+        this->chainInit();
+    }
+
+    // Lists constructed from copies of one allocator share its pool and splice in O(1).
+    template <typename TYPE, typename ALLOC>
+    original::forwardChain<TYPE, ALLOC>::forwardChain(const ALLOC& alloc) : size_(0), allocator_(alloc)
     {
         this->chainInit();
     }
 
-    template<typename TYPE>
-    original::forwardChain<TYPE>::forwardChain(const forwardChain &other) : forwardChain() {
+    template <typename TYPE, typename ALLOC>
+    original::forwardChain<TYPE, ALLOC>::forwardChain(const forwardChain &other) : forwardChain() {
         this->operator=(other);
     }
 
-    template<typename TYPE>
-    original::forwardChain<TYPE>::forwardChain(std::initializer_list<TYPE> list) : forwardChain() {
+    template <typename TYPE, typename ALLOC>
+    original::forwardChain<TYPE, ALLOC>::forwardChain(std::initializer_list<TYPE> list) : forwardChain() {
         for (auto e: list) {
-            auto* cur_node = new forwardChainNode(e);
+            auto* cur_node = this->createNode(e);
             if (this->size() == 0)
             {
                 this->firstAdd(cur_node);
@@ -249,10 +395,10 @@ namespace original {
         }
     }
 
-    template<typename TYPE>
-    original::forwardChain<TYPE>::forwardChain(const array<TYPE>& arr) : forwardChain() {
+    template <typename TYPE, typename ALLOC>
+    original::forwardChain<TYPE, ALLOC>::forwardChain(const array<TYPE>& arr) : forwardChain() {
         for (uint32_t i = 0; i < arr.size(); i++) {
-            auto* cur_node = new forwardChainNode(arr.get(i));
+            auto* cur_node = this->createNode(arr.get(i));
             if (this->size() == 0)
             {
                 this->firstAdd(cur_node);
@@ -265,50 +411,134 @@ namespace original {
         }
     }
 
-    template<typename TYPE>
-    auto original::forwardChain<TYPE>::operator=(const forwardChain &other) -> forwardChain& {
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::operator=(const forwardChain &other) -> forwardChain& {
         if (this == &other) return *this;
         this->chainDestruction();
         this->size_ = other.size_;
         if (this->size() != 0){
             auto* other_ = other.begin_;
-            this->begin_ = new forwardChainNode(other_->getVal());
+            this->begin_ = this->createNode(other_->getVal());
             auto* this_ = this->begin_;
             while (other_->getPNext() != nullptr){
                 other_ = other_->getPNext();
-                forwardChainNode::connect(this_, new forwardChainNode(other_->getVal()));
+                forwardChainNode::connect(this_, this->createNode(other_->getVal()));
                 this_ = this_->getPNext();
             }
+            this->finger_ = nullptr;
         } else{
             this->chainInit();
         }
         return *this;
     }
 
-    template<typename TYPE>
-    original::forwardChain<TYPE>::forwardChain(forwardChain &&other) noexcept : forwardChain() {
+    template <typename TYPE, typename ALLOC>
+    original::forwardChain<TYPE, ALLOC>::forwardChain(forwardChain &&other) noexcept : forwardChain() {
         this->operator=(std::move(other));
     }
 
-    template<typename TYPE>
-    original::forwardChain<TYPE> & original::forwardChain<TYPE>::operator=(forwardChain &&other) noexcept {
+    template <typename TYPE, typename ALLOC>
+    original::forwardChain<TYPE, ALLOC> & original::forwardChain<TYPE, ALLOC>::operator=(forwardChain &&other) noexcept {
         if (this == &other)
             return *this;
 
         this->chainDestruction();
+        std::swap(this->allocator_, other.allocator_);
         this->begin_ = other.begin_;
         this->size_ = other.size_;
+        this->finger_ = other.finger_;
+        this->finger_pos_ = other.finger_pos_;
         other.chainInit();
         return *this;
     }
 
-    template<typename TYPE>
-    auto original::forwardChain<TYPE>::size() const -> uint32_t {
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::operator+=(forwardChain& other) -> void {
+        this->concat(other);
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::splice(const int64_t index, forwardChain& other) -> void {
+        this->splice(index, other, 0, other.size());
+    }
+
+    // Moves the nodes of other in [first, last) in front of the element at index. Without a tail
+    // node, finding the last moved node walks from the first one, or from the finger of other.
+    // Nodes are relinked when the allocators of both chains compare equal, otherwise the elements
+    // are moved into new nodes.
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::splice(int64_t index, forwardChain& other,
+                                                     int64_t first, int64_t last) -> void {
+        if (this == &other) throw valueError();
+        index = this->parseNegIndex(index);
+        first = other.parseNegIndex(first);
+        last = other.parseNegIndex(last);
+        if (index < 0 || index > this->size() || first < 0 || first > last || last > other.size()){
+            throw outOfBoundError();
+        }
+        if (first == last) return;
+
+        const uint32_t count = last - first;
+        auto* prev = other.nodeBefore(first);
+        auto* first_node = prev->getPNext();
+        auto* last_node = other.findNode(last - 1);
+        auto* new_first = first_node;
+        auto* new_last = last_node;
+        const bool relink = this->allocator_ == other.allocator_;
+        if (!relink)
+            this->moveElements(first_node, count, new_first, new_last);
+        forwardChainNode::connect(prev, last_node->getPNext());
+        other.size_ -= count;
+        other.finger_ = first == 0 ? nullptr : prev;
+        other.finger_pos_ = first == 0 ? 0 : first - 1;
+
+        if (!relink){
+            last_node->setPNext(nullptr);
+            while (first_node != nullptr){
+                auto* next = first_node->getPNext();
+                other.destroyNode(first_node);
+                first_node = next;
+            }
+        }
+        this->linkRange(index, new_first, new_last, count);
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::concat(forwardChain& other) -> void {
+        this->splice(this->size(), other);
+    }
+
+    // Cuts the chain before index and returns the elements from index on as a new chain.
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::split(int64_t index) -> forwardChain {
+        index = this->parseNegIndex(index);
+        if (index < 0 || index > this->size()){
+            throw outOfBoundError();
+        }
+        forwardChain tail;
+        if (index == this->size()) return tail;
+        if (!(tail.allocator_ == this->allocator_)){
+            tail.splice(0, *this, index, this->size());
+            return tail;
+        }
+
+        // Everything after prev moves, so unlike splice there is no last node to look for.
+        auto* prev = this->nodeBefore(index);
+        forwardChainNode::connect(tail.begin_, prev->getPNext());
+        forwardChainNode::connect(prev, nullptr);
+        tail.size_ = this->size() - index;
+        this->size_ = index;
+        if (this->finger_pos_ >= index) this->finger_ = nullptr;
+        return tail;
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::size() const -> uint32_t {
         return this->size_;
     }
 
-    template<typename TYPE>
-    auto original::forwardChain<TYPE>::get(int64_t index) const -> TYPE {
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::get(int64_t index) const -> TYPE {
         if (this->indexOutOfBound(index)){
             throw outOfBoundError();
         }
@@ -316,8 +546,9 @@ namespace original {
         return cur->getVal();
     }
 
-    template<typename TYPE>
-    auto original::forwardChain<TYPE>::operator[](int64_t index) -> TYPE& {
+    // Unlike the const overload, moves the finger, which makes scanning by index linear.
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::get(int64_t index) -> TYPE {
         if (this->indexOutOfBound(index)){
             throw outOfBoundError();
         }
@@ -325,8 +556,17 @@ namespace original {
         return cur->getVal();
     }
 
-    template<typename TYPE>
-    auto original::forwardChain<TYPE>::set(int64_t index, const TYPE &e) -> void {
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::operator[](int64_t index) -> TYPE& {
+        if (this->indexOutOfBound(index)){
+            throw outOfBoundError();
+        }
+        auto* cur = this->findNode(this->parseNegIndex(index));
+        return cur->getVal();
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::set(int64_t index, const TYPE &e) -> void {
         if (this->indexOutOfBound(index)){
             throw outOfBoundError();
         }
@@ -334,8 +574,8 @@ namespace original {
         cur->setVal(e);
     }
 
-    template<typename TYPE>
-    auto original::forwardChain<TYPE>::indexOf(const TYPE &e) const -> uint32_t {
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::indexOf(const TYPE &e) const -> uint32_t {
         uint32_t i = 0;
         for (auto* current = this->begin_; current != nullptr; current = current->getPNext()) {
             if (current->getVal() == e) {
@@ -346,9 +586,40 @@ namespace original {
         return this->size();
     }
 
-    template<typename TYPE>
-    auto original::forwardChain<TYPE>::pushBegin(const TYPE &e) -> void {
-        auto* new_node = new forwardChainNode(e);
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::pushBegin(const TYPE &e) -> void {
+        this->emplaceBegin(e);
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::pushBegin(TYPE &&e) -> void {
+        this->emplaceBegin(std::move(e));
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::push(const int64_t index, const TYPE &e) -> void {
+        this->emplace(index, e);
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::push(const int64_t index, TYPE &&e) -> void {
+        this->emplace(index, std::move(e));
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::pushEnd(const TYPE &e) -> void {
+        this->emplaceEnd(e);
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::pushEnd(TYPE &&e) -> void {
+        this->emplaceEnd(std::move(e));
+    }
+
+    template <typename TYPE, typename ALLOC>
+    template<typename... Args>
+    auto original::forwardChain<TYPE, ALLOC>::emplaceBegin(Args&&... args) -> void {
+        auto* new_node = this->createNode(std::in_place, std::forward<Args>(args)...);
         if (this->size() == 0){
             this->firstAdd(new_node);
         } else{
@@ -356,21 +627,23 @@ namespace original {
             forwardChainNode::connect(this->begin_, new_node);
             forwardChainNode::connect(new_node, next);
             this->size_ += 1;
+            this->finger_pos_ += 1;
         }
     }
 
-    template<typename TYPE>
-    auto original::forwardChain<TYPE>::push(int64_t index, const TYPE &e) -> void {
+    template <typename TYPE, typename ALLOC>
+    template<typename... Args>
+    auto original::forwardChain<TYPE, ALLOC>::emplace(int64_t index, Args&&... args) -> void {
         index = this->parseNegIndex(index);
         if (index == 0){
-            this->pushBegin(e);
+            this->emplaceBegin(std::forward<Args>(args)...);
         } else if (index == this->size()){
-            this->pushEnd(e);
+            this->emplaceEnd(std::forward<Args>(args)...);
         } else{
             if (this->indexOutOfBound(index)){
                 throw outOfBoundError();
             }
-            auto* new_node = new forwardChainNode(e);
+            auto* new_node = this->createNode(std::in_place, std::forward<Args>(args)...);
             auto* prev = this->findNode(index - 1);
             auto* cur = prev->getPNext();
             forwardChainNode::connect(prev, new_node);
@@ -379,40 +652,47 @@ namespace original {
         }
     }
 
-    template<typename TYPE>
-    auto original::forwardChain<TYPE>::pushEnd(const TYPE &e) -> void {
-        auto* new_node = new forwardChainNode(e);
+    template <typename TYPE, typename ALLOC>
+    template<typename... Args>
+    auto original::forwardChain<TYPE, ALLOC>::emplaceEnd(Args&&... args) -> void {
+        auto* new_node = this->createNode(std::in_place, std::forward<Args>(args)...);
         if (this->size() == 0){
             this->firstAdd(new_node);
         } else{
             auto* end = this->findNode(this->size() - 1);
             forwardChainNode::connect(end, new_node);
             this->size_ += 1;
+            this->finger_ = new_node;
+            this->finger_pos_ = this->size() - 1;
         }
     }
 
-    template<typename TYPE>
-    auto original::forwardChain<TYPE>::popBegin() -> TYPE {
-        TYPE res;
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::popBegin() -> TYPE {
         if (this->size() == 0){
             throw noElementError();
         }
 
-        res = this->beginNode()->getVal();
+        TYPE res = std::move(this->beginNode()->getVal());
         if (this->size() == 1){
-            delete this->lastDelete();
+            this->destroyNode(this->lastDelete());
         } else{
             auto* del = this->beginNode();
             auto* new_begin = del->getPNext();
-            delete del;
+            if (this->finger_ == del){
+                this->finger_ = new_begin;
+            } else{
+                this->finger_pos_ -= 1;
+            }
+            this->destroyNode(del);
             forwardChainNode::connect(this->begin_, new_begin);
             this->size_ -= 1;
         }
         return res;
     }
 
-    template<typename TYPE>
-    auto original::forwardChain<TYPE>::pop(int64_t index) -> TYPE {
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::pop(int64_t index) -> TYPE {
         index = this->parseNegIndex(index);
         if (index == 0){
             return this->popBegin();
@@ -423,54 +703,72 @@ namespace original {
         if (this->indexOutOfBound(index)){
             throw outOfBoundError();
         }
-        TYPE res;
         auto* prev = this->findNode(index - 1);
         auto* cur = prev->getPNext();
-        res = cur->getVal();
+        TYPE res = std::move(cur->getVal());
         auto* next = cur->getPNext();
         forwardChainNode::connect(prev, next);
-        delete cur;
+        this->destroyNode(cur);
         this->size_ -= 1;
         return res;
     }
 
-    template<typename TYPE>
-    auto original::forwardChain<TYPE>::popEnd() -> TYPE {
-        TYPE res;
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::popEnd() -> TYPE {
         if (this->size() == 0){
             throw noElementError();
         }
         if (this->size() == 1){
-            res = this->beginNode()->getVal();
-            delete this->lastDelete();
-        } else{
-            auto* new_end = this->findNode(this->size() - 2);
-            auto* end = new_end->getPNext();
-            res = end->getVal();
-            delete end;
-            forwardChainNode::connect(new_end, nullptr);
-            this->size_ -= 1;
+            TYPE res = std::move(this->beginNode()->getVal());
+            this->destroyNode(this->lastDelete());
+            return res;
         }
+        auto* new_end = this->findNode(this->size() - 2);
+        auto* end = new_end->getPNext();
+        TYPE res = std::move(end->getVal());
+        this->destroyNode(end);
+        forwardChainNode::connect(new_end, nullptr);
+        this->size_ -= 1;
         return res;
     }
 
-    template<typename TYPE>
-    auto original::forwardChain<TYPE>::begins() const -> Iterator* {
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::fastBegin() -> FastIterator {
+        return FastIterator(this->beginNode());
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::fastEnd() -> FastIterator {
+        return FastIterator();
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::fastBegin() const -> ConstFastIterator {
+        return ConstFastIterator(this->beginNode());
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::fastEnd() const -> ConstFastIterator {
+        return ConstFastIterator();
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::begins() const -> Iterator* {
         return new Iterator(this->beginNode());
     }
 
-    template<typename TYPE>
-    auto original::forwardChain<TYPE>::ends() const -> Iterator* {
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::ends() const -> Iterator* {
         return new Iterator(this->findNode(this->size() - 1));
     }
 
-    template<typename TYPE>
-    auto original::forwardChain<TYPE>::className() const -> std::string {
+    template <typename TYPE, typename ALLOC>
+    auto original::forwardChain<TYPE, ALLOC>::className() const -> std::string {
         return "forwardChain";
     }
 
-    template<typename TYPE>
-    original::forwardChain<TYPE>::~forwardChain() {
+    template <typename TYPE, typename ALLOC>
+    original::forwardChain<TYPE, ALLOC>::~forwardChain() {
         this->chainDestruction();
     }
 
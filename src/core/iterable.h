@@ -62,6 +62,50 @@ namespace original{
         requires Operation<Callback, TYPE>
         void forEach(const Callback& operation = Callback{}) const;
     };
+
+    /**
+     * @class fastNodeIterator
+     * @brief Plain forward iterator over a chain of nodes, ending at nullptr.
+     * @details Holds a single node pointer and calls nothing virtual, so containers built
+     *          from final node classes hand it out from fastBegin() and fastEnd().
+     */
+    template<typename NODE, typename VALUE>
+    class fastNodeIterator {
+        NODE* node_;
+    public:
+        explicit fastNodeIterator(NODE* node = nullptr);
+        VALUE& operator*() const;
+        VALUE* operator->() const;
+        fastNodeIterator& operator++();
+        fastNodeIterator operator++(int);
+        bool operator==(const fastNodeIterator& other) const = default;
+    };
+
+    /**
+     * @class fastRange
+     * @brief Pair of non virtual iterators usable by a range-based for loop.
+     * @details begin() and end() of iterable allocate an iterator on the heap, and every step
+     *          through them goes through virtual calls. A fastRange, made by fast(), walks the
+     *          container with its fastBegin() and fastEnd() instead: raw pointers for contiguous
+     *          containers and fastNodeIterator for linked ones. The range only borrows the
+     *          container, and is invalidated by anything that invalidates its iterators.
+     */
+    template<typename ITER>
+    class fastRange {
+        ITER begin_;
+        ITER end_;
+    public:
+        fastRange(ITER begin, ITER end);
+        ITER begin() const;
+        ITER end() const;
+    };
+
+    /**
+     * @brief Range over container for hot loops: for (auto& e : fast(container)).
+     */
+    template<typename CONTAINER>
+    requires requires(CONTAINER& c) { c.fastBegin(); c.fastEnd(); }
+    auto fast(CONTAINER& container) -> fastRange<decltype(container.fastBegin())>;
 }
 
     template <typename TYPE>
@@ -278,18 +322,75 @@ namespace original{
     requires original::Operation<Callback, TYPE>
     auto original::iterable<TYPE>::forEach(Callback operation) -> void
     {
-        for (auto* it = this->begins(); it->isValid(); it->next()) {
+        auto* it = this->begins();
+        for (; it->isValid(); it->next()) {
             operation(it->get());
         }
+        delete it;
     }
 
     template<typename TYPE>
     template<typename Callback>
     requires original::Operation<Callback, TYPE>
     auto original::iterable<TYPE>::forEach(const Callback &operation) const -> void {
-        for (auto* it = this->begins(); it->isValid(); it->next()) {
+        auto* it = this->begins();
+        for (; it->isValid(); it->next()) {
             operation(it->getElem());
         }
+        delete it;
+    }
+
+    template<typename NODE, typename VALUE>
+    original::fastNodeIterator<NODE, VALUE>::fastNodeIterator(NODE* node) : node_(node) {}
+
+    template<typename NODE, typename VALUE>
+    auto original::fastNodeIterator<NODE, VALUE>::operator*() const -> VALUE&
+    {
+        return this->node_->getVal();
+    }
+
+    template<typename NODE, typename VALUE>
+    auto original::fastNodeIterator<NODE, VALUE>::operator->() const -> VALUE*
+    {
+        return &this->node_->getVal();
+    }
+
+    template<typename NODE, typename VALUE>
+    auto original::fastNodeIterator<NODE, VALUE>::operator++() -> fastNodeIterator&
+    {
+        this->node_ = this->node_->getPNext();
+        return *this;
+    }
+
+    template<typename NODE, typename VALUE>
+    auto original::fastNodeIterator<NODE, VALUE>::operator++(int) -> fastNodeIterator
+    {
+        auto it = *this;
+        ++*this;
+        return it;
+    }
+
+    template<typename ITER>
+    original::fastRange<ITER>::fastRange(ITER begin, ITER end)
+        : begin_(begin), end_(end) {}
+
+    template<typename ITER>
+    auto original::fastRange<ITER>::begin() const -> ITER
+    {
+        return this->begin_;
+    }
+
+    template<typename ITER>
+    auto original::fastRange<ITER>::end() const -> ITER
+    {
+        return this->end_;
+    }
+
+    template<typename CONTAINER>
+    requires requires(CONTAINER& c) { c.fastBegin(); c.fastEnd(); }
+    auto original::fast(CONTAINER& container) -> fastRange<decltype(container.fastBegin())>
+    {
+        return fastRange<decltype(container.fastBegin())>(container.fastBegin(), container.fastEnd());
     }
 
 #endif //ITERABLE_H
@@ -0,0 +1,286 @@
+#ifndef MPMCQUEUE_H
+#define MPMCQUEUE_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include "error.h"
+
+/**
+ * @file mpmcQueue.h
+ * @brief Bounded lock-free queue for any number of producer and consumer threads.
+ */
+
+namespace original {
+
+    /**
+     * @class mpmcQueue
+     * @tparam TYPE Type of the elements
+     * @brief Bounded ring buffer queue shared by many producers and consumers without locks.
+     * @details Every cell carries a sequence number telling which lap of the ring it is ready
+     *          for (D. Vyukov's bounded MPMC queue). A producer claims the cell at the enqueue
+     *          position with one compare-and-swap when the cell's sequence equals that position,
+     *          writes the element and advances the sequence by one; a consumer claims the cell
+     *          at the dequeue position once its sequence is one ahead, takes the element and
+     *          moves the sequence a whole lap forward. Producers and consumers only contend on
+     *          their own position counter, each on its own cache line.
+     *
+     *          The capacity is rounded up to a power of two, at most 2^31.
+     */
+    template<typename TYPE>
+    class mpmcQueue {
+        static constexpr std::size_t CACHE_LINE = 64;
+
+        struct cell {
+            std::atomic<uint64_t> sequence;
+            alignas(TYPE) unsigned char data[sizeof(TYPE)];
+
+            TYPE* elem();
+        };
+
+        cell* cells_;
+        uint64_t max_size_;
+        alignas(CACHE_LINE) std::atomic<uint64_t> enqueue_pos_;
+        alignas(CACHE_LINE) std::atomic<uint64_t> dequeue_pos_;
+
+        cell* claimPush();
+        cell* claimPop();
+    public:
+        explicit mpmcQueue(uint32_t capacity = 1024);
+        mpmcQueue(const mpmcQueue& other) = delete;
+        mpmcQueue& operator=(const mpmcQueue& other) = delete;
+        ~mpmcQueue();
+
+        [[nodiscard]] uint32_t capacity() const;
+
+        /**
+         * @brief Number of queued elements, only a snapshot while other threads run.
+         */
+        [[nodiscard]] uint32_t size() const;
+        [[nodiscard]] bool empty() const;
+
+        /**
+         * @brief Appends e unless the queue is full.
+         * @return false when full, e is then left untouched.
+         */
+        bool tryPush(const TYPE& e);
+        bool tryPush(TYPE&& e);
+
+        /**
+         * @brief Takes the head element into e unless the queue is empty.
+         * @return false when empty.
+         */
+        bool tryPop(TYPE& e);
+
+        /**
+         * @brief Appends elements of src in order until n are pushed or the queue is full.
+         * @details Elements of other producers may be interleaved with the batch.
+         * @return Number of elements pushed.
+         */
+        uint32_t pushBatch(const TYPE* src, uint32_t n);
+
+        /**
+         * @brief Moves elements into dst until n are popped or the queue is empty.
+         * @return Number of elements popped.
+         */
+        uint32_t popBatch(TYPE* dst, uint32_t n);
+
+        /**
+         * @brief Appends e, yielding the thread while the queue is full.
+         */
+        void push(const TYPE& e);
+        void push(TYPE&& e);
+
+        /**
+         * @brief Takes the head element, yielding the thread while the queue is empty.
+         */
+        TYPE pop();
+    };
+}
+
+    template <typename TYPE>
+    auto original::mpmcQueue<TYPE>::cell::elem() -> TYPE*
+    {
+        return std::launder(reinterpret_cast<TYPE*>(this->data));
+    }
+
+    template <typename TYPE>
+    original::mpmcQueue<TYPE>::mpmcQueue(const uint32_t capacity)
+        : cells_(nullptr), max_size_(1), enqueue_pos_(0), dequeue_pos_(0)
+    {
+        // Anything above 2^31 would round up past what capacity() can report.
+        if (capacity == 0 || capacity > 1u << 31)
+            throw valueError();
+        while (this->max_size_ < capacity) {
+            this->max_size_ *= 2;
+        }
+        this->cells_ = std::allocator<cell>{}.allocate(this->max_size_);
+        for (uint64_t i = 0; i < this->max_size_; ++i) {
+            std::construct_at(this->cells_ + i);
+            this->cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    template <typename TYPE>
+    original::mpmcQueue<TYPE>::~mpmcQueue()
+    {
+        const uint64_t tail = this->enqueue_pos_.load(std::memory_order_relaxed);
+        for (uint64_t i = this->dequeue_pos_.load(std::memory_order_relaxed); i != tail; ++i) {
+            std::destroy_at(this->cells_[i & (this->max_size_ - 1)].elem());
+        }
+        for (uint64_t i = 0; i < this->max_size_; ++i) {
+            std::destroy_at(this->cells_ + i);
+        }
+        std::allocator<cell>{}.deallocate(this->cells_, this->max_size_);
+    }
+
+    // Returns the claimed empty cell, or nullptr when the queue is full.
+    template <typename TYPE>
+    auto original::mpmcQueue<TYPE>::claimPush() -> cell*
+    {
+        uint64_t pos = this->enqueue_pos_.load(std::memory_order_relaxed);
+        while (true) {
+            cell* cur = &this->cells_[pos & (this->max_size_ - 1)];
+            const uint64_t seq = cur->sequence.load(std::memory_order_acquire);
+            const int64_t diff = static_cast<int64_t>(seq - pos);
+            if (diff == 0) {
+                if (this->enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    return cur;
+            } else if (diff < 0) {
+                return nullptr;
+            } else {
+                pos = this->enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Returns the claimed full cell, or nullptr when the queue is empty.
+    template <typename TYPE>
+    auto original::mpmcQueue<TYPE>::claimPop() -> cell*
+    {
+        uint64_t pos = this->dequeue_pos_.load(std::memory_order_relaxed);
+        while (true) {
+            cell* cur = &this->cells_[pos & (this->max_size_ - 1)];
+            const uint64_t seq = cur->sequence.load(std::memory_order_acquire);
+            const int64_t diff = static_cast<int64_t>(seq - (pos + 1));
+            if (diff == 0) {
+                if (this->dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    return cur;
+            } else if (diff < 0) {
+                return nullptr;
+            } else {
+                pos = this->dequeue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    template <typename TYPE>
+    auto original::mpmcQueue<TYPE>::capacity() const -> uint32_t
+    {
+        return this->max_size_;
+    }
+
+    template <typename TYPE>
+    auto original::mpmcQueue<TYPE>::size() const -> uint32_t
+    {
+        const uint64_t head = this->dequeue_pos_.load(std::memory_order_acquire);
+        const uint64_t tail = this->enqueue_pos_.load(std::memory_order_acquire);
+        return tail > head ? tail - head : 0;
+    }
+
+    template <typename TYPE>
+    auto original::mpmcQueue<TYPE>::empty() const -> bool
+    {
+        return this->size() == 0;
+    }
+
+    template <typename TYPE>
+    auto original::mpmcQueue<TYPE>::tryPush(const TYPE& e) -> bool
+    {
+        cell* cur = this->claimPush();
+        if (cur == nullptr)
+            return false;
+        const uint64_t seq = cur->sequence.load(std::memory_order_relaxed);
+        std::construct_at(reinterpret_cast<TYPE*>(cur->data), e);
+        cur->sequence.store(seq + 1, std::memory_order_release);
+        return true;
+    }
+
+    template <typename TYPE>
+    auto original::mpmcQueue<TYPE>::tryPush(TYPE&& e) -> bool
+    {
+        cell* cur = this->claimPush();
+        if (cur == nullptr)
+            return false;
+        const uint64_t seq = cur->sequence.load(std::memory_order_relaxed);
+        std::construct_at(reinterpret_cast<TYPE*>(cur->data), std::move(e));
+        cur->sequence.store(seq + 1, std::memory_order_release);
+        return true;
+    }
+
+    template <typename TYPE>
+    auto original::mpmcQueue<TYPE>::tryPop(TYPE& e) -> bool
+    {
+        cell* cur = this->claimPop();
+        if (cur == nullptr)
+            return false;
+        const uint64_t seq = cur->sequence.load(std::memory_order_relaxed);
+        e = std::move(*cur->elem());
+        std::destroy_at(cur->elem());
+        cur->sequence.store(seq - 1 + this->max_size_, std::memory_order_release);
+        return true;
+    }
+
+    template <typename TYPE>
+    auto original::mpmcQueue<TYPE>::pushBatch(const TYPE* src, const uint32_t n) -> uint32_t
+    {
+        uint32_t cnt = 0;
+        while (cnt < n && this->tryPush(src[cnt])) {
+            cnt += 1;
+        }
+        return cnt;
+    }
+
+    template <typename TYPE>
+    auto original::mpmcQueue<TYPE>::popBatch(TYPE* dst, const uint32_t n) -> uint32_t
+    {
+        uint32_t cnt = 0;
+        while (cnt < n && this->tryPop(dst[cnt])) {
+            cnt += 1;
+        }
+        return cnt;
+    }
+
+    template <typename TYPE>
+    auto original::mpmcQueue<TYPE>::push(const TYPE& e) -> void
+    {
+        while (!this->tryPush(e)) {
+            std::this_thread::yield();
+        }
+    }
+
+    template <typename TYPE>
+    auto original::mpmcQueue<TYPE>::push(TYPE&& e) -> void
+    {
+        while (!this->tryPush(std::move(e))) {
+            std::this_thread::yield();
+        }
+    }
+
+    template <typename TYPE>
+    auto original::mpmcQueue<TYPE>::pop() -> TYPE
+    {
+        cell* cur = this->claimPop();
+        while (cur == nullptr) {
+            std::this_thread::yield();
+            cur = this->claimPop();
+        }
+        const uint64_t seq = cur->sequence.load(std::memory_order_relaxed);
+        TYPE res = std::move(*cur->elem());
+        std::destroy_at(cur->elem());
+        cur->sequence.store(seq - 1 + this->max_size_, std::memory_order_release);
+        return res;
+    }
+
+#endif //MPMCQUEUE_H
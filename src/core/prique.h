@@ -5,15 +5,27 @@
 #include "comparator.h"
 #include "containerAdapter.h"
 #include "types.h"
+#include "vector.h"
 
 namespace original
 {
+    /**
+     * @class prique
+     * @tparam TYPE Type of the elements
+     * @tparam Callback Comparator type, the element comparing first is popped first
+     * @tparam SERIAL Underlying list holding the heap
+     * @tparam ARITY Number of children of each heap node, 4 gives a shallower heap with better locality
+     * @brief Priority queue kept as an implicit ARITY-ary heap over SERIAL.
+     */
     template<typename TYPE,
     template <typename> typename Callback = increaseComparator,
-    template <typename> typename SERIAL = blocksList>
+    template <typename> typename SERIAL = defaultBlocksList,
+    uint32_t ARITY = 2>
     requires Compare<Callback<TYPE>, TYPE>
     class prique final : public containerAdapter<TYPE, SERIAL>
     {
+        static_assert(ARITY >= 2, "a heap node needs at least two children");
+
         Callback<TYPE> compare_;
         public:
             explicit prique(const SERIAL<TYPE>& serial = SERIAL<TYPE>{}, const Callback<TYPE>& compare = Callback<TYPE>{});
@@ -24,33 +36,56 @@ namespace original
             prique(prique&& other) noexcept;
             prique& operator=(prique&& other) noexcept;
             void push(const TYPE& e);
+            void push(TYPE&& e);
+            template<typename... Args>
+            void emplace(Args&&... args);
+
+            /**
+             * @brief Pushes every element of [begin, end).
+             * @details Small batches are sifted up one by one, a batch large enough that this would
+             *          cost more than rebuilding re-heapifies the whole queue in linear time instead.
+             */
+            void pushAll(const iterator<TYPE>& begin, const iterator<TYPE>& end);
             TYPE pop();
+
+            /**
+             * @brief Pops the first k elements.
+             * @return The popped elements in popping order.
+             * @throw noElementError if fewer than k elements are queued, nothing is popped then.
+             */
+            vector<TYPE> popN(uint32_t k);
+
+            /**
+             * @brief Pops every element, leaving the queue empty.
+             * @return The popped elements in popping order.
+             */
+            vector<TYPE> drainSorted();
             TYPE top() const;
             [[nodiscard]] std::string className() const override;
     };
 }
 
-    template <typename TYPE, template <typename> class Callback, template <typename> typename SERIAL>
+    template <typename TYPE, template <typename> class Callback, template <typename> typename SERIAL, uint32_t ARITY>
     requires original::Compare<Callback<TYPE>, TYPE>
-    original::prique<TYPE, Callback, SERIAL>::prique(const SERIAL<TYPE>& serial, const Callback<TYPE>& compare)
+    original::prique<TYPE, Callback, SERIAL, ARITY>::prique(const SERIAL<TYPE>& serial, const Callback<TYPE>& compare)
         : containerAdapter<TYPE, SERIAL>(serial), compare_(compare)
     {
-        algorithms::heapInit(this->serial_.begin(), this->serial_.last(), this->compare_);
+        algorithms::heapInit<ARITY>(this->serial_.begin(), this->serial_.last(), this->compare_);
     }
 
-    template <typename TYPE, template <typename> class Callback, template <typename> typename SERIAL>
+    template <typename TYPE, template <typename> class Callback, template <typename> typename SERIAL, uint32_t ARITY>
     requires original::Compare<Callback<TYPE>, TYPE>
-    original::prique<TYPE, Callback, SERIAL>::prique(const std::initializer_list<TYPE>& lst, const Callback<TYPE>& compare)
+    original::prique<TYPE, Callback, SERIAL, ARITY>::prique(const std::initializer_list<TYPE>& lst, const Callback<TYPE>& compare)
         : prique(SERIAL<TYPE>(lst), compare) {}
 
-    template <typename TYPE, template <typename> class Callback, template <typename> typename SERIAL>
+    template <typename TYPE, template <typename> class Callback, template <typename> typename SERIAL, uint32_t ARITY>
     requires original::Compare<Callback<TYPE>, TYPE>
-    original::prique<TYPE, Callback, SERIAL>::prique(const prique& other)
+    original::prique<TYPE, Callback, SERIAL, ARITY>::prique(const prique& other)
         : containerAdapter<TYPE, SERIAL>(other.serial_), compare_(other.compare_) {}
 
-    template <typename TYPE, template <typename> class Callback, template <typename> typename SERIAL>
+    template <typename TYPE, template <typename> class Callback, template <typename> typename SERIAL, uint32_t ARITY>
     requires original::Compare<Callback<TYPE>, TYPE>
-    auto original::prique<TYPE, Callback, SERIAL>::operator=(const prique& other) -> prique&
+    auto original::prique<TYPE, Callback, SERIAL, ARITY>::operator=(const prique& other) -> prique&
     {
         if (this == &other) return *this;
         this->serial_ = other.serial_;
@@ -58,23 +93,23 @@ namespace original
         return *this;
     }
 
-    template <typename TYPE, template <typename> class Callback, template <typename> typename SERIAL>
+    template <typename TYPE, template <typename> class Callback, template <typename> typename SERIAL, uint32_t ARITY>
     requires original::Compare<Callback<TYPE>, TYPE>
-    auto original::prique<TYPE, Callback, SERIAL>::operator==(const prique& other) const -> bool
+    auto original::prique<TYPE, Callback, SERIAL, ARITY>::operator==(const prique& other) const -> bool
     {
         return this->serial_ == other.serial_;
     }
 
-    template <typename TYPE, template <typename> class Callback, template <typename> typename SERIAL>
+    template <typename TYPE, template <typename> class Callback, template <typename> typename SERIAL, uint32_t ARITY>
     requires original::Compare<Callback<TYPE>, TYPE>
-    original::prique<TYPE, Callback, SERIAL>::prique(prique&& other) noexcept : prique()
+    original::prique<TYPE, Callback, SERIAL, ARITY>::prique(prique&& other) noexcept : prique()
     {
         this->operator=(std::move(other));
     }
 
-    template <typename TYPE, template <typename> class Callback, template <typename> typename SERIAL>
+    template <typename TYPE, template <typename> class Callback, template <typename> typename SERIAL, uint32_t ARITY>
     requires original::Compare<Callback<TYPE>, TYPE>
-    auto original::prique<TYPE, Callback, SERIAL>::operator=(prique&& other) noexcept -> prique&
+    auto original::prique<TYPE, Callback, SERIAL, ARITY>::operator=(prique&& other) noexcept -> prique&
     {
         if (this == &other)
             return *this;
@@ -86,36 +121,114 @@ namespace original
         return *this;
     }
 
-    template <typename TYPE, template <typename> class Callback, template <typename> typename SERIAL>
+    template <typename TYPE, template <typename> class Callback, template <typename> typename SERIAL, uint32_t ARITY>
     requires original::Compare<Callback<TYPE>, TYPE>
-    auto original::prique<TYPE, Callback, SERIAL>::push(const TYPE& e) -> void
+    auto original::prique<TYPE, Callback, SERIAL, ARITY>::push(const TYPE& e) -> void
     {
         this->serial_.pushEnd(e);
-        algorithms::heapAdjustUp(this->serial_.begin(), this->serial_.last(), this->compare_);
+        algorithms::heapAdjustUp<ARITY>(this->serial_.begin(), this->serial_.last(), this->compare_);
+    }
+
+    template <typename TYPE, template <typename> class Callback, template <typename> typename SERIAL, uint32_t ARITY>
+    requires original::Compare<Callback<TYPE>, TYPE>
+    auto original::prique<TYPE, Callback, SERIAL, ARITY>::push(TYPE&& e) -> void
+    {
+        this->serial_.pushEnd(std::move(e));
+        algorithms::heapAdjustUp<ARITY>(this->serial_.begin(), this->serial_.last(), this->compare_);
     }
 
-    template <typename TYPE, template <typename> class Callback, template <typename> typename SERIAL>
+    template <typename TYPE, template <typename> class Callback, template <typename> typename SERIAL, uint32_t ARITY>
     requires original::Compare<Callback<TYPE>, TYPE>
-    auto original::prique<TYPE, Callback, SERIAL>::pop() -> TYPE
+    template <typename... Args>
+    auto original::prique<TYPE, Callback, SERIAL, ARITY>::emplace(Args&&... args) -> void
+    {
+        this->serial_.emplaceEnd(std::forward<Args>(args)...);
+        algorithms::heapAdjustUp<ARITY>(this->serial_.begin(), this->serial_.last(), this->compare_);
+    }
+
+    template <typename TYPE, template <typename> class Callback, template <typename> typename SERIAL, uint32_t ARITY>
+    requires original::Compare<Callback<TYPE>, TYPE>
+    auto original::prique<TYPE, Callback, SERIAL, ARITY>::pushAll(const iterator<TYPE>& begin, const iterator<TYPE>& end) -> void
+    {
+        const uint32_t old_size = this->size();
+        if constexpr (requires { this->serial_.pushEnd(begin, end); }) {
+            this->serial_.pushEnd(begin, end);
+        } else {
+            auto* it = begin.clone();
+            for (; it->isValid() && !it->equal(end); it->next())
+            {
+                this->serial_.pushEnd(it->getElem());
+            }
+            delete it;
+        }
+
+        const uint32_t added = this->size() - old_size;
+        if (added == 0)
+            return;
+
+        // Sifting up costs up to the heap depth per element, Floyd's heapInit costs about the whole size.
+        uint32_t depth = 0;
+        for (uint32_t n = this->size(); n > 0; n /= ARITY)
+        {
+            depth += 1;
+        }
+        if (static_cast<uint64_t>(added) * depth >= this->size()) {
+            algorithms::heapInit<ARITY>(this->serial_.begin(), this->serial_.last(), this->compare_);
+            return;
+        }
+
+        auto* it = algorithms::frontOf(this->serial_.begin(), old_size);
+        for (; it->isValid(); it->next())
+        {
+            algorithms::heapAdjustUp<ARITY>(this->serial_.begin(), *it, this->compare_);
+        }
+        delete it;
+    }
+
+    template <typename TYPE, template <typename> class Callback, template <typename> typename SERIAL, uint32_t ARITY>
+    requires original::Compare<Callback<TYPE>, TYPE>
+    auto original::prique<TYPE, Callback, SERIAL, ARITY>::pop() -> TYPE
     {
         if (this->empty()) throw noElementError();
 
         algorithms::swap(this->serial_.begin(), this->serial_.last());
         TYPE res = this->serial_.popEnd();
-        algorithms::heapAdjustDown(this->serial_.begin(), this->serial_.last(), this->serial_.begin(), compare_);
+        algorithms::heapAdjustDown<ARITY>(this->serial_.begin(), this->serial_.last(), this->serial_.begin(), compare_);
+        return res;
+    }
+
+    template <typename TYPE, template <typename> class Callback, template <typename> typename SERIAL, uint32_t ARITY>
+    requires original::Compare<Callback<TYPE>, TYPE>
+    auto original::prique<TYPE, Callback, SERIAL, ARITY>::popN(const uint32_t k) -> vector<TYPE>
+    {
+        if (k > this->size()) throw noElementError();
+
+        vector<TYPE> res;
+        res.reserve(k);
+        for (uint32_t i = 0; i < k; ++i)
+        {
+            res.pushEnd(this->pop());
+        }
         return res;
     }
 
-    template <typename TYPE, template <typename> class Callback, template <typename> typename SERIAL>
+    template <typename TYPE, template <typename> class Callback, template <typename> typename SERIAL, uint32_t ARITY>
+    requires original::Compare<Callback<TYPE>, TYPE>
+    auto original::prique<TYPE, Callback, SERIAL, ARITY>::drainSorted() -> vector<TYPE>
+    {
+        return this->popN(this->size());
+    }
+
+    template <typename TYPE, template <typename> class Callback, template <typename> typename SERIAL, uint32_t ARITY>
     requires original::Compare<Callback<TYPE>, TYPE>
-    auto original::prique<TYPE, Callback, SERIAL>::top() const -> TYPE
+    auto original::prique<TYPE, Callback, SERIAL, ARITY>::top() const -> TYPE
     {
         return this->serial_.getBegin();
     }
 
-    template <typename TYPE, template <typename> class Callback, template <typename> typename SERIAL>
+    template <typename TYPE, template <typename> class Callback, template <typename> typename SERIAL, uint32_t ARITY>
     requires original::Compare<Callback<TYPE>, TYPE>
-    auto original::prique<TYPE, Callback, SERIAL>::className() const -> std::string
+    auto original::prique<TYPE, Callback, SERIAL, ARITY>::className() const -> std::string
     {
         return "prique";
     }
@@ -6,7 +6,7 @@
 #include <string>
 
 namespace original {
-    template<typename TYPE, template <typename> typename SERIAL = chain>
+    template<typename TYPE, template <typename> typename SERIAL = defaultChain>
     class queue final : public containerAdapter<TYPE, SERIAL> {
     public:
         explicit queue(const SERIAL<TYPE>& serial = SERIAL<TYPE>{});
@@ -17,6 +17,9 @@ namespace original {
         queue& operator=(queue&& other) noexcept;
         bool operator==(const queue& other) const;
         void push(const TYPE& e);
+        void push(TYPE&& e);
+        template<typename... Args>
+        void emplace(Args&&... args);
         TYPE pop();
         TYPE head() const;
         TYPE tail() const;
@@ -70,6 +73,17 @@ namespace original {
         this->serial_.pushEnd(e);
     }
 
+    template<typename TYPE, template <typename> typename SERIAL>
+    auto original::queue<TYPE, SERIAL>::push(TYPE&& e) -> void {
+        this->serial_.pushEnd(std::move(e));
+    }
+
+    template<typename TYPE, template <typename> typename SERIAL>
+    template<typename... Args>
+    auto original::queue<TYPE, SERIAL>::emplace(Args&&... args) -> void {
+        this->serial_.emplaceEnd(std::forward<Args>(args)...);
+    }
+
     template<typename TYPE, template <typename> typename SERIAL>
     auto original::queue<TYPE, SERIAL>::pop() -> TYPE {
         return this->serial_.popBegin();
@@ -5,8 +5,11 @@
 #include "error.h"
 #include "iterator.h"
 #include <limits>
+#include <type_traits>
 
 namespace original{
+    class algorithms;
+
     template<typename TYPE>
     class randomAccessIterator : public baseIterator<TYPE>{
     protected:
@@ -17,6 +20,7 @@ namespace original{
         explicit randomAccessIterator(TYPE* ptr, const container<TYPE>* container, int64_t pos);
         bool equalPtr(const iterator<TYPE> * other) const override;
     public:
+        friend class algorithms;
         randomAccessIterator(const randomAccessIterator& other);
         randomAccessIterator& operator=(const randomAccessIterator& other);
         randomAccessIterator* clone() const override;
@@ -156,7 +160,12 @@ namespace original{
     template<typename TYPE>
     auto original::randomAccessIterator<TYPE>::set(const TYPE& data) -> void {
         if (!this->isValid()) throw outOfBoundError();
-        *this->_ptr = data;
+        // Iterators over read-only views, such as a span<const TYPE>
+        if constexpr (std::is_const_v<TYPE>) {
+            throw unSupportedMethodError();
+        } else {
+            *this->_ptr = data;
+        }
     }
 
     template<typename TYPE>
@@ -0,0 +1,249 @@
+#ifndef RANKSELECT_H
+#define RANKSELECT_H
+
+#include <bit>
+#include <cstdint>
+#include "array.h"
+#include "bitKernels.h"
+#include "bitSet.h"
+#include "error.h"
+#include "maths.h"
+#include "printable.h"
+
+/**
+ * @file rankSelect.h
+ * @brief Succinct rank and select directory over a bitSet.
+ */
+
+namespace original {
+
+    /**
+     * @class rankSelect
+     * @brief Answers rank and select queries on a bitSet without scanning it.
+     * @details The bits are cut into superblocks of 65536 bits, each split into blocks of 512 bits.
+     *          Every superblock stores the number of set bits before it as a uint32, and every
+     *          block the number of set bits before it inside its superblock as a uint16, which
+     *          adds about 3.2% to the memory of the bitSet. rank1() then reads two counts and
+     *          counts at most 8 words. select1() also keeps the block of every 8192th set bit, and
+     *          binary searches the blocks between two such samples.
+     *
+     *          The index keeps a pointer to its bitSet, which has to outlive it. Every write to the
+     *          bitSet marks the index stale, and the next query rebuilds it in O(n / 64). Queries
+     *          are therefore not safe to run concurrently with writes or with each other on a
+     *          stale index.
+     */
+    class rankSelect final : public printable {
+        using word = bitKernels::word;
+
+        static constexpr uint32_t BLOCK_WORDS = 8;
+        static constexpr uint32_t SUPER_BLOCKS = 65536 / (BLOCK_WORDS * 64);
+        static constexpr uint32_t SELECT_SAMPLE = 8192;
+
+        const bitSet* bits_;
+        mutable uint64_t version_;
+        mutable uint32_t ones_;
+        mutable array<uint32_t> supers_;
+        mutable array<uint16_t> blocks_;
+        mutable array<uint32_t> samples_;
+
+        void rebuild() const;
+        void refresh() const;
+        [[nodiscard]] const word* words() const;
+        [[nodiscard]] uint32_t wordCount() const;
+        [[nodiscard]] uint32_t onesBeforeBlock(uint32_t block) const;
+        [[nodiscard]] static uint32_t selectInWord(word w, uint32_t k);
+    public:
+        /**
+         * @brief Builds the index over bs right away.
+         */
+        explicit rankSelect(const bitSet& bs);
+
+        /**
+         * @brief Number of set bits in [0, pos).
+         * @throw outOfBoundError if pos is greater than the size of the bitSet.
+         */
+        [[nodiscard]] uint32_t rank1(uint32_t pos) const;
+
+        /**
+         * @brief Number of clear bits in [0, pos).
+         * @throw outOfBoundError if pos is greater than the size of the bitSet.
+         */
+        [[nodiscard]] uint32_t rank0(uint32_t pos) const;
+
+        /**
+         * @brief Position of the k-th set bit, counting from 0.
+         * @throw outOfBoundError if k is not lower than ones().
+         */
+        [[nodiscard]] uint32_t select1(uint32_t k) const;
+
+        /**
+         * @brief Number of set bits in the whole bitSet.
+         */
+        [[nodiscard]] uint32_t ones() const;
+
+        /**
+         * @brief Whether the bitSet changed since the index was last built.
+         */
+        [[nodiscard]] bool stale() const;
+
+        /**
+         * @brief Bytes used by the directory, not counting the bitSet itself.
+         */
+        [[nodiscard]] uint64_t sizeInBytes() const;
+
+        [[nodiscard]] std::string className() const override;
+    };
+}
+
+    inline auto original::rankSelect::words() const -> const word*
+    {
+        return this->bits_->blocks();
+    }
+
+    inline auto original::rankSelect::wordCount() const -> uint32_t
+    {
+        return this->bits_->blockCount();
+    }
+
+    inline auto original::rankSelect::rebuild() const -> void
+    {
+        const word* w = this->words();
+        const uint32_t n = this->wordCount();
+        const uint32_t block_count = (n + BLOCK_WORDS - 1) / BLOCK_WORDS;
+        this->supers_ = array<uint32_t>((block_count + SUPER_BLOCKS - 1) / SUPER_BLOCKS);
+        this->blocks_ = array<uint16_t>(block_count);
+        this->ones_ = this->bits_->count();
+        this->samples_ = array<uint32_t>((this->ones_ + SELECT_SAMPLE - 1) / SELECT_SAMPLE);
+
+        const auto& kernels = bitKernels::kernels();
+        uint32_t total = 0;
+        uint32_t next_sample = 0;
+        for (uint32_t b = 0; b < block_count; ++b) {
+            if (b % SUPER_BLOCKS == 0)
+                this->supers_[b / SUPER_BLOCKS] = total;
+            this->blocks_[b] = total - this->supers_.get(b / SUPER_BLOCKS);
+
+            const uint32_t first = b * BLOCK_WORDS;
+            const uint32_t inside = kernels.popcount(w + first, min(BLOCK_WORDS, n - first));
+            for (; next_sample < this->samples_.size()
+                   && static_cast<uint64_t>(next_sample) * SELECT_SAMPLE < total + inside; ++next_sample) {
+                this->samples_[next_sample] = b;
+            }
+            total += inside;
+        }
+        this->version_ = this->bits_->version_;
+    }
+
+    inline auto original::rankSelect::refresh() const -> void
+    {
+        if (this->stale()) this->rebuild();
+    }
+
+    inline auto original::rankSelect::onesBeforeBlock(const uint32_t block) const -> uint32_t
+    {
+        return (&this->supers_.data())[block / SUPER_BLOCKS] + (&this->blocks_.data())[block];
+    }
+
+    // Broadword select: per byte prefix counts locate the byte holding the k-th set bit, then
+    // the lower set bits of that byte are dropped one by one.
+    inline auto original::rankSelect::selectInWord(const word w, const uint32_t k) -> uint32_t
+    {
+        constexpr word ONES = 0x0101010101010101;
+        constexpr word HIGHS = 0x8080808080808080;
+        word sums = w - (w >> 1 & 0x5555555555555555);
+        sums = (sums & 0x3333333333333333) + (sums >> 2 & 0x3333333333333333);
+        sums = ((sums + (sums >> 4)) & 0x0F0F0F0F0F0F0F0F) * ONES;
+
+        // A byte's high bit ends up set when its prefix count is at most k.
+        const word steps = k * ONES;
+        const word at_most = (((steps | HIGHS) - (sums & ~HIGHS)) ^ sums ^ steps) & HIGHS;
+        const uint32_t place = (at_most >> 7) * ONES >> 53 & ~static_cast<uint32_t>(7);
+
+        uint32_t byte = w >> place & 0xFF;
+        for (uint32_t skip = k - (sums << 8 >> place & 0xFF); skip > 0; --skip) {
+            byte &= byte - 1;
+        }
+        return place + std::countr_zero(byte);
+    }
+
+    inline original::rankSelect::rankSelect(const bitSet& bs)
+        : bits_(&bs), version_(), ones_()
+    {
+        this->rebuild();
+    }
+
+    inline auto original::rankSelect::rank1(const uint32_t pos) const -> uint32_t
+    {
+        if (pos > this->bits_->size()) throw outOfBoundError();
+        this->refresh();
+
+        const word* w = this->words();
+        const uint32_t target = pos / 64;
+        const uint32_t block = target / BLOCK_WORDS;
+        if (block == this->blocks_.size()) return this->ones_;
+
+        uint32_t count = this->onesBeforeBlock(block);
+        for (uint32_t i = block * BLOCK_WORDS; i < target; ++i) {
+            count += bitKernels::popcountWord(w[i]);
+        }
+        if (pos % 64 != 0)
+            count += bitKernels::popcountWord(w[target] & ((static_cast<word>(1) << pos % 64) - 1));
+        return count;
+    }
+
+    inline auto original::rankSelect::rank0(const uint32_t pos) const -> uint32_t
+    {
+        return pos - this->rank1(pos);
+    }
+
+    inline auto original::rankSelect::select1(uint32_t k) const -> uint32_t
+    {
+        this->refresh();
+        if (k >= this->ones_) throw outOfBoundError();
+
+        // The k-th set bit lies between the blocks of the samples around it.
+        const uint32_t sample = k / SELECT_SAMPLE;
+        uint32_t lo = this->samples_.get(sample);
+        uint32_t hi = sample + 1 < this->samples_.size() ? this->samples_.get(sample + 1) : this->blocks_.size() - 1;
+        while (lo < hi) {
+            const uint32_t mid = lo + (hi - lo + 1) / 2;
+            if (this->onesBeforeBlock(mid) <= k) {
+                lo = mid;
+            } else {
+                hi = mid - 1;
+            }
+        }
+
+        const word* w = this->words();
+        k -= this->onesBeforeBlock(lo);
+        uint32_t i = lo * BLOCK_WORDS;
+        for (uint32_t c = bitKernels::popcountWord(w[i]); k >= c; c = bitKernels::popcountWord(w[++i])) {
+            k -= c;
+        }
+        return i * 64 + selectInWord(w[i], k);
+    }
+
+    inline auto original::rankSelect::ones() const -> uint32_t
+    {
+        this->refresh();
+        return this->ones_;
+    }
+
+    inline auto original::rankSelect::stale() const -> bool
+    {
+        return this->version_ != this->bits_->version_;
+    }
+
+    inline auto original::rankSelect::sizeInBytes() const -> uint64_t
+    {
+        return 4 * static_cast<uint64_t>(this->supers_.size())
+             + 2 * static_cast<uint64_t>(this->blocks_.size())
+             + 4 * static_cast<uint64_t>(this->samples_.size());
+    }
+
+    inline auto original::rankSelect::className() const -> std::string
+    {
+        return "rankSelect";
+    }
+
+#endif //RANKSELECT_H
@@ -0,0 +1,1127 @@
+#ifndef ROARINGBITMAP_H
+#define ROARINGBITMAP_H
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include "array.h"
+#include "bitKernels.h"
+#include "bitSet.h"
+#include "comparable.h"
+#include "error.h"
+#include "printable.h"
+#include "vector.h"
+
+/**
+ * @file roaringBitmap.h
+ * @brief Compressed bitmap of 32 bit values, laid out like a Roaring bitmap.
+ */
+
+namespace original {
+
+    /**
+     * @class roaringBitmap
+     * @brief Set of uint32_t values split into chunks of 65536 values, each compressed on its own.
+     * @details The high 16 bits of a value pick its chunk, and the chunk stores the low 16 bits.
+     *          A chunk with at most ARRAY_MAX_SIZE values is a sorted array of them. A denser
+     *          chunk is a 65536 bit bitmap, and the bitKernels that back bitSet work on it.
+     *          runOptimize() turns chunks made of long consecutive ranges into lists of runs.
+     *          Chunks without any value are not stored at all, so both very sparse and very
+     *          dense sets take a fraction of the memory of a flat bitSet.
+     *
+     *          Operations between an array chunk and any other chunk probe the array's values,
+     *          all other pairs are combined word by word as bitmaps.
+     */
+    class roaringBitmap final : public printable {
+    public:
+        /**
+         * @enum chunkKind
+         * @brief Storage of one chunk, also written by serialize().
+         */
+        enum class chunkKind : uint8_t {
+            ARRAY = 0,
+            BITMAP = 1,
+            RUN = 2,
+        };
+    private:
+        static constexpr uint32_t ARRAY_MAX_SIZE = 4096;
+        static constexpr uint32_t BITMAP_WORDS = 65536 / 64;
+        static constexpr uint32_t SERIAL_MAGIC = 0x3142524F; // "ORB1" in little endian
+
+        enum class operation {
+            AND,
+            OR,
+            XOR,
+            AND_NOT,
+        };
+
+        class chunk final : public printable, public comparable<chunk> {
+        public:
+            chunkKind kind;
+            uint32_t cardinality;
+            // ARRAY: the sorted values, RUN: the first and last value of every run, in order
+            vector<uint16_t> values;
+            // BITMAP: BITMAP_WORDS words, empty for the other kinds
+            array<uint64_t> words;
+
+            chunk();
+
+            [[nodiscard]] uint16_t* raw() const;
+            [[nodiscard]] uint64_t* rawWords() const;
+            [[nodiscard]] uint32_t runs() const;
+            [[nodiscard]] uint32_t lowerBound(uint16_t v) const;
+            [[nodiscard]] int64_t runOf(uint16_t v) const;
+            [[nodiscard]] bool contains(uint16_t v) const;
+            bool add(uint16_t v);
+            bool remove(uint16_t v);
+            [[nodiscard]] uint32_t rank(uint16_t v) const;
+            [[nodiscard]] uint16_t select(uint32_t k) const;
+            [[nodiscard]] array<uint64_t> toWords() const;
+            void setWords(array<uint64_t>&& bits, uint32_t count);
+            void setValues(vector<uint16_t>&& sorted);
+            void expandRuns();
+            void normalize();
+            [[nodiscard]] uint32_t countRuns() const;
+            bool runOptimize();
+            [[nodiscard]] uint64_t sizeInBytes() const;
+
+            static chunk filter(const chunk& arr, const chunk& other, bool keep_contained);
+            static chunk merge(const chunk& a, const chunk& b, operation op);
+            static chunk combine(const chunk& a, const chunk& b, operation op);
+
+            // Orders by cardinality, then by the bitmap words, so equal sets compare equal whatever their kind.
+            int64_t compareTo(const chunk& other) const override;
+            [[nodiscard]] std::string className() const override;
+        };
+
+        vector<uint16_t> keys_;
+        vector<chunk> chunks_;
+
+        [[nodiscard]] static uint32_t searchSorted(const uint16_t* first, uint32_t size, uint16_t v);
+        [[nodiscard]] static uint16_t high(uint32_t value);
+        [[nodiscard]] static uint16_t low(uint32_t value);
+        [[nodiscard]] uint32_t lowerBound(uint16_t key) const;
+        [[nodiscard]] int64_t chunkOf(uint16_t key) const;
+        void apply(const roaringBitmap& other, operation op);
+
+        template<typename T>
+        static void writeLE(std::string& out, T value);
+        template<typename T>
+        static T readLE(const std::string& in, uint64_t& pos);
+    public:
+        /**
+         * @class Iterator
+         * @brief Forward iterator over the values in increasing order.
+         * @details The bitmap must not change while it is being iterated.
+         */
+        class Iterator {
+                const roaringBitmap* container_;
+                const chunk* chunk_;
+                uint32_t key_;
+                uint32_t cur_chunk;
+                uint32_t pos;
+                uint64_t word;
+                uint32_t cur_low;
+
+                Iterator(const roaringBitmap* container, uint32_t index);
+                void enter(uint32_t index);
+                void settle();
+            public:
+                friend class roaringBitmap;
+                uint32_t operator*() const;
+                Iterator& operator++();
+                bool operator==(const Iterator& other) const;
+        };
+
+        explicit roaringBitmap();
+        roaringBitmap(const std::initializer_list<uint32_t>& lst);
+
+        /**
+         * @brief Holds the indexes of the set bits of bs.
+         */
+        explicit roaringBitmap(const bitSet& bs);
+
+        /**
+         * @brief Adds value.
+         * @return Whether value was absent before.
+         */
+        bool add(uint32_t value);
+
+        /**
+         * @brief Removes value.
+         * @return Whether value was present before.
+         */
+        bool remove(uint32_t value);
+        [[nodiscard]] bool contains(uint32_t value) const;
+        [[nodiscard]] uint64_t cardinality() const;
+        [[nodiscard]] bool empty() const;
+        void clear();
+
+        /**
+         * @brief Number of values lower than or equal to value.
+         */
+        [[nodiscard]] uint64_t rank(uint32_t value) const;
+
+        /**
+         * @brief The k-th lowest value, counting from 0.
+         * @throw outOfBoundError if k is not lower than cardinality().
+         */
+        [[nodiscard]] uint32_t select(uint64_t k) const;
+
+        /**
+         * @brief Stores every chunk as runs where that takes less memory.
+         * @return Whether any chunk changed.
+         */
+        bool runOptimize();
+
+        /**
+         * @brief Bytes taken by the chunks' storage, without the slack of their buffers.
+         */
+        [[nodiscard]] uint64_t sizeInBytes() const;
+
+        /**
+         * @brief Kind of the chunk holding value, for tests and diagnostics.
+         * @throw noElementError if no value shares the high 16 bits of value.
+         */
+        [[nodiscard]] chunkKind kindOf(uint32_t value) const;
+
+        roaringBitmap& operator&=(const roaringBitmap& other);
+        roaringBitmap& operator|=(const roaringBitmap& other);
+        roaringBitmap& operator^=(const roaringBitmap& other);
+
+        /**
+         * @brief Removes every value of other, the in place form of *this & ~other.
+         */
+        roaringBitmap& andNot(const roaringBitmap& other);
+        bool operator==(const roaringBitmap& other) const;
+
+        [[nodiscard]] Iterator begin() const;
+        [[nodiscard]] Iterator end() const;
+
+        /**
+         * @brief Encodes the bitmap in a portable binary format.
+         * @details All integers are little endian. The format is the magic "ORB1" and the number
+         *          of chunks as uint32, then for each chunk in key order: its key as uint16, its
+         *          chunkKind as uint8, its cardinality and its number of entries as uint32, and
+         *          the entries: uint16 values for an array, pairs of uint16 first and last values
+         *          for runs, or 1024 uint64 words for a bitmap.
+         */
+        [[nodiscard]] std::string serialize() const;
+
+        /**
+         * @brief Decodes what serialize() wrote.
+         * @throw valueError if data is truncated or not a valid encoding.
+         */
+        static roaringBitmap deserialize(const std::string& data);
+
+        [[nodiscard]] std::string className() const override;
+        [[nodiscard]] std::string toString(bool enter) const override;
+    };
+
+    roaringBitmap operator&(const roaringBitmap& lrb, const roaringBitmap& rrb);
+    roaringBitmap operator|(const roaringBitmap& lrb, const roaringBitmap& rrb);
+    roaringBitmap operator^(const roaringBitmap& lrb, const roaringBitmap& rrb);
+}
+
+    inline original::roaringBitmap::chunk::chunk() : kind(chunkKind::ARRAY), cardinality(0) {}
+
+    inline auto original::roaringBitmap::chunk::raw() const -> uint16_t*
+    {
+        return &this->values.data();
+    }
+
+    inline auto original::roaringBitmap::chunk::rawWords() const -> uint64_t*
+    {
+        return &this->words.data();
+    }
+
+    inline auto original::roaringBitmap::chunk::runs() const -> uint32_t
+    {
+        return this->values.size() / 2;
+    }
+
+    // Lower bound without data dependent branches, lookups land on random positions so they would mispredict.
+    inline auto original::roaringBitmap::searchSorted(const uint16_t* first, uint32_t size, const uint16_t v) -> uint32_t
+    {
+        const uint16_t* base = first;
+        while (size > 1) {
+            const uint32_t half = size / 2;
+            base = base[half] < v ? base + half : base;
+            size -= half;
+        }
+        return base - first + (size == 1 && *base < v);
+    }
+
+    inline auto original::roaringBitmap::chunk::lowerBound(const uint16_t v) const -> uint32_t
+    {
+        const uint16_t* first = this->raw();
+        return searchSorted(first, this->values.size(), v);
+    }
+
+    // Index of the run holding v, or -1.
+    inline auto original::roaringBitmap::chunk::runOf(const uint16_t v) const -> int64_t
+    {
+        // Finds the last run starting at or before v, the same way as searchSorted.
+        const uint16_t* r = this->raw();
+        uint32_t size = this->runs();
+        if (size == 0) return -1;
+
+        uint32_t base = 0;
+        while (size > 1) {
+            const uint32_t half = size / 2;
+            base = r[2 * (base + half)] <= v ? base + half : base;
+            size -= half;
+        }
+        return r[2 * base] <= v && v <= r[2 * base + 1] ? static_cast<int64_t>(base) : -1;
+    }
+
+    inline auto original::roaringBitmap::chunk::contains(const uint16_t v) const -> bool
+    {
+        switch (this->kind) {
+            case chunkKind::ARRAY: {
+                const uint32_t i = this->lowerBound(v);
+                return i < this->values.size() && this->raw()[i] == v;
+            }
+            case chunkKind::BITMAP:
+                return this->rawWords()[v / 64] >> v % 64 & 1;
+            default:
+                return this->runOf(v) >= 0;
+        }
+    }
+
+    inline auto original::roaringBitmap::chunk::add(const uint16_t v) -> bool
+    {
+        if (this->kind == chunkKind::RUN) {
+            if (this->runOf(v) >= 0) return false;
+            this->expandRuns();
+        }
+        if (this->kind == chunkKind::BITMAP) {
+            uint64_t& w = this->rawWords()[v / 64];
+            const uint64_t mask = static_cast<uint64_t>(1) << v % 64;
+            if (w & mask) return false;
+            w |= mask;
+            this->cardinality += 1;
+            return true;
+        }
+
+        const uint32_t i = this->lowerBound(v);
+        if (i < this->values.size() && this->raw()[i] == v) return false;
+        this->values.push(i, v);
+        this->cardinality += 1;
+        this->normalize();
+        return true;
+    }
+
+    inline auto original::roaringBitmap::chunk::remove(const uint16_t v) -> bool
+    {
+        if (this->kind == chunkKind::RUN) {
+            if (this->runOf(v) < 0) return false;
+            this->expandRuns();
+        }
+        if (this->kind == chunkKind::BITMAP) {
+            uint64_t& w = this->rawWords()[v / 64];
+            const uint64_t mask = static_cast<uint64_t>(1) << v % 64;
+            if (!(w & mask)) return false;
+            w &= ~mask;
+            this->cardinality -= 1;
+            this->normalize();
+            return true;
+        }
+
+        const uint32_t i = this->lowerBound(v);
+        if (i == this->values.size() || this->raw()[i] != v) return false;
+        this->values.pop(i);
+        this->cardinality -= 1;
+        return true;
+    }
+
+    inline auto original::roaringBitmap::chunk::rank(const uint16_t v) const -> uint32_t
+    {
+        switch (this->kind) {
+            case chunkKind::ARRAY: {
+                const uint32_t i = this->lowerBound(v);
+                return i + (i < this->values.size() && this->raw()[i] == v ? 1 : 0);
+            }
+            case chunkKind::BITMAP: {
+                const uint64_t* w = this->rawWords();
+                const uint32_t whole = v / 64;
+                const uint64_t mask = v % 64 == 63 ? ~static_cast<uint64_t>(0)
+                                                   : (static_cast<uint64_t>(1) << (v % 64 + 1)) - 1;
+                return bitKernels::kernels().popcount(w, whole) + std::popcount(w[whole] & mask);
+            }
+            default: {
+                const uint16_t* r = this->raw();
+                uint32_t count = 0;
+                for (uint32_t i = 0; i < this->runs() && r[2 * i] <= v; ++i) {
+                    count += std::min(r[2 * i + 1], v) - r[2 * i] + 1;
+                }
+                return count;
+            }
+        }
+    }
+
+    inline auto original::roaringBitmap::chunk::select(uint32_t k) const -> uint16_t
+    {
+        switch (this->kind) {
+            case chunkKind::ARRAY:
+                return this->raw()[k];
+            case chunkKind::BITMAP: {
+                const uint64_t* w = this->rawWords();
+                uint32_t i = 0;
+                for (; static_cast<uint32_t>(std::popcount(w[i])) <= k; ++i) {
+                    k -= std::popcount(w[i]);
+                }
+                uint64_t bits = w[i];
+                for (; k > 0; --k) {
+                    bits &= bits - 1;
+                }
+                return i * 64 + std::countr_zero(bits);
+            }
+            default: {
+                const uint16_t* r = this->raw();
+                uint32_t i = 0;
+                for (; static_cast<uint32_t>(r[2 * i + 1] - r[2 * i] + 1) <= k; ++i) {
+                    k -= r[2 * i + 1] - r[2 * i] + 1;
+                }
+                return r[2 * i] + k;
+            }
+        }
+    }
+
+    inline auto original::roaringBitmap::chunk::toWords() const -> array<uint64_t>
+    {
+        if (this->kind == chunkKind::BITMAP) return this->words;
+
+        array<uint64_t> bits(BITMAP_WORDS);
+        uint64_t* w = &bits.data();
+        const uint16_t* r = this->raw();
+        if (this->kind == chunkKind::ARRAY) {
+            for (uint32_t i = 0; i < this->values.size(); ++i) {
+                w[r[i] / 64] |= static_cast<uint64_t>(1) << r[i] % 64;
+            }
+            return bits;
+        }
+        for (uint32_t i = 0; i < this->runs(); ++i) {
+            const uint32_t first = r[2 * i];
+            const uint32_t last = r[2 * i + 1];
+            const uint64_t first_mask = ~static_cast<uint64_t>(0) << first % 64;
+            const uint64_t last_mask = ~static_cast<uint64_t>(0) >> (63 - last % 64);
+            if (first / 64 == last / 64) {
+                w[first / 64] |= first_mask & last_mask;
+                continue;
+            }
+            w[first / 64] |= first_mask;
+            for (uint32_t j = first / 64 + 1; j < last / 64; ++j) {
+                w[j] = ~static_cast<uint64_t>(0);
+            }
+            w[last / 64] |= last_mask;
+        }
+        return bits;
+    }
+
+    inline auto original::roaringBitmap::chunk::setWords(array<uint64_t>&& bits, const uint32_t count) -> void
+    {
+        this->kind = chunkKind::BITMAP;
+        this->cardinality = count;
+        this->words = std::move(bits);
+        this->values.clear();
+        this->values.shrinkToFit();
+        this->normalize();
+    }
+
+    inline auto original::roaringBitmap::chunk::setValues(vector<uint16_t>&& sorted) -> void
+    {
+        this->kind = chunkKind::ARRAY;
+        this->cardinality = sorted.size();
+        this->values = std::move(sorted);
+        this->words = array<uint64_t>();
+        this->normalize();
+    }
+
+    inline auto original::roaringBitmap::chunk::expandRuns() -> void
+    {
+        if (this->kind != chunkKind::RUN) return;
+
+        if (this->cardinality > ARRAY_MAX_SIZE) {
+            this->setWords(this->toWords(), this->cardinality);
+            return;
+        }
+        vector<uint16_t> expanded;
+        expanded.reserve(this->cardinality);
+        const uint16_t* r = this->raw();
+        for (uint32_t i = 0; i < this->runs(); ++i) {
+            for (uint32_t v = r[2 * i]; v <= r[2 * i + 1]; ++v) {
+                expanded.pushEnd(static_cast<uint16_t>(v));
+            }
+        }
+        this->setValues(std::move(expanded));
+    }
+
+    // Keeps arrays at most ARRAY_MAX_SIZE values long and bitmaps above that, runs are left alone.
+    inline auto original::roaringBitmap::chunk::normalize() -> void
+    {
+        if (this->kind == chunkKind::ARRAY && this->cardinality > ARRAY_MAX_SIZE) {
+            this->words = this->toWords();
+            this->kind = chunkKind::BITMAP;
+            this->values.clear();
+            this->values.shrinkToFit();
+        } else if (this->kind == chunkKind::BITMAP && this->cardinality <= ARRAY_MAX_SIZE) {
+            vector<uint16_t> sorted;
+            sorted.reserve(this->cardinality);
+            const uint64_t* w = this->rawWords();
+            for (uint32_t i = 0; i < BITMAP_WORDS; ++i) {
+                for (uint64_t bits = w[i]; bits != 0; bits &= bits - 1) {
+                    sorted.pushEnd(static_cast<uint16_t>(i * 64 + std::countr_zero(bits)));
+                }
+            }
+            this->kind = chunkKind::ARRAY;
+            this->values = std::move(sorted);
+            this->words = array<uint64_t>();
+        }
+    }
+
+    inline auto original::roaringBitmap::chunk::countRuns() const -> uint32_t
+    {
+        switch (this->kind) {
+            case chunkKind::ARRAY: {
+                if (this->values.empty()) return 0;
+                const uint16_t* v = this->raw();
+                uint32_t count = 1;
+                for (uint32_t i = 1; i < this->values.size(); ++i) {
+                    count += v[i] != v[i - 1] + 1;
+                }
+                return count;
+            }
+            case chunkKind::BITMAP: {
+                // A run starts at every set bit whose lower neighbour is clear.
+                const uint64_t* w = this->rawWords();
+                uint64_t count = 0;
+                uint64_t carry = 0;
+                for (uint32_t i = 0; i < BITMAP_WORDS; ++i) {
+                    count += std::popcount(w[i] & ~(w[i] << 1 | carry));
+                    carry = w[i] >> 63;
+                }
+                return count;
+            }
+            default:
+                return this->runs();
+        }
+    }
+
+    inline auto original::roaringBitmap::chunk::runOptimize() -> bool
+    {
+        const uint32_t run_count = this->countRuns();
+        const uint64_t run_bytes = 4 * static_cast<uint64_t>(run_count);
+        const uint64_t plain_bytes = this->cardinality > ARRAY_MAX_SIZE ? BITMAP_WORDS * 8 : 2 * this->cardinality;
+        if (this->kind == chunkKind::RUN) {
+            if (run_bytes < plain_bytes) return false;
+            this->expandRuns();
+            return true;
+        }
+        if (run_bytes >= plain_bytes) return false;
+
+        vector<uint16_t> r;
+        r.reserve(2 * run_count);
+        bool open = false;
+        uint32_t previous = 0;
+        auto visit = [&](const uint32_t v) {
+            if (open && v == previous + 1) {
+                previous = v;
+                return;
+            }
+            if (open) r.pushEnd(static_cast<uint16_t>(previous));
+            r.pushEnd(static_cast<uint16_t>(v));
+            open = true;
+            previous = v;
+        };
+        if (this->kind == chunkKind::ARRAY) {
+            for (uint32_t i = 0; i < this->values.size(); ++i) visit(this->raw()[i]);
+        } else {
+            const uint64_t* w = this->rawWords();
+            for (uint32_t i = 0; i < BITMAP_WORDS; ++i) {
+                for (uint64_t bits = w[i]; bits != 0; bits &= bits - 1) {
+                    visit(i * 64 + std::countr_zero(bits));
+                }
+            }
+        }
+        if (open) r.pushEnd(static_cast<uint16_t>(previous));
+
+        this->kind = chunkKind::RUN;
+        this->values = std::move(r);
+        this->words = array<uint64_t>();
+        return true;
+    }
+
+    inline auto original::roaringBitmap::chunk::sizeInBytes() const -> uint64_t
+    {
+        switch (this->kind) {
+            case chunkKind::ARRAY:
+                return 2 * static_cast<uint64_t>(this->values.size());
+            case chunkKind::BITMAP:
+                return BITMAP_WORDS * 8;
+            default:
+                return 2 * static_cast<uint64_t>(this->values.size());
+        }
+    }
+
+    // The values of the array chunk arr that other holds, or that it does not hold.
+    inline auto original::roaringBitmap::chunk::filter(const chunk& arr, const chunk& other,
+                                                       const bool keep_contained) -> chunk
+    {
+        vector<uint16_t> kept;
+        kept.reserve(arr.cardinality);
+        const uint16_t* v = arr.raw();
+        for (uint32_t i = 0; i < arr.values.size(); ++i) {
+            if (other.contains(v[i]) == keep_contained)
+                kept.pushEnd(v[i]);
+        }
+        chunk res;
+        res.setValues(std::move(kept));
+        return res;
+    }
+
+    inline auto original::roaringBitmap::chunk::merge(const chunk& a, const chunk& b, const operation op) -> chunk
+    {
+        vector<uint16_t> merged;
+        merged.reserve(a.cardinality + b.cardinality);
+        const uint16_t* x = a.raw();
+        const uint16_t* y = b.raw();
+        uint32_t i = 0;
+        uint32_t j = 0;
+        while (i < a.values.size() && j < b.values.size()) {
+            if (x[i] < y[j]) {
+                merged.pushEnd(x[i++]);
+            } else if (y[j] < x[i]) {
+                merged.pushEnd(y[j++]);
+            } else {
+                if (op == operation::OR) merged.pushEnd(x[i]);
+                i += 1;
+                j += 1;
+            }
+        }
+        for (; i < a.values.size(); ++i) merged.pushEnd(x[i]);
+        for (; j < b.values.size(); ++j) merged.pushEnd(y[j]);
+        chunk res;
+        res.setValues(std::move(merged));
+        return res;
+    }
+
+    inline auto original::roaringBitmap::chunk::combine(const chunk& a, const chunk& b, const operation op) -> chunk
+    {
+        if (a.kind == chunkKind::RUN || b.kind == chunkKind::RUN) {
+            chunk ea = a;
+            chunk eb = b;
+            ea.expandRuns();
+            eb.expandRuns();
+            return combine(ea, eb, op);
+        }
+
+        if (a.kind == chunkKind::ARRAY && (op == operation::AND || op == operation::AND_NOT))
+            return filter(a, b, op == operation::AND);
+        if (b.kind == chunkKind::ARRAY && op == operation::AND)
+            return filter(b, a, true);
+        if (a.kind == chunkKind::ARRAY && b.kind == chunkKind::ARRAY)
+            return merge(a, b, op);
+
+        auto bits = a.toWords();
+        const auto other = b.toWords();
+        const auto& kernels = bitKernels::kernels();
+        switch (op) {
+            case operation::AND:
+                kernels.andWords(&bits.data(), &other.data(), BITMAP_WORDS);
+                break;
+            case operation::OR:
+                kernels.orWords(&bits.data(), &other.data(), BITMAP_WORDS);
+                break;
+            case operation::XOR:
+                kernels.xorWords(&bits.data(), &other.data(), BITMAP_WORDS);
+                break;
+            case operation::AND_NOT:
+                kernels.andNotWords(&bits.data(), &other.data(), BITMAP_WORDS);
+                break;
+        }
+        const uint32_t count = kernels.popcount(&bits.data(), BITMAP_WORDS);
+        chunk res;
+        res.setWords(std::move(bits), count);
+        return res;
+    }
+
+    inline auto original::roaringBitmap::chunk::compareTo(const chunk& other) const -> int64_t
+    {
+        if (this->cardinality != other.cardinality)
+            return this->cardinality < other.cardinality ? -1 : 1;
+        if (this->kind == chunkKind::ARRAY && other.kind == chunkKind::ARRAY)
+            return this->values.compareTo(other.values);
+
+        const auto bits = this->toWords();
+        const auto other_bits = other.toWords();
+        for (uint32_t i = 0; i < BITMAP_WORDS; ++i) {
+            if (bits.get(i) != other_bits.get(i))
+                return bits.get(i) < other_bits.get(i) ? -1 : 1;
+        }
+        return 0;
+    }
+
+    inline auto original::roaringBitmap::chunk::className() const -> std::string
+    {
+        return "roaringBitmap::chunk";
+    }
+
+    inline auto original::roaringBitmap::high(const uint32_t value) -> uint16_t
+    {
+        return value >> 16;
+    }
+
+    inline auto original::roaringBitmap::low(const uint32_t value) -> uint16_t
+    {
+        return value & 0xFFFF;
+    }
+
+    inline auto original::roaringBitmap::lowerBound(const uint16_t key) const -> uint32_t
+    {
+        const uint16_t* first = &this->keys_.data();
+        return searchSorted(first, this->keys_.size(), key);
+    }
+
+    // Index of the chunk of key, or -1.
+    inline auto original::roaringBitmap::chunkOf(const uint16_t key) const -> int64_t
+    {
+        const uint32_t i = this->lowerBound(key);
+        return i < this->keys_.size() && this->keys_.get(i) == key ? static_cast<int64_t>(i) : -1;
+    }
+
+    inline auto original::roaringBitmap::apply(const roaringBitmap& other, const operation op) -> void
+    {
+        if (this == &other) {
+            if (op == operation::XOR || op == operation::AND_NOT) this->clear();
+            return;
+        }
+
+        vector<uint16_t> keys;
+        vector<chunk> chunks;
+        uint32_t i = 0;
+        uint32_t j = 0;
+        const bool keep_left = op != operation::AND;
+        const bool keep_right = op == operation::OR || op == operation::XOR;
+        while (i < this->keys_.size() || j < other.keys_.size()) {
+            const bool has_left = i < this->keys_.size();
+            const bool has_right = j < other.keys_.size();
+            if (has_left && (!has_right || this->keys_.get(i) < other.keys_.get(j))) {
+                if (keep_left) {
+                    keys.pushEnd(this->keys_.get(i));
+                    chunks.pushEnd(std::move(this->chunks_[i]));
+                }
+                i += 1;
+            } else if (!has_left || other.keys_.get(j) < this->keys_.get(i)) {
+                if (keep_right) {
+                    keys.pushEnd(other.keys_.get(j));
+                    chunks.pushEnd(other.chunks_.get(j));
+                }
+                j += 1;
+            } else {
+                auto res = chunk::combine(this->chunks_[i], other.chunks_.get(j), op);
+                if (res.cardinality > 0) {
+                    keys.pushEnd(this->keys_.get(i));
+                    chunks.pushEnd(std::move(res));
+                }
+                i += 1;
+                j += 1;
+            }
+        }
+        this->keys_ = std::move(keys);
+        this->chunks_ = std::move(chunks);
+    }
+
+    template <typename T>
+    auto original::roaringBitmap::writeLE(std::string& out, T value) -> void
+    {
+        for (uint32_t i = 0; i < sizeof(T); ++i) {
+            out.push_back(static_cast<char>(value & 0xFF));
+            value = static_cast<T>(value >> 8 * (sizeof(T) > 1));
+        }
+    }
+
+    template <typename T>
+    auto original::roaringBitmap::readLE(const std::string& in, uint64_t& pos) -> T
+    {
+        if (pos + sizeof(T) > in.size()) throw valueError();
+
+        T value = 0;
+        for (uint32_t i = 0; i < sizeof(T); ++i) {
+            value |= static_cast<T>(static_cast<T>(static_cast<uint8_t>(in[pos + i])) << 8 * i);
+        }
+        pos += sizeof(T);
+        return value;
+    }
+
+    inline original::roaringBitmap::Iterator::Iterator(const roaringBitmap* container, const uint32_t index)
+        : container_(container), chunk_(), key_(), cur_chunk(), pos(), word(), cur_low()
+    {
+        this->enter(index);
+        this->settle();
+    }
+
+    inline auto original::roaringBitmap::Iterator::enter(const uint32_t index) -> void
+    {
+        this->cur_chunk = index;
+        this->pos = 0;
+        this->word = 0;
+        this->cur_low = 0;
+        if (index >= this->container_->chunks_.size()) {
+            this->chunk_ = nullptr;
+            return;
+        }
+
+        this->chunk_ = &this->container_->chunks_.data() + index;
+        this->key_ = static_cast<uint32_t>(this->container_->keys_.get(index)) << 16;
+        if (this->chunk_->kind == chunkKind::BITMAP) {
+            this->word = this->chunk_->rawWords()[0];
+        } else if (this->chunk_->kind == chunkKind::RUN) {
+            this->cur_low = this->chunk_->raw()[0];
+        }
+    }
+
+    // Moves to the next value at or after the current position, entering later chunks as needed.
+    inline auto original::roaringBitmap::Iterator::settle() -> void
+    {
+        while (this->chunk_) {
+            switch (this->chunk_->kind) {
+                case chunkKind::ARRAY:
+                    if (this->pos < this->chunk_->values.size()) return;
+                    break;
+                case chunkKind::BITMAP: {
+                    const uint64_t* w = this->chunk_->rawWords();
+                    while (this->word == 0 && ++this->pos < BITMAP_WORDS) {
+                        this->word = w[this->pos];
+                    }
+                    if (this->pos < BITMAP_WORDS) return;
+                    break;
+                }
+                case chunkKind::RUN:
+                    if (this->pos < this->chunk_->runs()) return;
+                    break;
+            }
+            this->enter(this->cur_chunk + 1);
+        }
+    }
+
+    inline auto original::roaringBitmap::Iterator::operator*() const -> uint32_t
+    {
+        switch (this->chunk_->kind) {
+            case chunkKind::ARRAY:
+                return this->key_ | this->chunk_->raw()[this->pos];
+            case chunkKind::BITMAP:
+                return this->key_ | (this->pos * 64 + std::countr_zero(this->word));
+            default:
+                return this->key_ | this->cur_low;
+        }
+    }
+
+    inline auto original::roaringBitmap::Iterator::operator++() -> Iterator&
+    {
+        switch (this->chunk_->kind) {
+            case chunkKind::ARRAY:
+                this->pos += 1;
+                if (this->pos < this->chunk_->values.size()) return *this;
+                break;
+            case chunkKind::BITMAP:
+                this->word &= this->word - 1;
+                if (this->word != 0) return *this;
+                break;
+            case chunkKind::RUN: {
+                const uint16_t* r = this->chunk_->raw();
+                if (this->cur_low != r[2 * this->pos + 1]) {
+                    this->cur_low += 1;
+                    return *this;
+                }
+                this->pos += 1;
+                if (this->pos < this->chunk_->runs()) {
+                    this->cur_low = r[2 * this->pos];
+                    return *this;
+                }
+                break;
+            }
+        }
+        this->settle();
+        return *this;
+    }
+
+    inline auto original::roaringBitmap::Iterator::operator==(const Iterator& other) const -> bool
+    {
+        return this->cur_chunk == other.cur_chunk && this->pos == other.pos
+            && this->word == other.word && this->cur_low == other.cur_low;
+    }
+
+    inline original::roaringBitmap::roaringBitmap() = default;
+
+    inline original::roaringBitmap::roaringBitmap(const std::initializer_list<uint32_t>& lst) : roaringBitmap()
+    {
+        for (const auto e : lst) {
+            this->add(e);
+        }
+    }
+
+    inline original::roaringBitmap::roaringBitmap(const bitSet& bs) : roaringBitmap()
+    {
+        for (const uint32_t i : bs.setBits()) {
+            this->add(i);
+        }
+    }
+
+    inline auto original::roaringBitmap::add(const uint32_t value) -> bool
+    {
+        const uint16_t key = high(value);
+        const uint32_t i = this->lowerBound(key);
+        if (i == this->keys_.size() || this->keys_.get(i) != key) {
+            this->keys_.push(i, key);
+            this->chunks_.push(i, chunk());
+        }
+        return this->chunks_[i].add(low(value));
+    }
+
+    inline auto original::roaringBitmap::remove(const uint32_t value) -> bool
+    {
+        const int64_t i = this->chunkOf(high(value));
+        if (i < 0 || !this->chunks_[i].remove(low(value))) return false;
+
+        if (this->chunks_[i].cardinality == 0) {
+            this->keys_.pop(i);
+            this->chunks_.pop(i);
+        }
+        return true;
+    }
+
+    inline auto original::roaringBitmap::contains(const uint32_t value) const -> bool
+    {
+        const int64_t i = this->chunkOf(high(value));
+        return i >= 0 && (&this->chunks_.data() + i)->contains(low(value));
+    }
+
+    inline auto original::roaringBitmap::cardinality() const -> uint64_t
+    {
+        uint64_t count = 0;
+        for (uint32_t i = 0; i < this->chunks_.size(); ++i) {
+            count += (&this->chunks_.data() + i)->cardinality;
+        }
+        return count;
+    }
+
+    inline auto original::roaringBitmap::empty() const -> bool
+    {
+        return this->keys_.empty();
+    }
+
+    inline auto original::roaringBitmap::clear() -> void
+    {
+        this->keys_.clear();
+        this->chunks_.clear();
+    }
+
+    inline auto original::roaringBitmap::rank(const uint32_t value) const -> uint64_t
+    {
+        const uint16_t key = high(value);
+        uint64_t count = 0;
+        for (uint32_t i = 0; i < this->chunks_.size() && this->keys_.get(i) <= key; ++i) {
+            const chunk& c = *(&this->chunks_.data() + i);
+            count += this->keys_.get(i) < key ? c.cardinality : c.rank(low(value));
+        }
+        return count;
+    }
+
+    inline auto original::roaringBitmap::select(uint64_t k) const -> uint32_t
+    {
+        for (uint32_t i = 0; i < this->chunks_.size(); ++i) {
+            const chunk& c = *(&this->chunks_.data() + i);
+            if (k < c.cardinality)
+                return static_cast<uint32_t>(this->keys_.get(i)) << 16 | c.select(k);
+            k -= c.cardinality;
+        }
+        throw outOfBoundError();
+    }
+
+    inline auto original::roaringBitmap::runOptimize() -> bool
+    {
+        bool changed = false;
+        for (uint32_t i = 0; i < this->chunks_.size(); ++i) {
+            changed = this->chunks_[i].runOptimize() || changed;
+        }
+        return changed;
+    }
+
+    inline auto original::roaringBitmap::sizeInBytes() const -> uint64_t
+    {
+        // Every chunk also costs its key and its kind and cardinality.
+        uint64_t bytes = 0;
+        for (uint32_t i = 0; i < this->chunks_.size(); ++i) {
+            bytes += 2 + 1 + 4 + (&this->chunks_.data() + i)->sizeInBytes();
+        }
+        return bytes;
+    }
+
+    inline auto original::roaringBitmap::kindOf(const uint32_t value) const -> chunkKind
+    {
+        const int64_t i = this->chunkOf(high(value));
+        if (i < 0) throw noElementError();
+        return (&this->chunks_.data() + i)->kind;
+    }
+
+    inline auto original::roaringBitmap::operator&=(const roaringBitmap& other) -> roaringBitmap&
+    {
+        this->apply(other, operation::AND);
+        return *this;
+    }
+
+    inline auto original::roaringBitmap::operator|=(const roaringBitmap& other) -> roaringBitmap&
+    {
+        this->apply(other, operation::OR);
+        return *this;
+    }
+
+    inline auto original::roaringBitmap::operator^=(const roaringBitmap& other) -> roaringBitmap&
+    {
+        this->apply(other, operation::XOR);
+        return *this;
+    }
+
+    inline auto original::roaringBitmap::andNot(const roaringBitmap& other) -> roaringBitmap&
+    {
+        this->apply(other, operation::AND_NOT);
+        return *this;
+    }
+
+    inline auto original::roaringBitmap::operator==(const roaringBitmap& other) const -> bool
+    {
+        return this->keys_ == other.keys_ && this->chunks_ == other.chunks_;
+    }
+
+    inline auto original::roaringBitmap::begin() const -> Iterator
+    {
+        return Iterator(this, 0);
+    }
+
+    inline auto original::roaringBitmap::end() const -> Iterator
+    {
+        return Iterator(this, this->chunks_.size());
+    }
+
+    inline auto original::roaringBitmap::serialize() const -> std::string
+    {
+        std::string out;
+        out.reserve(8 + this->sizeInBytes() + 4 * this->chunks_.size());
+        writeLE<uint32_t>(out, SERIAL_MAGIC);
+        writeLE<uint32_t>(out, this->chunks_.size());
+        for (uint32_t i = 0; i < this->chunks_.size(); ++i) {
+            const chunk& c = *(&this->chunks_.data() + i);
+            writeLE<uint16_t>(out, this->keys_.get(i));
+            writeLE<uint8_t>(out, static_cast<uint8_t>(c.kind));
+            writeLE<uint32_t>(out, c.cardinality);
+            if (c.kind == chunkKind::BITMAP) {
+                writeLE<uint32_t>(out, BITMAP_WORDS);
+                for (uint32_t j = 0; j < BITMAP_WORDS; ++j) {
+                    writeLE<uint64_t>(out, c.rawWords()[j]);
+                }
+            } else {
+                writeLE<uint32_t>(out, c.kind == chunkKind::RUN ? c.runs() : c.values.size());
+                for (uint32_t j = 0; j < c.values.size(); ++j) {
+                    writeLE<uint16_t>(out, c.raw()[j]);
+                }
+            }
+        }
+        return out;
+    }
+
+    inline auto original::roaringBitmap::deserialize(const std::string& data) -> roaringBitmap
+    {
+        uint64_t pos = 0;
+        if (readLE<uint32_t>(data, pos) != SERIAL_MAGIC) throw valueError();
+
+        roaringBitmap res;
+        const uint32_t count = readLE<uint32_t>(data, pos);
+        for (uint32_t i = 0; i < count; ++i) {
+            const uint16_t key = readLE<uint16_t>(data, pos);
+            const uint8_t kind = readLE<uint8_t>(data, pos);
+            if (!res.keys_.empty() && key <= res.keys_.get(-1)) throw valueError();
+            if (kind > static_cast<uint8_t>(chunkKind::RUN)) throw valueError();
+
+            chunk c;
+            c.kind = static_cast<chunkKind>(kind);
+            c.cardinality = readLE<uint32_t>(data, pos);
+            const uint32_t entries = readLE<uint32_t>(data, pos);
+            uint64_t counted = 0;
+            if (c.kind == chunkKind::BITMAP) {
+                if (entries != BITMAP_WORDS) throw valueError();
+                c.words = array<uint64_t>(BITMAP_WORDS);
+                for (uint32_t j = 0; j < BITMAP_WORDS; ++j) {
+                    c.rawWords()[j] = readLE<uint64_t>(data, pos);
+                    counted += std::popcount(c.rawWords()[j]);
+                }
+            } else {
+                if (c.kind == chunkKind::ARRAY && entries > ARRAY_MAX_SIZE) throw valueError();
+                const uint64_t values = c.kind == chunkKind::RUN ? 2 * static_cast<uint64_t>(entries) : entries;
+                if (pos + 2 * values > data.size()) throw valueError();
+                c.values.reserve(values);
+                for (uint64_t j = 0; j < values; ++j) {
+                    const uint16_t v = readLE<uint16_t>(data, pos);
+                    // Array values strictly increase, runs are ordered and separated by a gap.
+                    const bool ordered = c.kind == chunkKind::ARRAY
+                        ? j == 0 || v > c.values.get(-1)
+                        : j == 0 || (j % 2 == 1 ? v >= c.values.get(-1) : v > c.values.get(-1) + 1);
+                    if (!ordered) throw valueError();
+                    c.values.pushEnd(v);
+                }
+                counted = c.kind == chunkKind::ARRAY ? values : 0;
+                for (uint32_t j = 0; c.kind == chunkKind::RUN && j < entries; ++j) {
+                    counted += c.raw()[2 * j + 1] - c.raw()[2 * j] + 1;
+                }
+            }
+            if (counted != c.cardinality || counted == 0) throw valueError();
+            // Only the chunk kind the other operations expect for this cardinality.
+            if (c.kind == chunkKind::BITMAP && counted <= ARRAY_MAX_SIZE) throw valueError();
+            res.keys_.pushEnd(key);
+            res.chunks_.pushEnd(std::move(c));
+        }
+        if (pos != data.size()) throw valueError();
+        return res;
+    }
+
+    inline auto original::roaringBitmap::className() const -> std::string
+    {
+        return "roaringBitmap";
+    }
+
+    inline auto original::roaringBitmap::toString(const bool enter) const -> std::string
+    {
+        std::stringstream ss;
+        ss << this->className() << "(";
+        bool first = true;
+        for (const uint32_t e : *this) {
+            if (!first) ss << ", ";
+            ss << e;
+            first = false;
+        }
+        ss << ")";
+        if (enter) ss << "\n";
+        return ss.str();
+    }
+
+    inline auto original::operator&(const roaringBitmap& lrb, const roaringBitmap& rrb) -> roaringBitmap
+    {
+        roaringBitmap rb(lrb);
+        return rb &= rrb;
+    }
+
+    inline auto original::operator|(const roaringBitmap& lrb, const roaringBitmap& rrb) -> roaringBitmap
+    {
+        roaringBitmap rb(lrb);
+        return rb |= rrb;
+    }
+
+    inline auto original::operator^(const roaringBitmap& lrb, const roaringBitmap& rrb) -> roaringBitmap
+    {
+        roaringBitmap rb(lrb);
+        return rb ^= rrb;
+    }
+
+#endif //ROARINGBITMAP_H
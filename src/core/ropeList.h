@@ -0,0 +1,910 @@
+#ifndef ROPELIST_H
+#define ROPELIST_H
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <new>
+#include "array.h"
+#include "baseList.h"
+#include "error.h"
+#include "iterationStream.h"
+
+/**
+ * @file ropeList.h
+ * @brief List with logarithmic indexed access, insertion and removal.
+ */
+
+namespace original {
+
+    /**
+     * @class ropeList
+     * @brief A B+-tree of element chunks, indexed by the number of elements below each child.
+     * @details Leaves hold up to about 1KB of elements in place and are linked to each other,
+     *          inner nodes hold up to 32 children together with the element count of every child.
+     *          get, set, push and pop at any index descend from the root by these counts, so they
+     *          cost O(log n) plus a shift inside one leaf, where vector and blocksList shift O(n)
+     *          elements and chain walks O(n) nodes. Walking the list with an iterator stays inside
+     *          the leaves and costs O(1) per step.
+     *
+     *          Nodes are split on the way down before an insertion reaches a full one, and refilled
+     *          from a sibling or merged with it on the way down before a removal reaches one that is
+     *          only half full, so every node but the root stays at least half full.
+     *
+     *          Iterators are invalidated by every push or pop.
+     */
+    template<typename TYPE>
+    class ropeList final : public baseList<TYPE>, public iterationStream<TYPE, ropeList<TYPE>>{
+        struct node {
+            uint32_t len;
+        };
+
+        struct leafNode final : node {
+            static constexpr uint32_t MAX = std::max<uint32_t>(16, 1024 / sizeof(TYPE)) / 2 * 2;
+            static constexpr uint32_t MIN = MAX / 2;
+
+            leafNode* prev;
+            leafNode* next;
+            alignas(TYPE) unsigned char storage[MAX * sizeof(TYPE)];
+
+            leafNode();
+            TYPE* elems();
+        };
+
+        struct innerNode final : node {
+            static constexpr uint32_t MAX = 32;
+            static constexpr uint32_t MIN = MAX / 2;
+
+            uint32_t counts[MAX];
+            node* children[MAX];
+
+            innerNode();
+        };
+
+        node* root_;
+        leafNode* first_;
+        leafNode* last_;
+        uint32_t height_;
+        uint32_t size_;
+
+        void ropeListInit();
+        void ropeListDestruct();
+        static void destroyNode(node* n, uint32_t level);
+        static void relocate(TYPE* src, uint32_t len, TYPE* dst);
+        static void moveSlots(leafNode* src, uint32_t from, uint32_t len, leafNode* dst, uint32_t to);
+        static void moveSlots(innerNode* src, uint32_t from, uint32_t len, innerNode* dst, uint32_t to);
+        static uint32_t slotWeight(leafNode* n, uint32_t slot);
+        static uint32_t slotWeight(const innerNode* n, uint32_t slot);
+        void link(leafNode* left, leafNode* right);
+        static void link(innerNode* left, innerNode* right);
+        void unlink(leafNode* n);
+        static void unlink(innerNode* n);
+        static uint32_t childAt(const innerNode* parent, uint32_t& index);
+        template<typename NODE>
+        void splitChild(innerNode* parent, uint32_t slot);
+        template<typename NODE>
+        void mergeChildren(innerNode* parent, uint32_t slot);
+        template<typename NODE>
+        uint32_t refillChild(innerNode* parent, uint32_t slot, uint32_t& index);
+        leafNode* findLeaf(uint32_t& index) const;
+        void insertAt(uint32_t index, TYPE&& e);
+        TYPE eraseAt(uint32_t index);
+    public:
+        class Iterator final : public baseIterator<TYPE>
+        {
+            mutable leafNode* leaf_;
+            mutable int64_t pos_;
+            mutable int64_t index_;
+            const ropeList* container_;
+
+            explicit Iterator(leafNode* leaf, int64_t pos, int64_t index, const ropeList* container);
+            void seek() const;
+            bool equalPtr(const iterator<TYPE> *other) const override;
+        public:
+            friend ropeList;
+            Iterator(const Iterator& other);
+            Iterator& operator=(const Iterator& other);
+            Iterator* clone() const override;
+            [[nodiscard]] bool hasNext() const override;
+            [[nodiscard]] bool hasPrev() const override;
+            void next() const override;
+            void prev() const override;
+            void operator+=(int64_t steps) const override;
+            void operator-=(int64_t steps) const override;
+            int64_t operator-(const iterator<TYPE>& other) const override;
+            Iterator* getPrev() const override;
+            Iterator* getNext() const override;
+            TYPE& get() override;
+            TYPE get() const override;
+            void set(const TYPE &data) override;
+            [[nodiscard]] bool isValid() const override;
+            bool atPrev(const iterator<TYPE> *other) const override;
+            bool atNext(const iterator<TYPE> *other) const override;
+            [[nodiscard]] std::string className() const override;
+        };
+
+        friend Iterator;
+        explicit ropeList();
+        ropeList(const std::initializer_list<TYPE>& lst);
+        explicit ropeList(const array<TYPE>& arr);
+        ropeList(const ropeList& other);
+        ropeList& operator=(const ropeList& other);
+        ropeList(ropeList&& other) noexcept;
+        ropeList& operator=(ropeList&& other) noexcept;
+        [[nodiscard]] uint32_t size() const override;
+
+        /**
+         * @brief Number of levels below the root, 0 while all elements fit into one leaf.
+         */
+        [[nodiscard]] uint32_t height() const;
+
+        TYPE get(int64_t index) const override;
+        TYPE& operator[](int64_t index) override;
+        void set(int64_t index, const TYPE &e) override;
+        uint32_t indexOf(const TYPE &e) const override;
+        void clear() override;
+        void push(int64_t index, const TYPE &e) override;
+        void push(int64_t index, TYPE &&e) override;
+        TYPE pop(int64_t index) override;
+        void pushBegin(const TYPE &e) override;
+        void pushBegin(TYPE &&e) override;
+        TYPE popBegin() override;
+        void pushEnd(const TYPE &e) override;
+        void pushEnd(TYPE &&e) override;
+        TYPE popEnd() override;
+        template<typename... Args>
+        void emplace(int64_t index, Args&&... args);
+        template<typename... Args>
+        void emplaceBegin(Args&&... args);
+        template<typename... Args>
+        void emplaceEnd(Args&&... args);
+        Iterator* begins() const override;
+        Iterator* ends() const override;
+        [[nodiscard]] std::string className() const override;
+        ~ropeList() override;
+    };
+}
+
+    template <typename TYPE>
+    original::ropeList<TYPE>::leafNode::leafNode() : node{0}, prev(nullptr), next(nullptr) {}
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::leafNode::elems() -> TYPE*
+    {
+        return std::launder(reinterpret_cast<TYPE*>(this->storage));
+    }
+
+    template <typename TYPE>
+    original::ropeList<TYPE>::innerNode::innerNode() : node{0}, counts(), children() {}
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::ropeListInit() -> void
+    {
+        auto* leaf = new leafNode();
+        this->root_ = leaf;
+        this->first_ = leaf;
+        this->last_ = leaf;
+        this->height_ = 0;
+        this->size_ = 0;
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::ropeListDestruct() -> void
+    {
+        if (this->root_ == nullptr)
+            return;
+        destroyNode(this->root_, this->height_);
+        this->root_ = nullptr;
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::destroyNode(node* n, const uint32_t level) -> void
+    {
+        if (level == 0) {
+            auto* leaf = static_cast<leafNode*>(n);
+            std::destroy_n(leaf->elems(), leaf->len);
+            delete leaf;
+            return;
+        }
+        auto* inner = static_cast<innerNode*>(n);
+        for (uint32_t i = 0; i < inner->len; ++i) {
+            destroyNode(inner->children[i], level - 1);
+        }
+        delete inner;
+    }
+
+    // Moves len live elements from src to dst, which may overlap. The slots of src that are not
+    // overwritten are left raw.
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::relocate(TYPE* src, const uint32_t len, TYPE* dst) -> void
+    {
+        if (len == 0 || src == dst)
+            return;
+
+        if constexpr (std::is_trivially_copyable_v<TYPE>) {
+            std::memmove(dst, src, len * sizeof(TYPE));
+        } else if (std::less<TYPE*>{}(src, dst)) {
+            for (uint32_t i = len; i > 0; --i) {
+                std::construct_at(dst + i - 1, std::move(src[i - 1]));
+                std::destroy_at(src + i - 1);
+            }
+        } else {
+            for (uint32_t i = 0; i < len; ++i) {
+                std::construct_at(dst + i, std::move(src[i]));
+                std::destroy_at(src + i);
+            }
+        }
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::moveSlots(leafNode* src, const uint32_t from, const uint32_t len,
+                                             leafNode* dst, const uint32_t to) -> void
+    {
+        relocate(src->elems() + from, len, dst->elems() + to);
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::moveSlots(innerNode* src, const uint32_t from, const uint32_t len,
+                                             innerNode* dst, const uint32_t to) -> void
+    {
+        std::memmove(dst->counts + to, src->counts + from, len * sizeof(uint32_t));
+        std::memmove(dst->children + to, src->children + from, len * sizeof(node*));
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::slotWeight(leafNode*, uint32_t) -> uint32_t
+    {
+        return 1;
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::slotWeight(const innerNode* n, const uint32_t slot) -> uint32_t
+    {
+        return n->counts[slot];
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::link(leafNode* left, leafNode* right) -> void
+    {
+        right->prev = left;
+        right->next = left->next;
+        if (left->next != nullptr) {
+            left->next->prev = right;
+        } else {
+            this->last_ = right;
+        }
+        left->next = right;
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::link(innerNode*, innerNode*) -> void {}
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::unlink(leafNode* n) -> void
+    {
+        if (n->prev != nullptr) {
+            n->prev->next = n->next;
+        } else {
+            this->first_ = n->next;
+        }
+        if (n->next != nullptr) {
+            n->next->prev = n->prev;
+        } else {
+            this->last_ = n->prev;
+        }
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::unlink(innerNode*) -> void {}
+
+    // Slot of the child holding the index-th element below parent, index is made relative to
+    // that child. An index one past the last element lands in the last child.
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::childAt(const innerNode* parent, uint32_t& index) -> uint32_t
+    {
+        uint32_t slot = 0;
+        while (slot + 1 < parent->len && index >= parent->counts[slot]) {
+            index -= parent->counts[slot];
+            slot += 1;
+        }
+        return slot;
+    }
+
+    // Moves the upper half of the full child at slot into a new sibling right after it.
+    template <typename TYPE>
+    template <typename NODE>
+    auto original::ropeList<TYPE>::splitChild(innerNode* parent, const uint32_t slot) -> void
+    {
+        auto* left = static_cast<NODE*>(parent->children[slot]);
+        auto* right = new NODE();
+        const uint32_t half = left->len / 2;
+        uint32_t moved = 0;
+        for (uint32_t i = half; i < left->len; ++i) {
+            moved += slotWeight(left, i);
+        }
+        moveSlots(left, half, left->len - half, right, 0);
+        right->len = left->len - half;
+        left->len = half;
+        this->link(left, right);
+
+        moveSlots(parent, slot + 1, parent->len - slot - 1, parent, slot + 2);
+        parent->children[slot + 1] = right;
+        parent->counts[slot + 1] = moved;
+        parent->counts[slot] -= moved;
+        parent->len += 1;
+    }
+
+    // Appends the child at slot + 1 to the one at slot and frees it.
+    template <typename TYPE>
+    template <typename NODE>
+    auto original::ropeList<TYPE>::mergeChildren(innerNode* parent, const uint32_t slot) -> void
+    {
+        auto* left = static_cast<NODE*>(parent->children[slot]);
+        auto* right = static_cast<NODE*>(parent->children[slot + 1]);
+        moveSlots(right, 0, right->len, left, left->len);
+        left->len += right->len;
+        this->unlink(right);
+        delete right;
+
+        parent->counts[slot] += parent->counts[slot + 1];
+        moveSlots(parent, slot + 2, parent->len - slot - 2, parent, slot + 1);
+        parent->len -= 1;
+    }
+
+    // Makes sure the child at slot can lose a slot without dropping under half full, by taking one
+    // from a sibling that has some to spare or else merging with a sibling. Returns the slot of the
+    // child that now holds the index-th element and makes index relative to it.
+    template <typename TYPE>
+    template <typename NODE>
+    auto original::ropeList<TYPE>::refillChild(innerNode* parent, const uint32_t slot, uint32_t& index) -> uint32_t
+    {
+        auto* child = static_cast<NODE*>(parent->children[slot]);
+        if (child->len > NODE::MIN || parent->len == 1)
+            return slot;
+
+        if (slot > 0 && static_cast<NODE*>(parent->children[slot - 1])->len > NODE::MIN) {
+            auto* left = static_cast<NODE*>(parent->children[slot - 1]);
+            moveSlots(child, 0, child->len, child, 1);
+            moveSlots(left, left->len - 1, 1, child, 0);
+            left->len -= 1;
+            child->len += 1;
+            const uint32_t moved = slotWeight(child, 0);
+            parent->counts[slot - 1] -= moved;
+            parent->counts[slot] += moved;
+            index += moved;
+            return slot;
+        }
+        if (slot + 1 < parent->len && static_cast<NODE*>(parent->children[slot + 1])->len > NODE::MIN) {
+            auto* right = static_cast<NODE*>(parent->children[slot + 1]);
+            moveSlots(right, 0, 1, child, child->len);
+            moveSlots(right, 1, right->len - 1, right, 0);
+            right->len -= 1;
+            child->len += 1;
+            const uint32_t moved = slotWeight(child, child->len - 1);
+            parent->counts[slot + 1] -= moved;
+            parent->counts[slot] += moved;
+            return slot;
+        }
+        if (slot > 0) {
+            index += parent->counts[slot - 1];
+            this->template mergeChildren<NODE>(parent, slot - 1);
+            return slot - 1;
+        }
+        this->template mergeChildren<NODE>(parent, slot);
+        return slot;
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::findLeaf(uint32_t& index) const -> leafNode*
+    {
+        node* cur = this->root_;
+        for (uint32_t level = this->height_; level > 0; --level) {
+            auto* inner = static_cast<innerNode*>(cur);
+            cur = inner->children[childAt(inner, index)];
+        }
+        return static_cast<leafNode*>(cur);
+    }
+
+    // Splits every full node on the way down, so the parent of a split always has room left.
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::insertAt(uint32_t index, TYPE&& e) -> void
+    {
+        const bool root_full = this->height_ == 0 ?
+            this->root_->len == leafNode::MAX : this->root_->len == innerNode::MAX;
+        if (root_full) {
+            auto* root = new innerNode();
+            root->len = 1;
+            root->children[0] = this->root_;
+            root->counts[0] = this->size_;
+            if (this->height_ == 0) {
+                this->template splitChild<leafNode>(root, 0);
+            } else {
+                this->template splitChild<innerNode>(root, 0);
+            }
+            this->root_ = root;
+            this->height_ += 1;
+        }
+
+        node* cur = this->root_;
+        for (uint32_t level = this->height_; level > 0; --level) {
+            auto* inner = static_cast<innerNode*>(cur);
+            uint32_t slot = childAt(inner, index);
+            if (level == 1 && inner->children[slot]->len == leafNode::MAX) {
+                this->template splitChild<leafNode>(inner, slot);
+            } else if (level > 1 && inner->children[slot]->len == innerNode::MAX) {
+                this->template splitChild<innerNode>(inner, slot);
+            }
+            if (index > inner->counts[slot] || (index == inner->counts[slot] && slot + 1 < inner->len)) {
+                index -= inner->counts[slot];
+                slot += 1;
+            }
+            inner->counts[slot] += 1;
+            cur = inner->children[slot];
+        }
+
+        auto* leaf = static_cast<leafNode*>(cur);
+        relocate(leaf->elems() + index, leaf->len - index, leaf->elems() + index + 1);
+        std::construct_at(leaf->elems() + index, std::move(e));
+        leaf->len += 1;
+        this->size_ += 1;
+    }
+
+    // Refills every node on the way down that could drop under half full, and drops the root
+    // once it is left with a single child.
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::eraseAt(uint32_t index) -> TYPE
+    {
+        node* cur = this->root_;
+        for (uint32_t level = this->height_; level > 0; --level) {
+            auto* inner = static_cast<innerNode*>(cur);
+            uint32_t slot = childAt(inner, index);
+            if (level == 1) {
+                slot = this->template refillChild<leafNode>(inner, slot, index);
+            } else {
+                slot = this->template refillChild<innerNode>(inner, slot, index);
+            }
+            inner->counts[slot] -= 1;
+            cur = inner->children[slot];
+            if (inner == this->root_ && inner->len == 1) {
+                this->root_ = cur;
+                this->height_ -= 1;
+                delete inner;
+            }
+        }
+
+        auto* leaf = static_cast<leafNode*>(cur);
+        TYPE res = std::move(leaf->elems()[index]);
+        std::destroy_at(leaf->elems() + index);
+        relocate(leaf->elems() + index + 1, leaf->len - index - 1, leaf->elems() + index);
+        leaf->len -= 1;
+        this->size_ -= 1;
+        return res;
+    }
+
+    template <typename TYPE>
+    original::ropeList<TYPE>::Iterator::Iterator(leafNode* leaf, const int64_t pos, const int64_t index,
+                                                 const ropeList* container)
+        : leaf_(leaf), pos_(pos), index_(index), container_(container) {}
+
+    // Finds the leaf of index_ again after a jump. Positions outside the list are kept relative to
+    // the first or the last leaf, so stepping back into the list works as usual.
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::Iterator::seek() const -> void
+    {
+        if (this->index_ < 0) {
+            this->leaf_ = this->container_->first_;
+            this->pos_ = this->index_;
+        } else if (this->index_ >= this->container_->size()) {
+            this->leaf_ = this->container_->last_;
+            this->pos_ = this->index_ - this->container_->size() + this->leaf_->len;
+        } else {
+            auto index = static_cast<uint32_t>(this->index_);
+            this->leaf_ = this->container_->findLeaf(index);
+            this->pos_ = index;
+        }
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::Iterator::equalPtr(const iterator<TYPE>* other) const -> bool
+    {
+        auto* other_it = dynamic_cast<const Iterator*>(other);
+        return other_it != nullptr
+               && this->container_ == other_it->container_
+               && this->index_ == other_it->index_;
+    }
+
+    template <typename TYPE>
+    original::ropeList<TYPE>::Iterator::Iterator(const Iterator& other)
+        : leaf_(nullptr), pos_(0), index_(0), container_(nullptr)
+    {
+        this->operator=(other);
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::Iterator::operator=(const Iterator& other) -> Iterator&
+    {
+        if (this == &other)
+            return *this;
+
+        this->leaf_ = other.leaf_;
+        this->pos_ = other.pos_;
+        this->index_ = other.index_;
+        this->container_ = other.container_;
+        return *this;
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::Iterator::clone() const -> Iterator*
+    {
+        return new Iterator(*this);
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::Iterator::hasNext() const -> bool
+    {
+        return this->index_ < static_cast<int64_t>(this->container_->size()) - 1;
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::Iterator::hasPrev() const -> bool
+    {
+        return this->index_ > 0;
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::Iterator::next() const -> void
+    {
+        this->index_ += 1;
+        this->pos_ += 1;
+        if (this->pos_ >= this->leaf_->len && this->leaf_->next != nullptr) {
+            this->leaf_ = this->leaf_->next;
+            this->pos_ = 0;
+        }
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::Iterator::prev() const -> void
+    {
+        this->index_ -= 1;
+        this->pos_ -= 1;
+        if (this->pos_ < 0 && this->leaf_->prev != nullptr) {
+            this->leaf_ = this->leaf_->prev;
+            this->pos_ = this->leaf_->len - 1;
+        }
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::Iterator::operator+=(const int64_t steps) const -> void
+    {
+        this->index_ += steps;
+        if (this->pos_ + steps >= 0 && this->pos_ + steps < this->leaf_->len) {
+            this->pos_ += steps;
+        } else {
+            this->seek();
+        }
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::Iterator::operator-=(const int64_t steps) const -> void
+    {
+        this->operator+=(-steps);
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::Iterator::operator-(const iterator<TYPE>& other) const -> int64_t
+    {
+        auto* other_it = dynamic_cast<const Iterator*>(&other);
+        if (other_it == nullptr)
+            return this > &other ?
+                std::numeric_limits<int64_t>::max() :
+                std::numeric_limits<int64_t>::min();
+        if (this->container_ != other_it->container_)
+            return this->container_ > other_it->container_ ?
+                std::numeric_limits<int64_t>::max() :
+                std::numeric_limits<int64_t>::min();
+
+        return this->index_ - other_it->index_;
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::Iterator::getPrev() const -> Iterator*
+    {
+        if (!this->isValid()) throw outOfBoundError();
+        auto* it = this->clone();
+        it->prev();
+        return it;
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::Iterator::getNext() const -> Iterator*
+    {
+        if (!this->isValid()) throw outOfBoundError();
+        auto* it = this->clone();
+        it->next();
+        return it;
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::Iterator::get() -> TYPE&
+    {
+        if (!this->isValid()) throw outOfBoundError();
+        return this->leaf_->elems()[this->pos_];
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::Iterator::get() const -> TYPE
+    {
+        if (!this->isValid()) throw outOfBoundError();
+        return this->leaf_->elems()[this->pos_];
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::Iterator::set(const TYPE& data) -> void
+    {
+        if (!this->isValid()) throw outOfBoundError();
+        this->leaf_->elems()[this->pos_] = data;
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::Iterator::isValid() const -> bool
+    {
+        return this->index_ >= 0 && this->index_ < this->container_->size();
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::Iterator::atPrev(const iterator<TYPE>* other) const -> bool
+    {
+        auto* other_it = dynamic_cast<const Iterator*>(other);
+        if (other_it == nullptr)
+            return false;
+        return this->operator-(*other_it) == -1;
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::Iterator::atNext(const iterator<TYPE>* other) const -> bool
+    {
+        auto* other_it = dynamic_cast<const Iterator*>(other);
+        if (other_it == nullptr)
+            return false;
+        return this->operator-(*other_it) == 1;
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::Iterator::className() const -> std::string
+    {
+        return "ropeList::Iterator";
+    }
+
+    template <typename TYPE>
+    original::ropeList<TYPE>::ropeList()
+        : root_(nullptr), first_(nullptr), last_(nullptr), height_(), size_()
+    {
+        this->ropeListInit();
+    }
+
+    template <typename TYPE>
+    original::ropeList<TYPE>::ropeList(const std::initializer_list<TYPE>& lst) : ropeList()
+    {
+        for (const auto& e : lst) {
+            this->pushEnd(e);
+        }
+    }
+
+    template <typename TYPE>
+    original::ropeList<TYPE>::ropeList(const array<TYPE>& arr) : ropeList()
+    {
+        for (uint32_t i = 0; i < arr.size(); ++i) {
+            this->pushEnd(arr.get(i));
+        }
+    }
+
+    template <typename TYPE>
+    original::ropeList<TYPE>::ropeList(const ropeList& other) : ropeList()
+    {
+        this->operator=(other);
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::operator=(const ropeList& other) -> ropeList&
+    {
+        if (this == &other)
+            return *this;
+
+        this->clear();
+        for (auto* leaf = other.first_; leaf != nullptr; leaf = leaf->next) {
+            for (uint32_t i = 0; i < leaf->len; ++i) {
+                this->pushEnd(leaf->elems()[i]);
+            }
+        }
+        return *this;
+    }
+
+    template <typename TYPE>
+    original::ropeList<TYPE>::ropeList(ropeList&& other) noexcept : ropeList()
+    {
+        this->operator=(std::move(other));
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::operator=(ropeList&& other) noexcept -> ropeList&
+    {
+        if (this == &other)
+            return *this;
+
+        this->ropeListDestruct();
+        this->root_ = other.root_;
+        this->first_ = other.first_;
+        this->last_ = other.last_;
+        this->height_ = other.height_;
+        this->size_ = other.size_;
+        other.ropeListInit();
+        return *this;
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::size() const -> uint32_t
+    {
+        return this->size_;
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::height() const -> uint32_t
+    {
+        return this->height_;
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::get(const int64_t index) const -> TYPE
+    {
+        if (this->indexOutOfBound(index)) throw outOfBoundError();
+        auto inner_idx = static_cast<uint32_t>(this->parseNegIndex(index));
+        return this->findLeaf(inner_idx)->elems()[inner_idx];
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::operator[](const int64_t index) -> TYPE&
+    {
+        if (this->indexOutOfBound(index)) throw outOfBoundError();
+        auto inner_idx = static_cast<uint32_t>(this->parseNegIndex(index));
+        return this->findLeaf(inner_idx)->elems()[inner_idx];
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::set(const int64_t index, const TYPE& e) -> void
+    {
+        if (this->indexOutOfBound(index)) throw outOfBoundError();
+        auto inner_idx = static_cast<uint32_t>(this->parseNegIndex(index));
+        this->findLeaf(inner_idx)->elems()[inner_idx] = e;
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::indexOf(const TYPE& e) const -> uint32_t
+    {
+        uint32_t index = 0;
+        for (auto* leaf = this->first_; leaf != nullptr; leaf = leaf->next) {
+            for (uint32_t i = 0; i < leaf->len; ++i, ++index) {
+                if (leaf->elems()[i] == e)
+                    return index;
+            }
+        }
+        return this->size();
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::clear() -> void
+    {
+        this->ropeListDestruct();
+        this->ropeListInit();
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::push(const int64_t index, const TYPE& e) -> void
+    {
+        this->emplace(index, e);
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::push(const int64_t index, TYPE&& e) -> void
+    {
+        this->emplace(index, std::move(e));
+    }
+
+    template <typename TYPE>
+    template <typename... Args>
+    auto original::ropeList<TYPE>::emplace(const int64_t index, Args&&... args) -> void
+    {
+        const int64_t parsed = this->parseNegIndex(index);
+        if (parsed < 0 || parsed > this->size())
+            throw outOfBoundError();
+
+        // args may refer to an element that is about to be shifted
+        this->insertAt(static_cast<uint32_t>(parsed), TYPE(std::forward<Args>(args)...));
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::pop(const int64_t index) -> TYPE
+    {
+        if (this->indexOutOfBound(index)) throw outOfBoundError();
+        return this->eraseAt(static_cast<uint32_t>(this->parseNegIndex(index)));
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::pushBegin(const TYPE& e) -> void
+    {
+        this->emplaceBegin(e);
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::pushBegin(TYPE&& e) -> void
+    {
+        this->emplaceBegin(std::move(e));
+    }
+
+    template <typename TYPE>
+    template <typename... Args>
+    auto original::ropeList<TYPE>::emplaceBegin(Args&&... args) -> void
+    {
+        this->insertAt(0, TYPE(std::forward<Args>(args)...));
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::popBegin() -> TYPE
+    {
+        if (this->empty()) throw noElementError();
+        return this->eraseAt(0);
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::pushEnd(const TYPE& e) -> void
+    {
+        this->emplaceEnd(e);
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::pushEnd(TYPE&& e) -> void
+    {
+        this->emplaceEnd(std::move(e));
+    }
+
+    template <typename TYPE>
+    template <typename... Args>
+    auto original::ropeList<TYPE>::emplaceEnd(Args&&... args) -> void
+    {
+        this->insertAt(this->size(), TYPE(std::forward<Args>(args)...));
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::popEnd() -> TYPE
+    {
+        if (this->empty()) throw noElementError();
+        return this->eraseAt(this->size() - 1);
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::begins() const -> Iterator*
+    {
+        return new Iterator(this->first_, 0, 0, this);
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::ends() const -> Iterator*
+    {
+        return new Iterator(this->last_, static_cast<int64_t>(this->last_->len) - 1,
+                            static_cast<int64_t>(this->size()) - 1, this);
+    }
+
+    template <typename TYPE>
+    auto original::ropeList<TYPE>::className() const -> std::string
+    {
+        return "ropeList";
+    }
+
+    template <typename TYPE>
+    original::ropeList<TYPE>::~ropeList()
+    {
+        this->ropeListDestruct();
+    }
+
+#endif //ROPELIST_H
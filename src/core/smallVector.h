@@ -0,0 +1,636 @@
+#ifndef SMALLVECTOR_H
+#define SMALLVECTOR_H
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include "baseList.h"
+#include "iterationStream.h"
+#include "array.h"
+#include "span.h"
+
+/**
+ * @file smallVector.h
+ * @brief Vector keeping its first elements inside the object.
+ */
+
+namespace original{
+
+    /**
+     * @class smallVector
+     * @brief A vector that stores up to N elements inline and only allocates past them.
+     * @details Most short lists never need the heap buffer a vector allocates on construction.
+     *          A smallVector keeps up to N elements in storage inside the object, moves them to
+     *          the heap when a push goes past N and grows like a vector from there on.
+     *          shrinkToFit() brings them back inline once they fit again.
+     *
+     *          Elements sit contiguously from the start of the buffer, so pushing or popping at
+     *          the beginning shifts the others, which is cheap at the sizes this is meant for.
+     *          Moving a smallVector steals a heap buffer but has to move inline elements one by
+     *          one, and invalidates iterators into the inline storage of the source.
+     */
+    template <typename TYPE, uint32_t N = 8>
+    class smallVector final : public baseList<TYPE>, public iterationStream<TYPE, smallVector<TYPE, N>>{
+        static_assert(N > 0, "a smallVector needs room for at least one inline element");
+
+        alignas(TYPE) unsigned char storage[N * sizeof(TYPE)];
+        TYPE* body;
+        uint32_t size_;
+        uint32_t max_size;
+
+        void smallVectorInit();
+        void smallVectorDestruct();
+        TYPE* inlineBody();
+        static TYPE* heapArrayInit(uint32_t size);
+        static void heapArrayFree(TYPE* arr, uint32_t size);
+        static void moveElements(TYPE* old_body, uint32_t idx,
+                                 uint32_t len, TYPE* new_body, int64_t offset);
+        void grow(uint32_t new_size);
+        void adjust(uint32_t increment);
+
+    public:
+        class Iterator final : public randomAccessIterator<TYPE>
+        {
+                explicit Iterator(TYPE* ptr, const smallVector* container, int64_t pos);
+            public:
+                friend smallVector;
+                Iterator(const Iterator& other);
+                Iterator& operator=(const Iterator& other);
+                Iterator* clone() const override;
+                bool atPrev(const iterator<TYPE> *other) const override;
+                bool atNext(const iterator<TYPE> *other) const override;
+                [[nodiscard]] std::string className() const override;
+        };
+
+        explicit smallVector();
+        smallVector(const smallVector& other);
+        smallVector(const std::initializer_list<TYPE>& list);
+        explicit smallVector(const array<TYPE>& arr);
+        smallVector(const iterator<TYPE>& begin, const iterator<TYPE>& end);
+        smallVector& operator=(const smallVector& other);
+        smallVector(smallVector&& other) noexcept;
+        smallVector& operator=(smallVector&& other) noexcept;
+        [[nodiscard]] uint32_t size() const override;
+        [[nodiscard]] uint32_t capacity() const;
+        [[nodiscard]] static constexpr uint32_t inlineCapacity();
+        [[nodiscard]] bool isInline() const;
+        void reserve(uint32_t new_capacity);
+        void shrinkToFit();
+        TYPE& data() const;
+        TYPE* fastBegin();
+        TYPE* fastEnd();
+        const TYPE* fastBegin() const;
+        const TYPE* fastEnd() const;
+        span<TYPE> asSpan();
+        span<const TYPE> asSpan() const;
+        TYPE get(int64_t index) const override;
+        TYPE& operator[](int64_t index) override;
+        void set(int64_t index, const TYPE &e) override;
+        uint32_t indexOf(const TYPE &e) const override;
+        void pushBegin(const TYPE &e) override;
+        void pushBegin(TYPE &&e) override;
+        void push(int64_t index, const TYPE &e) override;
+        void push(int64_t index, TYPE &&e) override;
+        void pushEnd(const TYPE &e) override;
+        void pushEnd(TYPE &&e) override;
+        void pushEnd(const iterator<TYPE>& begin, const iterator<TYPE>& end);
+        template<typename... Args>
+        void emplace(int64_t index, Args&&... args);
+        template<typename... Args>
+        void emplaceBegin(Args&&... args);
+        template<typename... Args>
+        void emplaceEnd(Args&&... args);
+        TYPE popBegin() override;
+        TYPE pop(int64_t index) override;
+        TYPE popEnd() override;
+        Iterator* begins() const override;
+        Iterator* ends() const override;
+        [[nodiscard]] std::string className() const override;
+        ~smallVector() override;
+    };
+
+    // smallVector with its default inline capacity as a single parameter template, which the container adapters
+    // accept as their list also on compilers without relaxed template template argument matching.
+    template <typename TYPE>
+    using defaultSmallVector = smallVector<TYPE>;
+}
+
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::smallVectorInit() -> void
+    {
+        this->body = this->inlineBody();
+        this->size_ = 0;
+        this->max_size = N;
+    }
+
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::smallVectorDestruct() -> void
+    {
+        std::destroy_n(this->body, this->size_);
+        if (!this->isInline()) {
+            smallVector::heapArrayFree(this->body, this->max_size);
+        }
+    }
+
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::inlineBody() -> TYPE*
+    {
+        return std::launder(reinterpret_cast<TYPE*>(this->storage));
+    }
+
+    // Allocates raw storage for size elements, no element is constructed.
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::heapArrayInit(const uint32_t size) -> TYPE* {
+        return std::allocator<TYPE>{}.allocate(size);
+    }
+
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::heapArrayFree(TYPE* arr, const uint32_t size) -> void {
+        std::allocator<TYPE>{}.deallocate(arr, size);
+    }
+
+    // Relocates len live elements starting at old_body[idx] to new_body[idx + offset], the same
+    // way vector does. The destination slots must be raw or part of the relocated range itself,
+    // and the source slots that are not overwritten are left raw.
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::moveElements(TYPE* old_body, const uint32_t idx,
+                                                      const uint32_t len, TYPE* new_body, const int64_t offset) -> void{
+        if (len == 0 || (offset == 0 && old_body == new_body))
+            return;
+
+        if constexpr (std::is_trivially_copyable_v<TYPE>)
+        {
+            std::memmove(new_body + idx + offset, old_body + idx, len * sizeof(TYPE));
+        }else if (offset > 0)
+        {
+            for (uint32_t i = 0; i < len; i += 1)
+            {
+                TYPE* src = old_body + idx + len - 1 - i;
+                std::construct_at(new_body + idx + offset + len - 1 - i, std::move(*src));
+                std::destroy_at(src);
+            }
+        }else
+        {
+            for (uint32_t i = 0; i < len; i += 1)
+            {
+                TYPE* src = old_body + idx + i;
+                std::construct_at(new_body + idx + offset + i, std::move(*src));
+                std::destroy_at(src);
+            }
+        }
+    }
+
+    // Moves the elements into a buffer of new_size slots, which is the inline storage when
+    // new_size is at most N.
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::grow(const uint32_t new_size) -> void
+    {
+        TYPE* new_body = new_size <= N ? this->inlineBody() : smallVector::heapArrayInit(new_size);
+        if (new_body == this->body)
+            return;
+
+        smallVector::moveElements(this->body, 0, this->size(), new_body, 0);
+        if (!this->isInline()) {
+            smallVector::heapArrayFree(this->body, this->max_size);
+        }
+        this->body = new_body;
+        this->max_size = std::max(new_size, N);
+    }
+
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::adjust(const uint32_t increment) -> void {
+        if (this->size() + increment <= this->max_size) {
+            return;
+        }
+        this->grow(std::max(this->size() + increment, this->max_size * 2));
+    }
+
+    template <typename TYPE, uint32_t N>
+    original::smallVector<TYPE, N>::Iterator::Iterator(TYPE* ptr, const smallVector* container, int64_t pos)
+        : randomAccessIterator<TYPE>(ptr, container, pos) {}
+
+    template <typename TYPE, uint32_t N>
+    original::smallVector<TYPE, N>::Iterator::Iterator(const Iterator& other)
+        : randomAccessIterator<TYPE>(nullptr, nullptr, 0)
+    {
+        this->operator=(other);
+    }
+
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::Iterator::operator=(const Iterator& other) -> Iterator&
+    {
+        if (this == &other) {
+            return *this;
+        }
+        randomAccessIterator<TYPE>::operator=(other);
+        return *this;
+    }
+
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::Iterator::clone() const -> Iterator* {
+        return new Iterator(*this);
+    }
+
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::Iterator::atPrev(const iterator<TYPE> *other) const -> bool {
+        auto other_it = dynamic_cast<const Iterator*>(other);
+        return other_it != nullptr && this->_ptr + 1 == other_it->_ptr;
+    }
+
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::Iterator::atNext(const iterator<TYPE> *other) const -> bool {
+        auto other_it = dynamic_cast<const Iterator*>(other);
+        return other_it != nullptr && other_it->_ptr + 1 == this->_ptr;
+    }
+
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::Iterator::className() const -> std::string {
+        return "smallVector::Iterator";
+    }
+
+    template <typename TYPE, uint32_t N>
+    original::smallVector<TYPE, N>::smallVector() : body(), size_(), max_size()
+    {
+        this->smallVectorInit();
+    }
+
+    template <typename TYPE, uint32_t N>
+    original::smallVector<TYPE, N>::smallVector(const smallVector& other) : smallVector(){
+        this->operator=(other);
+    }
+
+    template <typename TYPE, uint32_t N>
+    original::smallVector<TYPE, N>::smallVector(const std::initializer_list<TYPE>& list) : smallVector()
+    {
+        this->reserve(list.size());
+        for (const TYPE& e: list)
+        {
+            std::construct_at(this->body + this->size(), e);
+            this->size_ += 1;
+        }
+    }
+
+    // Keeps the current buffer when it is large enough for the elements of other.
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::operator=(const smallVector& other) -> smallVector&
+    {
+        if (this == &other)
+            return *this;
+
+        std::destroy_n(this->body, this->size_);
+        this->size_ = 0;
+        this->reserve(other.size());
+        for (uint32_t i = 0; i < other.size(); ++i) {
+            std::construct_at(this->body + i, other.body[i]);
+            this->size_ += 1;
+        }
+        return *this;
+    }
+
+    template <typename TYPE, uint32_t N>
+    original::smallVector<TYPE, N>::smallVector(smallVector&& other) noexcept : smallVector()
+    {
+        this->operator=(std::move(other));
+    }
+
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::operator=(smallVector&& other) noexcept -> smallVector&
+    {
+        if (this == &other)
+            return *this;
+
+        this->smallVectorDestruct();
+        this->smallVectorInit();
+        if (other.isInline()) {
+            smallVector::moveElements(other.body, 0, other.size(), this->body, 0);
+        } else {
+            this->body = other.body;
+            this->max_size = other.max_size;
+        }
+        this->size_ = other.size_;
+        other.smallVectorInit();
+        return *this;
+    }
+
+    template <typename TYPE, uint32_t N>
+    original::smallVector<TYPE, N>::smallVector(const array<TYPE>& arr) : smallVector()
+    {
+        this->reserve(arr.size());
+        for (uint32_t i = 0; i < arr.size(); i += 1)
+        {
+            std::construct_at(this->body + i, arr.get(i));
+            this->size_ += 1;
+        }
+    }
+
+    template <typename TYPE, uint32_t N>
+    original::smallVector<TYPE, N>::smallVector(const iterator<TYPE>& begin, const iterator<TYPE>& end) : smallVector()
+    {
+        this->pushEnd(begin, end);
+    }
+
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::size() const -> uint32_t
+    {
+        return this->size_;
+    }
+
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::capacity() const -> uint32_t
+    {
+        return this->max_size;
+    }
+
+    template <typename TYPE, uint32_t N>
+    constexpr auto original::smallVector<TYPE, N>::inlineCapacity() -> uint32_t
+    {
+        return N;
+    }
+
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::isInline() const -> bool
+    {
+        return this->body == reinterpret_cast<const TYPE*>(this->storage);
+    }
+
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::reserve(const uint32_t new_capacity) -> void
+    {
+        if (new_capacity <= this->capacity())
+            return;
+
+        this->grow(new_capacity);
+    }
+
+    // Moves the elements back inline when they fit, otherwise into a heap buffer of their size.
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::shrinkToFit() -> void
+    {
+        if (this->isInline() || this->size() == this->max_size)
+            return;
+
+        this->grow(this->size());
+    }
+
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::data() const -> TYPE& {
+        return this->body[0];
+    }
+
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::fastBegin() -> TYPE* {
+        return this->body;
+    }
+
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::fastEnd() -> TYPE* {
+        return this->body + this->size();
+    }
+
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::fastBegin() const -> const TYPE* {
+        return this->body;
+    }
+
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::fastEnd() const -> const TYPE* {
+        return this->body + this->size();
+    }
+
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::asSpan() -> span<TYPE> {
+        return span<TYPE>(this->body, this->size());
+    }
+
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::asSpan() const -> span<const TYPE> {
+        return span<const TYPE>(this->body, this->size());
+    }
+
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::get(const int64_t index) const -> TYPE
+    {
+        if (this->indexOutOfBound(index))
+        {
+            throw outOfBoundError();
+        }
+        return this->body[this->parseNegIndex(index)];
+    }
+
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::operator[](const int64_t index) -> TYPE&
+    {
+        if (this->indexOutOfBound(index))
+        {
+            throw outOfBoundError();
+        }
+        return this->body[this->parseNegIndex(index)];
+    }
+
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::set(const int64_t index, const TYPE &e) -> void
+    {
+        if (this->indexOutOfBound(index))
+        {
+            throw outOfBoundError();
+        }
+        this->body[this->parseNegIndex(index)] = e;
+    }
+
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::indexOf(const TYPE &e) const -> uint32_t
+    {
+        for (uint32_t i = 0; i < this->size(); i += 1)
+        {
+            if (this->body[i] == e)
+            {
+                return i;
+            }
+        }
+        return this->size();
+    }
+
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::pushBegin(const TYPE &e) -> void
+    {
+        this->emplaceBegin(e);
+    }
+
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::pushBegin(TYPE &&e) -> void
+    {
+        this->emplaceBegin(std::move(e));
+    }
+
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::push(const int64_t index, const TYPE &e) -> void
+    {
+        this->emplace(index, e);
+    }
+
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::push(const int64_t index, TYPE &&e) -> void
+    {
+        this->emplace(index, std::move(e));
+    }
+
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::pushEnd(const TYPE &e) -> void
+    {
+        this->emplaceEnd(e);
+    }
+
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::pushEnd(TYPE &&e) -> void
+    {
+        this->emplaceEnd(std::move(e));
+    }
+
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::pushEnd(const iterator<TYPE>& begin, const iterator<TYPE>& end) -> void
+    {
+        uint32_t len = 0;
+        auto* it = begin.clone();
+        for (; it->isValid() && !it->equal(end); it->next())
+        {
+            len += 1;
+        }
+        delete it;
+
+        this->reserve(this->size() + len);
+        it = begin.clone();
+        for (uint32_t i = 0; i < len; i += 1, it->next())
+        {
+            std::construct_at(this->body + this->size(), it->getElem());
+            this->size_ += 1;
+        }
+        delete it;
+    }
+
+    template <typename TYPE, uint32_t N>
+    template <typename... Args>
+    auto original::smallVector<TYPE, N>::emplaceBegin(Args&&... args) -> void
+    {
+        // args may refer to an element of this vector, build the new one before shifting them
+        TYPE e(std::forward<Args>(args)...);
+        this->adjust(1);
+        smallVector::moveElements(this->body, 0, this->size(), this->body, 1);
+        std::construct_at(this->body, std::move(e));
+        this->size_ += 1;
+    }
+
+    template <typename TYPE, uint32_t N>
+    template <typename... Args>
+    auto original::smallVector<TYPE, N>::emplace(int64_t index, Args&&... args) -> void
+    {
+        if (this->parseNegIndex(index) == this->size())
+        {
+            this->emplaceEnd(std::forward<Args>(args)...);
+        }else if (this->parseNegIndex(index) == 0)
+        {
+            this->emplaceBegin(std::forward<Args>(args)...);
+        }else
+        {
+            if (this->indexOutOfBound(index))
+            {
+                throw outOfBoundError();
+            }
+            TYPE e(std::forward<Args>(args)...);
+            this->adjust(1);
+            const uint32_t idx = this->parseNegIndex(index);
+            smallVector::moveElements(this->body, idx, this->size() - idx, this->body, 1);
+            std::construct_at(this->body + idx, std::move(e));
+            this->size_ += 1;
+        }
+    }
+
+    template <typename TYPE, uint32_t N>
+    template <typename... Args>
+    auto original::smallVector<TYPE, N>::emplaceEnd(Args&&... args) -> void
+    {
+        if (this->size() == this->max_size)
+        {
+            TYPE e(std::forward<Args>(args)...);
+            this->adjust(1);
+            std::construct_at(this->body + this->size(), std::move(e));
+        }else
+        {
+            std::construct_at(this->body + this->size(), std::forward<Args>(args)...);
+        }
+        this->size_ += 1;
+    }
+
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::popBegin() -> TYPE
+    {
+        if (this->size() == 0){
+            throw noElementError();
+        }
+        TYPE res = std::move(this->body[0]);
+        std::destroy_at(this->body);
+        smallVector::moveElements(this->body, 1, this->size() - 1, this->body, -1);
+        this->size_ -= 1;
+        return res;
+    }
+
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::pop(int64_t index) -> TYPE
+    {
+        if (this->parseNegIndex(index) == 0)
+        {
+            return this->popBegin();
+        }
+        if (this->parseNegIndex(index) == this->size() - 1)
+        {
+            return this->popEnd();
+        }
+        if (this->indexOutOfBound(index)){
+            throw outOfBoundError();
+        }
+        const uint32_t idx = this->parseNegIndex(index);
+        TYPE res = std::move(this->body[idx]);
+        std::destroy_at(this->body + idx);
+        smallVector::moveElements(this->body, idx + 1, this->size() - 1 - idx, this->body, -1);
+        this->size_ -= 1;
+        return res;
+    }
+
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::popEnd() -> TYPE
+    {
+        if (this->size() == 0){
+            throw noElementError();
+        }
+        TYPE* last = this->body + this->size() - 1;
+        TYPE res = std::move(*last);
+        std::destroy_at(last);
+        this->size_ -= 1;
+        return res;
+    }
+
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::begins() const -> Iterator* {
+        return new Iterator(this->body, this, 0);
+    }
+
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::ends() const -> Iterator* {
+        // An empty smallVector keeps body at its storage, which must not be moved before the first slot.
+        TYPE* last = this->size() == 0 ? this->body : this->body + this->size() - 1;
+        return new Iterator(last, this, static_cast<int64_t>(this->size()) - 1);
+    }
+
+    template <typename TYPE, uint32_t N>
+    auto original::smallVector<TYPE, N>::className() const -> std::string
+    {
+        return "smallVector";
+    }
+
+    template <typename TYPE, uint32_t N>
+    original::smallVector<TYPE, N>::~smallVector() {
+        this->smallVectorDestruct();
+    }
+
+#endif //SMALLVECTOR_H
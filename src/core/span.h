@@ -0,0 +1,282 @@
+#ifndef SPAN_H
+#define SPAN_H
+
+#include "baseArray.h"
+#include "iterationStream.h"
+#include "randomAccessIterator.h"
+#include "error.h"
+#include <type_traits>
+
+/**
+ * @file span.h
+ * @brief Non owning view over contiguous elements.
+ */
+
+namespace original{
+
+    /**
+     * @class span
+     * @brief A pointer and a length over elements owned by someone else.
+     * @details vector, array and the blocks of blocksList hand out spans over their live
+     *          elements, so a buffer can go to memcpy, a compression library or a SIMD kernel
+     *          without an element-wise copy. Copying a span copies the view, not the elements,
+     *          and a const span still allows writing to them. A span<const TYPE> is read-only,
+     *          const owners hand out those, and set() on it throws unSupportedMethodError.
+     *
+     *          A span does not keep its owner alive and is invalidated by anything that
+     *          reallocates or moves the owner's elements, such as a push into a vector.
+     */
+    template<typename TYPE>
+    class span final : public iterationStream<TYPE, span<TYPE>>, public baseArray<TYPE>{
+        TYPE* data_;
+        uint32_t size_;
+
+    public:
+        class Iterator final : public randomAccessIterator<TYPE>
+        {
+            explicit Iterator(TYPE* ptr, const span* container, int64_t pos);
+        public:
+            friend span;
+            Iterator(const Iterator& other);
+            Iterator& operator=(const Iterator& other);
+            Iterator* clone() const override;
+            bool atPrev(const iterator<TYPE> *other) const override;
+            bool atNext(const iterator<TYPE> *other) const override;
+            [[nodiscard]] std::string className() const override;
+        };
+
+        /**
+         * @brief Empty span.
+         */
+        span();
+
+        /**
+         * @brief Span over the size elements starting at data.
+         */
+        span(TYPE* data, uint32_t size);
+
+        /**
+         * @brief Read-only view of the elements of a writable span.
+         */
+        template<typename O>
+        requires std::is_same_v<const O, TYPE>
+        span(const span<O>& other);
+
+        span(const span& other) = default;
+        span& operator=(const span& other) = default;
+
+        [[nodiscard]] uint32_t size() const override;
+
+        /**
+         * @brief Size of the viewed elements in bytes.
+         */
+        [[nodiscard]] uint64_t sizeInBytes() const;
+
+        /**
+         * @brief Pointer to the first element, null for a default constructed span.
+         */
+        TYPE* data() const;
+        TYPE* fastBegin() const;
+        TYPE* fastEnd() const;
+
+        /**
+         * @brief View of count elements starting at offset.
+         * @throw outOfBoundError if the view would reach past the end of this span.
+         */
+        span subspan(uint32_t offset, uint32_t count) const;
+
+        /**
+         * @brief View of the elements in [begin, end), where negative positions count from the end.
+         * @throw outOfBoundError if begin comes after end or either lies outside of this span.
+         */
+        span slice(int64_t begin, int64_t end) const;
+
+        TYPE get(int64_t index) const override;
+        TYPE& operator[](int64_t index) override;
+        void set(int64_t index, const TYPE &e) override;
+        uint32_t indexOf(const TYPE &e) const override;
+        Iterator* begins() const override;
+        Iterator* ends() const override;
+        [[nodiscard]] std::string className() const override;
+    };
+
+    /**
+     * @brief fast() over a span, which may be a temporary since the range only points into its owner.
+     */
+    template<typename TYPE>
+    fastRange<TYPE*> fast(const span<TYPE>& range);
+}
+
+    template <typename TYPE>
+    original::span<TYPE>::Iterator::Iterator(TYPE* ptr, const span* container, int64_t pos)
+        : randomAccessIterator<TYPE>(ptr, container, pos) {}
+
+    template <typename TYPE>
+    original::span<TYPE>::Iterator::Iterator(const Iterator& other)
+        : randomAccessIterator<TYPE>(nullptr, nullptr, 0)
+    {
+        this->operator=(other);
+    }
+
+    template <typename TYPE>
+    auto original::span<TYPE>::Iterator::operator=(const Iterator& other) -> Iterator&
+    {
+        if (this == &other) {
+            return *this;
+        }
+        randomAccessIterator<TYPE>::operator=(other);
+        return *this;
+    }
+
+    template<typename TYPE>
+    auto original::span<TYPE>::Iterator::clone() const -> Iterator* {
+        return new Iterator(*this);
+    }
+
+    template<typename TYPE>
+    auto original::span<TYPE>::Iterator::atPrev(const iterator<TYPE> *other) const -> bool {
+        auto other_it = dynamic_cast<const Iterator*>(other);
+        return other_it != nullptr && this->_ptr + 1 == other_it->_ptr;
+    }
+
+    template<typename TYPE>
+    auto original::span<TYPE>::Iterator::atNext(const iterator<TYPE> *other) const -> bool {
+        auto other_it = dynamic_cast<const Iterator*>(other);
+        return other_it != nullptr && other_it->_ptr + 1 == this->_ptr;
+    }
+
+    template<typename TYPE>
+    auto original::span<TYPE>::Iterator::className() const -> std::string {
+        return "span::Iterator";
+    }
+
+    template <typename TYPE>
+    original::span<TYPE>::span() : data_(nullptr), size_(0) {}
+
+    template <typename TYPE>
+    original::span<TYPE>::span(TYPE* data, const uint32_t size) : data_(data), size_(size) {}
+
+    template <typename TYPE>
+    template <typename O>
+    requires std::is_same_v<const O, TYPE>
+    original::span<TYPE>::span(const span<O>& other) : data_(other.data()), size_(other.size()) {}
+
+    template <typename TYPE>
+    auto original::span<TYPE>::size() const -> uint32_t
+    {
+        return this->size_;
+    }
+
+    template <typename TYPE>
+    auto original::span<TYPE>::sizeInBytes() const -> uint64_t
+    {
+        return static_cast<uint64_t>(this->size_) * sizeof(TYPE);
+    }
+
+    template <typename TYPE>
+    auto original::span<TYPE>::data() const -> TYPE*
+    {
+        return this->data_;
+    }
+
+    template <typename TYPE>
+    auto original::span<TYPE>::fastBegin() const -> TYPE*
+    {
+        return this->data_;
+    }
+
+    template <typename TYPE>
+    auto original::span<TYPE>::fastEnd() const -> TYPE*
+    {
+        return this->data_ + this->size_;
+    }
+
+    template <typename TYPE>
+    auto original::span<TYPE>::subspan(const uint32_t offset, const uint32_t count) const -> span
+    {
+        if (static_cast<uint64_t>(offset) + count > this->size_) {
+            throw outOfBoundError();
+        }
+        return span(this->data_ + offset, count);
+    }
+
+    template <typename TYPE>
+    auto original::span<TYPE>::slice(const int64_t begin, const int64_t end) const -> span
+    {
+        const int64_t first = this->parseNegIndex(begin);
+        const int64_t last = this->parseNegIndex(end);
+        if (first < 0 || first > last || last > this->size_) {
+            throw outOfBoundError();
+        }
+        return span(this->data_ + first, static_cast<uint32_t>(last - first));
+    }
+
+    template <typename TYPE>
+    auto original::span<TYPE>::get(const int64_t index) const -> TYPE
+    {
+        if (this->indexOutOfBound(index)){
+            throw outOfBoundError();
+        }
+        return this->data_[this->parseNegIndex(index)];
+    }
+
+    template <typename TYPE>
+    auto original::span<TYPE>::operator[](const int64_t index) -> TYPE&
+    {
+        if (this->indexOutOfBound(index)){
+            throw outOfBoundError();
+        }
+        return this->data_[this->parseNegIndex(index)];
+    }
+
+    template <typename TYPE>
+    auto original::span<TYPE>::set(const int64_t index, const TYPE &e) -> void
+    {
+        if (this->indexOutOfBound(index)){
+            throw outOfBoundError();
+        }
+        if constexpr (std::is_const_v<TYPE>) {
+            throw unSupportedMethodError();
+        } else {
+            this->data_[this->parseNegIndex(index)] = e;
+        }
+    }
+
+    template <typename TYPE>
+    auto original::span<TYPE>::indexOf(const TYPE &e) const -> uint32_t
+    {
+        for (uint32_t i = 0; i < this->size_; i += 1)
+        {
+            if (this->data_[i] == e)
+            {
+                return i;
+            }
+        }
+        return this->size_;
+    }
+
+    template<typename TYPE>
+    auto original::span<TYPE>::begins() const -> Iterator* {
+        return new Iterator(this->data_, this, 0);
+    }
+
+    template<typename TYPE>
+    auto original::span<TYPE>::ends() const -> Iterator* {
+        // Empty spans may hold a null pointer, which must not be moved before the first element.
+        TYPE* last = this->size_ == 0 ? this->data_ : this->data_ + this->size_ - 1;
+        return new Iterator(last, this, static_cast<int64_t>(this->size_) - 1);
+    }
+
+    template <typename TYPE>
+    auto original::span<TYPE>::className() const -> std::string
+    {
+        return "span";
+    }
+
+    template <typename TYPE>
+    auto original::fast(const span<TYPE>& range) -> fastRange<TYPE*>
+    {
+        return fastRange<TYPE*>(range.fastBegin(), range.fastEnd());
+    }
+
+#endif //SPAN_H
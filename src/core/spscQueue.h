@@ -0,0 +1,261 @@
+#ifndef SPSCQUEUE_H
+#define SPSCQUEUE_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include "error.h"
+
+/**
+ * @file spscQueue.h
+ * @brief Bounded lock-free queue for exactly one producer thread and one consumer thread.
+ */
+
+namespace original {
+
+    /**
+     * @class spscQueue
+     * @tparam TYPE Type of the elements
+     * @brief Bounded ring buffer queue shared by one producer and one consumer without locks.
+     * @details The producer only writes the tail index and the consumer only writes the head
+     *          index, each on its own cache line. Both sides keep a private copy of the other
+     *          index and reload it only when the copy says the queue is full or empty, so in
+     *          steady state the two threads hardly touch each other's cache lines.
+     *
+     *          push methods may only be called from the producer thread and pop methods only
+     *          from the consumer thread. The capacity is rounded up to a power of two, at most 2^31.
+     */
+    template<typename TYPE>
+    class spscQueue {
+        static constexpr std::size_t CACHE_LINE = 64;
+
+        TYPE* body_;
+        uint64_t max_size_;
+        alignas(CACHE_LINE) std::atomic<uint64_t> head_;
+        uint64_t cached_tail_;
+        alignas(CACHE_LINE) std::atomic<uint64_t> tail_;
+        uint64_t cached_head_;
+
+        [[nodiscard]] TYPE* slot(uint64_t index) const;
+        [[nodiscard]] uint32_t freeSlots(uint32_t wanted);
+        [[nodiscard]] uint32_t readySlots(uint32_t wanted);
+    public:
+        explicit spscQueue(uint32_t capacity = 1024);
+        spscQueue(const spscQueue& other) = delete;
+        spscQueue& operator=(const spscQueue& other) = delete;
+        ~spscQueue();
+
+        [[nodiscard]] uint32_t capacity() const;
+
+        /**
+         * @brief Number of queued elements, only a snapshot while the other thread runs.
+         */
+        [[nodiscard]] uint32_t size() const;
+        [[nodiscard]] bool empty() const;
+
+        /**
+         * @brief Appends e unless the queue is full.
+         * @return false when full, e is then left untouched.
+         */
+        bool tryPush(const TYPE& e);
+        bool tryPush(TYPE&& e);
+
+        /**
+         * @brief Takes the head element into e unless the queue is empty.
+         * @return false when empty.
+         */
+        bool tryPop(TYPE& e);
+
+        /**
+         * @brief Appends as many of the n elements of src as fit, in order.
+         * @return Number of elements pushed.
+         */
+        uint32_t pushBatch(const TYPE* src, uint32_t n);
+
+        /**
+         * @brief Moves up to n elements from the head into dst.
+         * @return Number of elements popped.
+         */
+        uint32_t popBatch(TYPE* dst, uint32_t n);
+
+        /**
+         * @brief Appends e, yielding the thread while the queue is full.
+         */
+        void push(const TYPE& e);
+        void push(TYPE&& e);
+
+        /**
+         * @brief Takes the head element, yielding the thread while the queue is empty.
+         */
+        TYPE pop();
+    };
+}
+
+    template <typename TYPE>
+    original::spscQueue<TYPE>::spscQueue(const uint32_t capacity)
+        : body_(nullptr), max_size_(1), head_(0), cached_tail_(0), tail_(0), cached_head_(0)
+    {
+        // Anything above 2^31 would round up past what capacity() can report.
+        if (capacity == 0 || capacity > 1u << 31)
+            throw valueError();
+        while (this->max_size_ < capacity) {
+            this->max_size_ *= 2;
+        }
+        this->body_ = std::allocator<TYPE>{}.allocate(this->max_size_);
+    }
+
+    template <typename TYPE>
+    original::spscQueue<TYPE>::~spscQueue()
+    {
+        const uint64_t tail = this->tail_.load(std::memory_order_relaxed);
+        for (uint64_t i = this->head_.load(std::memory_order_relaxed); i != tail; ++i) {
+            std::destroy_at(this->slot(i));
+        }
+        std::allocator<TYPE>{}.deallocate(this->body_, this->max_size_);
+    }
+
+    template <typename TYPE>
+    auto original::spscQueue<TYPE>::slot(const uint64_t index) const -> TYPE*
+    {
+        return this->body_ + (index & (this->max_size_ - 1));
+    }
+
+    // Producer side: free slots after the tail, reloading the head only if the cached one is short.
+    template <typename TYPE>
+    auto original::spscQueue<TYPE>::freeSlots(const uint32_t wanted) -> uint32_t
+    {
+        const uint64_t tail = this->tail_.load(std::memory_order_relaxed);
+        uint64_t free = this->max_size_ - (tail - this->cached_head_);
+        if (free < wanted) {
+            this->cached_head_ = this->head_.load(std::memory_order_acquire);
+            free = this->max_size_ - (tail - this->cached_head_);
+        }
+        return free < wanted ? free : wanted;
+    }
+
+    // Consumer side: elements ready at the head, reloading the tail only if the cached one is short.
+    template <typename TYPE>
+    auto original::spscQueue<TYPE>::readySlots(const uint32_t wanted) -> uint32_t
+    {
+        const uint64_t head = this->head_.load(std::memory_order_relaxed);
+        uint64_t ready = this->cached_tail_ - head;
+        if (ready < wanted) {
+            this->cached_tail_ = this->tail_.load(std::memory_order_acquire);
+            ready = this->cached_tail_ - head;
+        }
+        return ready < wanted ? ready : wanted;
+    }
+
+    template <typename TYPE>
+    auto original::spscQueue<TYPE>::capacity() const -> uint32_t
+    {
+        return this->max_size_;
+    }
+
+    template <typename TYPE>
+    auto original::spscQueue<TYPE>::size() const -> uint32_t
+    {
+        const uint64_t head = this->head_.load(std::memory_order_acquire);
+        return this->tail_.load(std::memory_order_acquire) - head;
+    }
+
+    template <typename TYPE>
+    auto original::spscQueue<TYPE>::empty() const -> bool
+    {
+        return this->size() == 0;
+    }
+
+    template <typename TYPE>
+    auto original::spscQueue<TYPE>::tryPush(const TYPE& e) -> bool
+    {
+        if (this->freeSlots(1) == 0)
+            return false;
+        const uint64_t tail = this->tail_.load(std::memory_order_relaxed);
+        std::construct_at(this->slot(tail), e);
+        this->tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    template <typename TYPE>
+    auto original::spscQueue<TYPE>::tryPush(TYPE&& e) -> bool
+    {
+        if (this->freeSlots(1) == 0)
+            return false;
+        const uint64_t tail = this->tail_.load(std::memory_order_relaxed);
+        std::construct_at(this->slot(tail), std::move(e));
+        this->tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    template <typename TYPE>
+    auto original::spscQueue<TYPE>::tryPop(TYPE& e) -> bool
+    {
+        if (this->readySlots(1) == 0)
+            return false;
+        const uint64_t head = this->head_.load(std::memory_order_relaxed);
+        TYPE* cur = this->slot(head);
+        e = std::move(*cur);
+        std::destroy_at(cur);
+        this->head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // The whole batch is published with a single store of the tail.
+    template <typename TYPE>
+    auto original::spscQueue<TYPE>::pushBatch(const TYPE* src, const uint32_t n) -> uint32_t
+    {
+        const uint32_t cnt = this->freeSlots(n);
+        const uint64_t tail = this->tail_.load(std::memory_order_relaxed);
+        for (uint32_t i = 0; i < cnt; ++i) {
+            std::construct_at(this->slot(tail + i), src[i]);
+        }
+        this->tail_.store(tail + cnt, std::memory_order_release);
+        return cnt;
+    }
+
+    template <typename TYPE>
+    auto original::spscQueue<TYPE>::popBatch(TYPE* dst, const uint32_t n) -> uint32_t
+    {
+        const uint32_t cnt = this->readySlots(n);
+        const uint64_t head = this->head_.load(std::memory_order_relaxed);
+        for (uint32_t i = 0; i < cnt; ++i) {
+            TYPE* cur = this->slot(head + i);
+            dst[i] = std::move(*cur);
+            std::destroy_at(cur);
+        }
+        this->head_.store(head + cnt, std::memory_order_release);
+        return cnt;
+    }
+
+    template <typename TYPE>
+    auto original::spscQueue<TYPE>::push(const TYPE& e) -> void
+    {
+        while (!this->tryPush(e)) {
+            std::this_thread::yield();
+        }
+    }
+
+    template <typename TYPE>
+    auto original::spscQueue<TYPE>::push(TYPE&& e) -> void
+    {
+        while (!this->tryPush(std::move(e))) {
+            std::this_thread::yield();
+        }
+    }
+
+    template <typename TYPE>
+    auto original::spscQueue<TYPE>::pop() -> TYPE
+    {
+        while (this->readySlots(1) == 0) {
+            std::this_thread::yield();
+        }
+        const uint64_t head = this->head_.load(std::memory_order_relaxed);
+        TYPE* cur = this->slot(head);
+        TYPE res = std::move(*cur);
+        std::destroy_at(cur);
+        this->head_.store(head + 1, std::memory_order_release);
+        return res;
+    }
+
+#endif //SPSCQUEUE_H
@@ -6,7 +6,7 @@
 #include <string>
 
 namespace original {
-    template<typename TYPE, template <typename> typename SERIAL = chain>
+    template<typename TYPE, template <typename> typename SERIAL = defaultChain>
     class stack final : public containerAdapter<TYPE, SERIAL> {
     public:
         explicit stack(const SERIAL<TYPE>& serial = SERIAL<TYPE>{});
@@ -17,6 +17,9 @@ namespace original {
         stack& operator=(stack&& other) noexcept;
         bool operator==(const stack& other) const;
         void push(const TYPE& e);
+        void push(TYPE&& e);
+        template<typename... Args>
+        void emplace(Args&&... args);
         TYPE pop();
         TYPE top() const;
         [[nodiscard]] std::string className() const override;
@@ -69,6 +72,17 @@ namespace original {
         this->serial_.pushEnd(e);
     }
 
+    template<typename TYPE, template <typename> typename SERIAL>
+    auto original::stack<TYPE, SERIAL>::push(TYPE&& e) -> void {
+        this->serial_.pushEnd(std::move(e));
+    }
+
+    template<typename TYPE, template <typename> typename SERIAL>
+    template<typename... Args>
+    auto original::stack<TYPE, SERIAL>::emplace(Args&&... args) -> void {
+        this->serial_.emplaceEnd(std::forward<Args>(args)...);
+    }
+
     template<typename TYPE, template <typename> typename SERIAL>
     auto original::stack<TYPE, SERIAL>::pop() -> TYPE {
         return this->serial_.popEnd();
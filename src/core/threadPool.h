@@ -0,0 +1,182 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+/**
+ * @file threadPool.h
+ * @brief Fixed size pool of worker threads backing the parallel algorithms.
+ */
+
+namespace original {
+
+    /**
+     * @class threadPool
+     * @brief A fixed set of worker threads consuming a shared task queue.
+     * @details parallelFor() hands out chunk indexes through an atomic counter, the calling
+     *          thread takes chunks as well, so work never waits on an idle queue. Calls made
+     *          from inside a worker run inline to avoid workers blocking on each other.
+     */
+    class threadPool {
+        std::vector<std::thread> workers_;
+        std::queue<std::function<void()>> tasks_;
+        std::mutex mutex_;
+        std::condition_variable cond_;
+        bool stopped_;
+
+        inline static thread_local bool in_worker_ = false;
+
+        void work();
+    public:
+        explicit threadPool(uint32_t threads = defaultThreads());
+        threadPool(const threadPool& other) = delete;
+        threadPool& operator=(const threadPool& other) = delete;
+        ~threadPool();
+
+        /**
+         * @brief Number of worker threads, not counting the threads submitting work.
+         */
+        [[nodiscard]] uint32_t size() const;
+
+        /**
+         * @brief Queues a task to run on one of the workers.
+         */
+        void submit(std::function<void()> task);
+
+        /**
+         * @brief Calls kernel(i) for every i in [0, chunks) and waits for all of them.
+         * @details The first exception thrown by a chunk cancels the chunks not yet started
+         *          and is rethrown on the calling thread.
+         */
+        template<typename Kernel>
+        void parallelFor(int64_t chunks, Kernel kernel);
+
+        /**
+         * @brief Workers of the pool shared by the algorithms, one fewer than the hardware threads.
+         */
+        static uint32_t defaultThreads();
+
+        static threadPool& global();
+    };
+}
+
+    inline original::threadPool::threadPool(const uint32_t threads) : stopped_(false)
+    {
+        this->workers_.reserve(threads);
+        for (uint32_t i = 0; i < threads; ++i) {
+            this->workers_.emplace_back([this] { this->work(); });
+        }
+    }
+
+    inline original::threadPool::~threadPool()
+    {
+        {
+            std::lock_guard lock(this->mutex_);
+            this->stopped_ = true;
+        }
+        this->cond_.notify_all();
+        for (auto& worker : this->workers_) {
+            worker.join();
+        }
+    }
+
+    inline auto original::threadPool::work() -> void
+    {
+        in_worker_ = true;
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock lock(this->mutex_);
+                this->cond_.wait(lock, [this] { return this->stopped_ || !this->tasks_.empty(); });
+                if (this->tasks_.empty())
+                    return;
+                task = std::move(this->tasks_.front());
+                this->tasks_.pop();
+            }
+            task();
+        }
+    }
+
+    inline auto original::threadPool::size() const -> uint32_t
+    {
+        return this->workers_.size();
+    }
+
+    inline auto original::threadPool::submit(std::function<void()> task) -> void
+    {
+        {
+            std::lock_guard lock(this->mutex_);
+            this->tasks_.push(std::move(task));
+        }
+        this->cond_.notify_one();
+    }
+
+    template <typename Kernel>
+    auto original::threadPool::parallelFor(const int64_t chunks, Kernel kernel) -> void
+    {
+        if (chunks <= 0)
+            return;
+        if (chunks == 1 || this->workers_.empty() || in_worker_) {
+            for (int64_t i = 0; i < chunks; ++i) {
+                kernel(i);
+            }
+            return;
+        }
+
+        std::atomic<int64_t> next{0};
+        std::mutex done_mutex;
+        std::condition_variable done_cond;
+        std::exception_ptr error;
+        int64_t pending = std::min<int64_t>(chunks - 1, this->workers_.size());
+
+        auto run = [&] {
+            for (int64_t i = next.fetch_add(1); i < chunks; i = next.fetch_add(1)) {
+                try {
+                    kernel(i);
+                } catch (...) {
+                    std::lock_guard lock(done_mutex);
+                    if (!error)
+                        error = std::current_exception();
+                    next.store(chunks);
+                }
+            }
+        };
+
+        for (int64_t i = pending; i > 0; --i) {
+            this->submit([&] {
+                run();
+                std::lock_guard lock(done_mutex);
+                pending -= 1;
+                if (pending == 0)
+                    done_cond.notify_one();
+            });
+        }
+        run();
+
+        std::unique_lock lock(done_mutex);
+        done_cond.wait(lock, [&] { return pending == 0; });
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    inline auto original::threadPool::defaultThreads() -> uint32_t
+    {
+        return std::max(std::thread::hardware_concurrency(), 1u) - 1;
+    }
+
+    inline auto original::threadPool::global() -> threadPool&
+    {
+        static threadPool pool;
+        return pool;
+    }
+
+#endif //THREADPOOL_H
@@ -1,9 +1,14 @@
 #ifndef VECTOR_H
 #define VECTOR_H
 
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <type_traits>
 #include "baseList.h"
 #include "iterationStream.h"
 #include "array.h"
+#include "span.h"
 
 namespace original{
     template <typename TYPE>
@@ -17,11 +22,12 @@ namespace original{
         void vectorInit();
         void vectorDestruct() const;
         static TYPE* vectorArrayInit(uint32_t size);
+        static void vectorArrayFree(TYPE* arr, uint32_t size);
         static void moveElements(TYPE* old_body, uint32_t inner_idx,
                                  uint32_t len, TYPE* new_body, int64_t offset);
         [[nodiscard]] uint32_t toInnerIdx(int64_t index) const;
         [[nodiscard]] bool outOfMaxSize(uint32_t increment) const;
-        void grow(uint32_t new_size);
+        void grow(uint32_t new_size, uint32_t new_begin);
         void adjust(uint32_t increment);
 
     public:
@@ -42,18 +48,38 @@ namespace original{
         vector(const vector& other);
         vector(const std::initializer_list<TYPE>& list);
         explicit vector(const array<TYPE>& arr);
+        vector(const iterator<TYPE>& begin, const iterator<TYPE>& end);
         vector& operator=(const vector& other);
         vector(vector&& other) noexcept;
         vector& operator=(vector&& other) noexcept;
         [[nodiscard]] uint32_t size() const override;
+        [[nodiscard]] uint32_t capacity() const;
+        void reserve(uint32_t new_capacity);
+        void shrinkToFit();
         TYPE& data() const;
+        TYPE* fastBegin();
+        TYPE* fastEnd();
+        const TYPE* fastBegin() const;
+        const TYPE* fastEnd() const;
+        span<TYPE> asSpan();
+        span<const TYPE> asSpan() const;
         TYPE get(int64_t index) const override;
         TYPE& operator[](int64_t index) override;
         void set(int64_t index, const TYPE &e) override;
         uint32_t indexOf(const TYPE &e) const override;
         void pushBegin(const TYPE &e) override;
+        void pushBegin(TYPE &&e) override;
         void push(int64_t index, const TYPE &e) override;
+        void push(int64_t index, TYPE &&e) override;
         void pushEnd(const TYPE &e) override;
+        void pushEnd(TYPE &&e) override;
+        void pushEnd(const iterator<TYPE>& begin, const iterator<TYPE>& end);
+        template<typename... Args>
+        void emplace(int64_t index, Args&&... args);
+        template<typename... Args>
+        void emplaceBegin(Args&&... args);
+        template<typename... Args>
+        void emplaceEnd(Args&&... args);
         TYPE popBegin() override;
         TYPE pop(int64_t index) override;
         TYPE popEnd() override;
@@ -76,32 +102,48 @@ namespace original{
     template <typename TYPE>
     auto original::vector<TYPE>::vectorDestruct() const -> void
     {
-        delete[] this->body;
+        std::destroy_n(this->body + this->inner_begin, this->size_);
+        vector::vectorArrayFree(this->body, this->max_size);
     }
 
+    // Allocates raw storage for size elements, no element is constructed.
     template <typename TYPE>
     auto original::vector<TYPE>::vectorArrayInit(const uint32_t size) -> TYPE* {
-        auto arr = new TYPE[size];
-        for (uint32_t i = 0; i < size; i++) {
-            arr[i] = TYPE{};
-        }
-        return arr;
+        return std::allocator<TYPE>{}.allocate(size);
+    }
+
+    template <typename TYPE>
+    auto original::vector<TYPE>::vectorArrayFree(TYPE* arr, const uint32_t size) -> void {
+        std::allocator<TYPE>{}.deallocate(arr, size);
     }
 
+    // Relocates len live elements starting at old_body[inner_idx] to new_body[inner_idx + offset].
+    // The destination slots must be raw or part of the relocated range itself, and the source
+    // slots that are not overwritten are left raw.
     template <typename TYPE>
     auto original::vector<TYPE>::moveElements(TYPE* old_body, const uint32_t inner_idx,
                                               const uint32_t len, TYPE* new_body, const int64_t offset) -> void{
-        if (offset > 0)
+        if (len == 0 || (offset == 0 && old_body == new_body))
+            return;
+
+        if constexpr (std::is_trivially_copyable_v<TYPE>)
+        {
+            std::memmove(new_body + inner_idx + offset, old_body + inner_idx, len * sizeof(TYPE));
+        }else if (offset > 0)
         {
             for (uint32_t i = 0; i < len; i += 1)
             {
-                new_body[inner_idx + offset + len - 1 - i] = old_body[inner_idx + len - 1 - i];
+                TYPE* src = old_body + inner_idx + len - 1 - i;
+                std::construct_at(new_body + inner_idx + offset + len - 1 - i, std::move(*src));
+                std::destroy_at(src);
             }
         }else
         {
             for (uint32_t i = 0; i < len; i += 1)
             {
-                new_body[inner_idx + offset + i] = old_body[inner_idx + i];
+                TYPE* src = old_body + inner_idx + i;
+                std::construct_at(new_body + inner_idx + offset + i, std::move(*src));
+                std::destroy_at(src);
             }
         }
     }
@@ -119,14 +161,13 @@ namespace original{
     }
 
     template <typename TYPE>
-    auto original::vector<TYPE>::grow(const uint32_t new_size) -> void
+    auto original::vector<TYPE>::grow(const uint32_t new_size, const uint32_t new_begin) -> void
     {
         TYPE* new_body = vector::vectorArrayInit(new_size);
-        uint32_t new_begin = (new_size - 1) / 4;
         const int64_t offset = static_cast<int64_t>(new_begin) - static_cast<int64_t>(this->inner_begin);
         vector::moveElements(this->body, this->inner_begin,
                              this->size(), new_body, offset);
-        delete[] this->body;
+        vector::vectorArrayFree(this->body, this->max_size);
         this->body = new_body;
         this->max_size = new_size;
         this->inner_begin = new_begin;
@@ -145,7 +186,7 @@ namespace original{
             this->inner_begin = new_begin;
         } else {
             const uint32_t new_max_size = (this->size() + increment) * 2;
-            this->grow(new_max_size);
+            this->grow(new_max_size, (new_max_size - 1) / 4);
         }
     }
 
@@ -209,7 +250,7 @@ namespace original{
         this->adjust(list.size());
         for (const TYPE& e: list)
         {
-            this->body[this->inner_begin + this->size()] = e;
+            std::construct_at(this->body + this->inner_begin + this->size(), e);
             this->size_ += 1;
         }
     }
@@ -228,7 +269,7 @@ namespace original{
         this->body = vector::vectorArrayInit(this->max_size);
         for (uint32_t i = 0; i < this->size(); ++i) {
             const TYPE& data = other.body[this->toInnerIdx(i)];
-            this->body[this->toInnerIdx(i)] = data;
+            std::construct_at(this->body + this->toInnerIdx(i), data);
         }
         return *this;
     }
@@ -260,22 +301,85 @@ namespace original{
         this->adjust(arr.size());
         for (uint32_t i = 0; i < arr.size(); i += 1)
         {
-            this->body[this->toInnerIdx(i)] = arr.get(i);
+            std::construct_at(this->body + this->toInnerIdx(i), arr.get(i));
             this->size_ += 1;
         }
     }
 
+    template <typename TYPE>
+    original::vector<TYPE>::vector(const iterator<TYPE>& begin, const iterator<TYPE>& end) : vector()
+    {
+        this->pushEnd(begin, end);
+    }
+
     template <typename TYPE>
     auto original::vector<TYPE>::size() const -> uint32_t
     {
         return this->size_;
     }
 
+    // outOfMaxSize() keeps a free slot on both sides of the elements, so two slots are never usable.
+    template <typename TYPE>
+    auto original::vector<TYPE>::capacity() const -> uint32_t
+    {
+        return this->max_size - 2;
+    }
+
+    // The elements are placed right after the front slot, leaving the whole room to pushEnd().
+    template <typename TYPE>
+    auto original::vector<TYPE>::reserve(const uint32_t new_capacity) -> void
+    {
+        if (new_capacity <= this->capacity())
+            return;
+
+        this->grow(new_capacity + 2, 1);
+    }
+
+    template <typename TYPE>
+    auto original::vector<TYPE>::shrinkToFit() -> void
+    {
+        const uint32_t new_size = std::max(this->size() + 2, this->INNER_SIZE_INIT);
+        if (new_size >= this->max_size)
+            return;
+
+        this->grow(new_size, (new_size - this->size()) / 2);
+    }
+
     template<typename TYPE>
     auto original::vector<TYPE>::data() const -> TYPE& {
         return this->body[this->toInnerIdx(0)];
     }
 
+    template<typename TYPE>
+    auto original::vector<TYPE>::fastBegin() -> TYPE* {
+        return this->body + this->inner_begin;
+    }
+
+    template<typename TYPE>
+    auto original::vector<TYPE>::fastEnd() -> TYPE* {
+        return this->body + this->inner_begin + this->size();
+    }
+
+    template<typename TYPE>
+    auto original::vector<TYPE>::fastBegin() const -> const TYPE* {
+        return this->body + this->inner_begin;
+    }
+
+    template<typename TYPE>
+    auto original::vector<TYPE>::fastEnd() const -> const TYPE* {
+        return this->body + this->inner_begin + this->size();
+    }
+
+    template<typename TYPE>
+    auto original::vector<TYPE>::asSpan() -> span<TYPE> {
+        return span<TYPE>(this->body + this->inner_begin, this->size());
+    }
+
+    template<typename TYPE>
+    auto original::vector<TYPE>::asSpan() const -> span<const TYPE> {
+        return span<const TYPE>(this->body + this->inner_begin, this->size());
+    }
+
     template <typename TYPE>
     auto original::vector<TYPE>::get(int64_t index) const -> TYPE
     {
@@ -325,50 +429,152 @@ namespace original{
     template <typename TYPE>
     auto original::vector<TYPE>::pushBegin(const TYPE &e) -> void
     {
-        this->adjust(1);
+        this->emplaceBegin(e);
+    }
+
+    template <typename TYPE>
+    auto original::vector<TYPE>::pushBegin(TYPE &&e) -> void
+    {
+        this->emplaceBegin(std::move(e));
+    }
+
+    template <typename TYPE>
+    auto original::vector<TYPE>::push(const int64_t index, const TYPE &e) -> void
+    {
+        this->emplace(index, e);
+    }
+
+    template <typename TYPE>
+    auto original::vector<TYPE>::push(const int64_t index, TYPE &&e) -> void
+    {
+        this->emplace(index, std::move(e));
+    }
+
+    template <typename TYPE>
+    auto original::vector<TYPE>::pushEnd(const TYPE &e) -> void
+    {
+        this->emplaceEnd(e);
+    }
+
+    template <typename TYPE>
+    auto original::vector<TYPE>::pushEnd(TYPE &&e) -> void
+    {
+        this->emplaceEnd(std::move(e));
+    }
+
+    template <typename TYPE>
+    auto original::vector<TYPE>::pushEnd(const iterator<TYPE>& begin, const iterator<TYPE>& end) -> void
+    {
+        uint32_t len = 0;
+        auto* it = begin.clone();
+        for (; it->isValid() && !it->equal(end); it->next())
+        {
+            len += 1;
+        }
+        delete it;
+
+        this->reserve(this->size() + len);
+        if (this->inner_begin + this->size() + len > this->max_size - 1)
+        {
+            vector::moveElements(this->body, this->inner_begin, this->size(),
+                                 this->body, 1 - static_cast<int64_t>(this->inner_begin));
+            this->inner_begin = 1;
+        }
+        it = begin.clone();
+        for (uint32_t i = 0; i < len; i += 1, it->next())
+        {
+            std::construct_at(this->body + this->toInnerIdx(this->size()), it->getElem());
+            this->size_ += 1;
+        }
+        delete it;
+    }
+
+    template <typename TYPE>
+    template <typename... Args>
+    auto original::vector<TYPE>::emplaceBegin(Args&&... args) -> void
+    {
+        if (this->outOfMaxSize(1))
+        {
+            // args may refer to an element of this vector, build the new one before adjust() relocates them
+            TYPE e(std::forward<Args>(args)...);
+            this->adjust(1);
+            std::construct_at(this->body + this->inner_begin - 1, std::move(e));
+        }else
+        {
+            std::construct_at(this->body + this->inner_begin - 1, std::forward<Args>(args)...);
+        }
+        // Only once the element exists, a throwing constructor leaves the vector as it was
         this->inner_begin -= 1;
-        this->body[this->toInnerIdx(0)] = e;
         this->size_ += 1;
     }
 
     template <typename TYPE>
-    auto original::vector<TYPE>::push(int64_t index, const TYPE &e) -> void
+    template <typename... Args>
+    auto original::vector<TYPE>::emplace(int64_t index, Args&&... args) -> void
     {
         if (this->parseNegIndex(index) == this->size())
         {
-            this->pushEnd(e);
+            this->emplaceEnd(std::forward<Args>(args)...);
         }else if (this->parseNegIndex(index) == 0)
         {
-            this->pushBegin(e);
+            this->emplaceBegin(std::forward<Args>(args)...);
         }else
         {
             if (this->indexOutOfBound(index))
             {
                 throw outOfBoundError();
             }
+            // inserting in the middle always relocates elements, so the new one is built first
+            TYPE e(std::forward<Args>(args)...);
             this->adjust(1);
             index = this->toInnerIdx(this->parseNegIndex(index));
             uint32_t rel_idx = index - this->inner_begin;
-            if (index - this->inner_begin <= (this->size() - 1) / 2)
+            const bool front = index - this->inner_begin <= (this->size() - 1) / 2;
+            if (front)
             {
                 vector::moveElements(this->body, this->inner_begin,
-                                     rel_idx + 1, this->body, -1);
+                                     rel_idx, this->body, -1);
                 this->inner_begin -= 1;
             }else
             {
                 vector::moveElements(this->body, index,
                                      this->size() - rel_idx, this->body, 1);
             }
-            this->body[this->toInnerIdx(rel_idx)] = e;
+            try
+            {
+                std::construct_at(this->body + this->toInnerIdx(rel_idx), std::move(e));
+            }catch (...)
+            {
+                // close the gap again, so that no raw slot is left among the live elements
+                if (front)
+                {
+                    vector::moveElements(this->body, this->inner_begin,
+                                         rel_idx, this->body, 1);
+                    this->inner_begin += 1;
+                }else
+                {
+                    vector::moveElements(this->body, index + 1,
+                                         this->size() - rel_idx, this->body, -1);
+                }
+                throw;
+            }
             this->size_ += 1;
         }
     }
 
     template <typename TYPE>
-    auto original::vector<TYPE>::pushEnd(const TYPE &e) -> void
+    template <typename... Args>
+    auto original::vector<TYPE>::emplaceEnd(Args&&... args) -> void
     {
-        this->adjust(1);
-        this->body[this->toInnerIdx(this->size())] = e;
+        if (this->outOfMaxSize(1))
+        {
+            TYPE e(std::forward<Args>(args)...);
+            this->adjust(1);
+            std::construct_at(this->body + this->toInnerIdx(this->size()), std::move(e));
+        }else
+        {
+            std::construct_at(this->body + this->toInnerIdx(this->size()), std::forward<Args>(args)...);
+        }
         this->size_ += 1;
     }
 
@@ -378,7 +584,9 @@ namespace original{
         if (this->size() == 0){
             throw noElementError();
         }
-        TYPE res = this->get(0);
+        TYPE* first = this->body + this->toInnerIdx(0);
+        TYPE res = std::move(*first);
+        std::destroy_at(first);
         this->inner_begin += 1;
         this->size_ -= 1;
         return res;
@@ -398,8 +606,9 @@ namespace original{
         if (this->indexOutOfBound(index)){
             throw outOfBoundError();
         }
-        TYPE res = this->get(index);
         index = this->toInnerIdx(this->parseNegIndex(index));
+        TYPE res = std::move(this->body[index]);
+        std::destroy_at(this->body + index);
         uint32_t rel_idx = index - this->inner_begin;
         if (index - this->inner_begin <= (this->size() - 1) / 2)
         {
@@ -421,7 +630,9 @@ namespace original{
         if (this->size() == 0){
             throw noElementError();
         }
-        TYPE res = this->get(this->size() - 1);
+        TYPE* last = this->body + this->toInnerIdx(this->size() - 1);
+        TYPE res = std::move(*last);
+        std::destroy_at(last);
         this->size_ -= 1;
         return res;
     }
@@ -0,0 +1,243 @@
+#include <algorithm>
+#include <vector>
+#include "bench_common.h"
+#include "algorithms.h"
+#include "blocksList.h"
+#include "filter.h"
+#include "vector.h"
+
+namespace {
+
+    using vectorInt = original::vector<int>;
+    using blocksListInt = original::blocksList<int>;
+
+    template<typename LIST>
+    void algorithmsCount(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto list = bench::filledList<LIST>(n);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(original::algorithms::count(list.first(), list.last(), 7));
+        }
+        bench::setItems(state, n);
+    }
+
+    template<typename LIST>
+    void algorithmsAllOf(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto list = bench::filledList<LIST>(n);
+        const original::greaterFilter<int> condition(-1);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(original::algorithms::allOf(list.first(), list.last(), condition));
+        }
+        bench::setItems(state, n);
+    }
+
+    template<typename LIST>
+    void algorithmsFind(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto list = bench::filledList<LIST>(n);
+        for (auto _ : state) {
+            auto* it = original::algorithms::find(list.begin(), list.end(), static_cast<int>(n - 1));
+            benchmark::DoNotOptimize(it);
+            delete it;
+        }
+        bench::setItems(state, n);
+    }
+
+    template<typename LIST>
+    void algorithmsFill(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto list = bench::filledList<LIST>(n);
+        for (auto _ : state) {
+            original::algorithms::fill(list.first(), list.last(), 1);
+            benchmark::ClobberMemory();
+        }
+        bench::setItems(state, n);
+    }
+
+    // Fills list with the same pseudo random permutation-like data for every sort benchmark.
+    template<typename LIST>
+    void shuffle(LIST& list, const int64_t n) {
+        const auto idx = bench::randomIndexes(n);
+        for (int64_t i = 0; i < n; ++i) {
+            list[i] = static_cast<int>(idx[i]);
+        }
+    }
+
+    template<typename LIST>
+    void algorithmsSort(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        auto list = bench::filledList<LIST>(n);
+        for (auto _ : state) {
+            state.PauseTiming();
+            shuffle(list, n);
+            state.ResumeTiming();
+            original::algorithms::sort(list.first(), list.last());
+            benchmark::DoNotOptimize(&list);
+        }
+        bench::setItems(state, n);
+    }
+
+    template<typename LIST>
+    void algorithmsStableSort(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        auto list = bench::filledList<LIST>(n);
+        for (auto _ : state) {
+            state.PauseTiming();
+            shuffle(list, n);
+            state.ResumeTiming();
+            original::algorithms::stableSort(list.first(), list.last());
+            benchmark::DoNotOptimize(&list);
+        }
+        bench::setItems(state, n);
+    }
+
+    template<typename LIST>
+    void algorithmsPartialSort(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        auto list = bench::filledList<LIST>(n);
+        for (auto _ : state) {
+            state.PauseTiming();
+            shuffle(list, n);
+            state.ResumeTiming();
+            original::algorithms::partialSort(list.first(), list.last(), n / 16);
+            benchmark::DoNotOptimize(&list);
+        }
+        bench::setItems(state, n);
+    }
+
+    template<typename LIST>
+    void algorithmsNthElement(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        auto list = bench::filledList<LIST>(n);
+        for (auto _ : state) {
+            state.PauseTiming();
+            shuffle(list, n);
+            state.ResumeTiming();
+            original::algorithms::nthElement(list.first(), list.last(), n / 2);
+            benchmark::DoNotOptimize(&list);
+        }
+        bench::setItems(state, n);
+    }
+
+    // ---- Execution policies ----
+
+    template<typename POLICY>
+    void algorithmsCountPolicy(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto list = bench::filledList<vectorInt>(n);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(original::algorithms::count(POLICY{}, list.first(), list.last(), 7));
+        }
+        bench::setItems(state, n);
+    }
+
+    template<typename POLICY>
+    void algorithmsForEachPolicy(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        auto list = bench::filledList<vectorInt>(n);
+        for (auto _ : state) {
+            original::algorithms::forEach(POLICY{}, list.first(), list.last(), [](int& e) { e = e * 3 + 1; });
+            benchmark::ClobberMemory();
+        }
+        bench::setItems(state, n);
+    }
+
+    template<typename POLICY>
+    void algorithmsFindPolicy(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto list = bench::filledList<vectorInt>(n);
+        for (auto _ : state) {
+            auto* it = original::algorithms::find(POLICY{}, list.begin(), list.end(), static_cast<int>(n / 2));
+            benchmark::DoNotOptimize(it);
+            delete it;
+        }
+        bench::setItems(state, n);
+    }
+
+    // ---- Standard library baselines on std::vector ----
+
+    void stdSort(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        std::vector<int> list(n);
+        for (auto _ : state) {
+            state.PauseTiming();
+            shuffle(list, n);
+            state.ResumeTiming();
+            std::sort(list.begin(), list.end());
+            benchmark::DoNotOptimize(list.data());
+        }
+        bench::setItems(state, n);
+    }
+
+    void stdStableSort(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        std::vector<int> list(n);
+        for (auto _ : state) {
+            state.PauseTiming();
+            shuffle(list, n);
+            state.ResumeTiming();
+            std::stable_sort(list.begin(), list.end());
+            benchmark::DoNotOptimize(list.data());
+        }
+        bench::setItems(state, n);
+    }
+
+    void stdPartialSort(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        std::vector<int> list(n);
+        for (auto _ : state) {
+            state.PauseTiming();
+            shuffle(list, n);
+            state.ResumeTiming();
+            std::partial_sort(list.begin(), list.begin() + n / 16, list.end());
+            benchmark::DoNotOptimize(list.data());
+        }
+        bench::setItems(state, n);
+    }
+
+    void stdNthElement(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        std::vector<int> list(n);
+        for (auto _ : state) {
+            state.PauseTiming();
+            shuffle(list, n);
+            state.ResumeTiming();
+            std::nth_element(list.begin(), list.begin() + n / 2, list.end());
+            benchmark::DoNotOptimize(list.data());
+        }
+        bench::setItems(state, n);
+    }
+
+} // namespace
+
+#define BENCH_ALGORITHMS_COUNTS RangeMultiplier(16)->Range(1 << 10, 1 << 20)
+
+BENCHMARK_TEMPLATE(algorithmsCount, vectorInt)->BENCH_ALGORITHMS_COUNTS;
+BENCHMARK_TEMPLATE(algorithmsCount, blocksListInt)->BENCH_ALGORITHMS_COUNTS;
+BENCHMARK_TEMPLATE(algorithmsAllOf, vectorInt)->BENCH_ALGORITHMS_COUNTS;
+BENCHMARK_TEMPLATE(algorithmsFind, vectorInt)->BENCH_ALGORITHMS_COUNTS;
+BENCHMARK_TEMPLATE(algorithmsFind, blocksListInt)->BENCH_ALGORITHMS_COUNTS;
+BENCHMARK_TEMPLATE(algorithmsFill, vectorInt)->BENCH_ALGORITHMS_COUNTS;
+BENCHMARK_TEMPLATE(algorithmsFill, blocksListInt)->BENCH_ALGORITHMS_COUNTS;
+
+#define BENCH_POLICY_COUNTS RangeMultiplier(16)->Range(1 << 16, 1 << 24)->UseRealTime()
+
+BENCHMARK_TEMPLATE(algorithmsCountPolicy, original::execution::sequencedPolicy)->BENCH_POLICY_COUNTS;
+BENCHMARK_TEMPLATE(algorithmsCountPolicy, original::execution::parallelPolicy)->BENCH_POLICY_COUNTS;
+BENCHMARK_TEMPLATE(algorithmsForEachPolicy, original::execution::sequencedPolicy)->BENCH_POLICY_COUNTS;
+BENCHMARK_TEMPLATE(algorithmsForEachPolicy, original::execution::parallelPolicy)->BENCH_POLICY_COUNTS;
+BENCHMARK_TEMPLATE(algorithmsFindPolicy, original::execution::sequencedPolicy)->BENCH_POLICY_COUNTS;
+BENCHMARK_TEMPLATE(algorithmsFindPolicy, original::execution::parallelPolicy)->BENCH_POLICY_COUNTS;
+
+#define BENCH_SORT_COUNTS RangeMultiplier(16)->Range(1 << 8, 1 << 20)
+
+BENCHMARK_TEMPLATE(algorithmsSort, vectorInt)->BENCH_SORT_COUNTS;
+BENCHMARK_TEMPLATE(algorithmsSort, blocksListInt)->BENCH_SORT_COUNTS;
+BENCHMARK(stdSort)->BENCH_SORT_COUNTS;
+BENCHMARK_TEMPLATE(algorithmsStableSort, vectorInt)->BENCH_SORT_COUNTS;
+BENCHMARK(stdStableSort)->BENCH_SORT_COUNTS;
+BENCHMARK_TEMPLATE(algorithmsPartialSort, vectorInt)->BENCH_SORT_COUNTS;
+BENCHMARK(stdPartialSort)->BENCH_SORT_COUNTS;
+BENCHMARK_TEMPLATE(algorithmsNthElement, vectorInt)->BENCH_SORT_COUNTS;
+BENCHMARK(stdNthElement)->BENCH_SORT_COUNTS;
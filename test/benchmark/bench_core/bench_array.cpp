@@ -0,0 +1,102 @@
+#include "bench_common.h"
+#include "array.h"
+
+namespace {
+
+    template<typename TYPE>
+    original::array<TYPE> filledArray(const int64_t n) {
+        original::array<TYPE> arr(n);
+        for (int64_t i = 0; i < n; ++i) {
+            arr.set(i, bench::makeValue<TYPE>(i));
+        }
+        return arr;
+    }
+
+    template<typename TYPE>
+    void arrayConstruct(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        for (auto _ : state) {
+            original::array<TYPE> arr(n);
+            benchmark::DoNotOptimize(&arr);
+        }
+        bench::setItems(state, n);
+    }
+
+    template<typename TYPE>
+    void arraySet(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        auto arr = filledArray<TYPE>(n);
+        const auto idx = bench::randomIndexes(n);
+        for (auto _ : state) {
+            for (int64_t i = 0; i < n; ++i) {
+                arr.set(idx[i], bench::makeValue<TYPE>(i));
+            }
+            benchmark::ClobberMemory();
+        }
+        bench::setItems(state, n);
+    }
+
+    template<typename TYPE>
+    void arrayIndexedGet(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto arr = filledArray<TYPE>(n);
+        const auto idx = bench::randomIndexes(n);
+        for (auto _ : state) {
+            for (int64_t i = 0; i < n; ++i) {
+                benchmark::DoNotOptimize(arr.get(idx[i]));
+            }
+        }
+        bench::setItems(state, n);
+    }
+
+    template<typename TYPE>
+    void arrayIterate(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto arr = filledArray<TYPE>(n);
+        for (auto _ : state) {
+            for (const auto& e : arr) {
+                benchmark::DoNotOptimize(e);
+            }
+        }
+        bench::setItems(state, n);
+    }
+
+    template<typename TYPE>
+    void arrayCopy(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto arr = filledArray<TYPE>(n);
+        for (auto _ : state) {
+            original::array<TYPE> copied(arr);
+            benchmark::DoNotOptimize(&copied);
+        }
+        bench::setItems(state, n);
+    }
+
+    template<typename TYPE>
+    void arrayMove(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        auto arr = filledArray<TYPE>(n);
+        for (auto _ : state) {
+            original::array<TYPE> moved(std::move(arr));
+            arr = std::move(moved);
+            benchmark::DoNotOptimize(&arr);
+        }
+        bench::setItems(state, 1);
+    }
+
+} // namespace
+
+#define BENCH_ARRAY(TYPE) \
+    BENCHMARK_TEMPLATE(arrayConstruct, TYPE)->BENCH_COUNTS; \
+    BENCHMARK_TEMPLATE(arraySet, TYPE)->BENCH_COUNTS; \
+    BENCHMARK_TEMPLATE(arrayIndexedGet, TYPE)->BENCH_COUNTS; \
+    BENCHMARK_TEMPLATE(arrayIterate, TYPE)->BENCH_COUNTS; \
+    BENCHMARK_TEMPLATE(arrayCopy, TYPE)->BENCH_COUNTS; \
+    BENCHMARK_TEMPLATE(arrayMove, TYPE)->BENCH_COUNTS
+
+using p64 = bench::payload<64>;
+using p256 = bench::payload<256>;
+
+BENCH_ARRAY(int);
+BENCH_ARRAY(p64);
+BENCH_ARRAY(p256);
@@ -0,0 +1,371 @@
+#include "bench_common.h"
+#include "bitSet.h"
+
+namespace {
+
+    original::bitSet filledBitSet(const int64_t n, const uint32_t seed) {
+        original::bitSet bs(n);
+        const auto idx = bench::randomIndexes(n, seed);
+        for (int64_t i = 0; i < n / 2; ++i) {
+            bs.set(idx[i], true);
+        }
+        return bs;
+    }
+
+    // About half of the bits set at random, without an index array so that 100M bits stay cheap to build.
+    original::bitSet halfFilledBitSet(const int64_t n, const uint32_t seed) {
+        original::bitSet bs(n);
+        std::mt19937_64 gen(seed);
+        for (int64_t i = 0; i < n; i += 64) {
+            const uint64_t bits = gen();
+            for (int64_t j = 0; j < 64 && i + j < n; ++j) {
+                if (bits >> j & 1) bs.set(i + j, true);
+            }
+        }
+        return bs;
+    }
+
+    void bitSetSet(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        original::bitSet bs(n);
+        const auto idx = bench::randomIndexes(n);
+        for (auto _ : state) {
+            for (int64_t i = 0; i < n; ++i) {
+                bs.set(idx[i], i % 2 == 0);
+            }
+            benchmark::ClobberMemory();
+        }
+        bench::setItems(state, n);
+    }
+
+    void bitSetIndexedGet(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto bs = filledBitSet(n, 1);
+        const auto idx = bench::randomIndexes(n);
+        for (auto _ : state) {
+            for (int64_t i = 0; i < n; ++i) {
+                benchmark::DoNotOptimize(bs.get(idx[i]));
+            }
+        }
+        bench::setItems(state, n);
+    }
+
+    void bitSetIterate(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto bs = filledBitSet(n, 1);
+        for (auto _ : state) {
+            for (const auto it = bs.begin(); it.isValid(); it.next()) {
+                benchmark::DoNotOptimize(it.get());
+            }
+        }
+        bench::setItems(state, n);
+    }
+
+    // One bit in 1024 set, the sparse bitmaps whose scans should cost the set bits only.
+    original::bitSet sparseBitSet(const int64_t n) {
+        original::bitSet bs(n);
+        std::mt19937_64 gen(3);
+        for (int64_t i = 0; i < n / 1024; ++i) {
+            bs.set(static_cast<int64_t>(gen() % n), true);
+        }
+        return bs;
+    }
+
+    void bitSetSparseIterate(benchmark::State& state) {
+        const auto bs = sparseBitSet(state.range(0));
+        for (auto _ : state) {
+            for (const auto it = bs.begin(); it.isValid(); it.next()) {
+                if (it.get()) benchmark::DoNotOptimize(it.get());
+            }
+        }
+        bench::setItems(state, state.range(0));
+    }
+
+    void bitSetSparseFindNext(benchmark::State& state) {
+        const auto bs = sparseBitSet(state.range(0));
+        for (auto _ : state) {
+            for (uint32_t i = bs.findFirst(); i < bs.size(); i = bs.findNext(i)) {
+                benchmark::DoNotOptimize(i);
+            }
+        }
+        bench::setItems(state, state.range(0));
+    }
+
+    void bitSetSparseSetBits(benchmark::State& state) {
+        const auto bs = sparseBitSet(state.range(0));
+        for (auto _ : state) {
+            for (const uint32_t i : bs.setBits()) {
+                benchmark::DoNotOptimize(i);
+            }
+        }
+        bench::setItems(state, state.range(0));
+    }
+
+    void bitSetCount(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto bs = filledBitSet(n, 1);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(bs.count());
+        }
+        bench::setItems(state, n);
+    }
+
+    void bitSetAnd(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        auto bs1 = filledBitSet(n, 1);
+        const auto bs2 = filledBitSet(n, 2);
+        for (auto _ : state) {
+            bs1 &= bs2;
+            benchmark::DoNotOptimize(&bs1);
+        }
+        bench::setItems(state, n);
+    }
+
+    void bitSetOr(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        auto bs1 = filledBitSet(n, 1);
+        const auto bs2 = filledBitSet(n, 2);
+        for (auto _ : state) {
+            bs1 |= bs2;
+            benchmark::DoNotOptimize(&bs1);
+        }
+        bench::setItems(state, n);
+    }
+
+    void bitSetXor(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        auto bs1 = filledBitSet(n, 1);
+        const auto bs2 = filledBitSet(n, 2);
+        for (auto _ : state) {
+            bs1 ^= bs2;
+            benchmark::DoNotOptimize(&bs1);
+        }
+        bench::setItems(state, n);
+    }
+
+    void bitSetCopy(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto bs = filledBitSet(n, 1);
+        for (auto _ : state) {
+            original::bitSet copied(bs);
+            benchmark::DoNotOptimize(&copied);
+        }
+        bench::setItems(state, n);
+    }
+
+    void bitSetMove(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        auto bs = filledBitSet(n, 1);
+        for (auto _ : state) {
+            original::bitSet moved(std::move(bs));
+            bs = std::move(moved);
+            benchmark::DoNotOptimize(&bs);
+        }
+        bench::setItems(state, 1);
+    }
+
+    void bitSetBulkCount(benchmark::State& state) {
+        const auto bs = halfFilledBitSet(state.range(0), 1);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(bs.count());
+        }
+        bench::setItems(state, state.range(0));
+    }
+
+    void bitSetBulkAny(benchmark::State& state) {
+        const original::bitSet bs(state.range(0));
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(bs.any());
+        }
+        bench::setItems(state, state.range(0));
+    }
+
+    void bitSetBulkAll(benchmark::State& state) {
+        const auto bs = ~original::bitSet(state.range(0));
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(bs.all());
+        }
+        bench::setItems(state, state.range(0));
+    }
+
+    template<typename Callback>
+    void bitSetBulkBinary(benchmark::State& state, Callback operation) {
+        auto bs1 = halfFilledBitSet(state.range(0), 1);
+        const auto bs2 = halfFilledBitSet(state.range(0), 2);
+        for (auto _ : state) {
+            operation(bs1, bs2);
+            benchmark::DoNotOptimize(&bs1);
+        }
+        bench::setItems(state, state.range(0));
+    }
+
+    void bitSetBulkAnd(benchmark::State& state) {
+        bitSetBulkBinary(state, [](original::bitSet& a, const original::bitSet& b) { a &= b; });
+    }
+
+    void bitSetBulkOr(benchmark::State& state) {
+        bitSetBulkBinary(state, [](original::bitSet& a, const original::bitSet& b) { a |= b; });
+    }
+
+    void bitSetBulkXor(benchmark::State& state) {
+        bitSetBulkBinary(state, [](original::bitSet& a, const original::bitSet& b) { a ^= b; });
+    }
+
+    void bitSetBulkAndNot(benchmark::State& state) {
+        bitSetBulkBinary(state, [](original::bitSet& a, const original::bitSet& b) { a.andNot(b); });
+    }
+
+    void bitSetBulkFlip(benchmark::State& state) {
+        auto bs = halfFilledBitSet(state.range(0), 1);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(&bs.flip());
+        }
+        bench::setItems(state, state.range(0));
+    }
+
+    // One level's kernels on raw words, to compare the levels with each other.
+    template<original::bitKernels::level LEVEL>
+    void bitKernelPopcount(benchmark::State& state) {
+        const uint32_t words = (state.range(0) + 63) / 64;
+        auto* src = new original::bitKernels::word[words];
+        std::mt19937_64 gen(1);
+        for (uint32_t i = 0; i < words; ++i) {
+            src[i] = gen();
+        }
+        const auto& kernels = original::bitKernels::kernelsOf(LEVEL);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(kernels.popcount(src, words));
+        }
+        delete[] src;
+        bench::setItems(state, state.range(0));
+    }
+
+    template<original::bitKernels::level LEVEL>
+    void bitKernelAnd(benchmark::State& state) {
+        const uint32_t words = (state.range(0) + 63) / 64;
+        auto* dst = new original::bitKernels::word[words];
+        auto* src = new original::bitKernels::word[words];
+        std::mt19937_64 gen(1);
+        for (uint32_t i = 0; i < words; ++i) {
+            dst[i] = gen();
+            src[i] = gen() | gen();
+        }
+        const auto& kernels = original::bitKernels::kernelsOf(LEVEL);
+        for (auto _ : state) {
+            kernels.andWords(dst, src, words);
+            benchmark::ClobberMemory();
+        }
+        delete[] dst;
+        delete[] src;
+        bench::setItems(state, state.range(0));
+    }
+
+    // Sliding window use: shift the window by a few bits, then mark and count a span of it.
+    void bitSetSlideWindow(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        auto bs = halfFilledBitSet(n, 1);
+        uint32_t lo = 0;
+        for (auto _ : state) {
+            bs <<= 3;
+            bs.setRange(lo, lo + n / 4);
+            benchmark::DoNotOptimize(bs.countRange(n / 2, n));
+            lo = (lo + 97) % (n / 2);
+        }
+        bench::setItems(state, n);
+    }
+
+    void bitSetShiftRight(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        auto bs = halfFilledBitSet(n, 1);
+        for (auto _ : state) {
+            bs >>= 67;
+            bs.flipRange(n - 67, n);
+            benchmark::ClobberMemory();
+        }
+        bench::setItems(state, n);
+    }
+
+    void bitSetRangeBitByBit(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        original::bitSet bs(n);
+        for (auto _ : state) {
+            for (int64_t i = 1; i < n - 1; ++i) {
+                bs.set(i, !bs.get(i));
+            }
+            benchmark::ClobberMemory();
+        }
+        bench::setItems(state, n);
+    }
+
+    void bitSetRangeWords(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        original::bitSet bs(n);
+        for (auto _ : state) {
+            bs.flipRange(1, n - 1);
+            benchmark::ClobberMemory();
+        }
+        bench::setItems(state, n);
+    }
+
+    void bitSetResizeCopy(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        auto bs = halfFilledBitSet(n, 1);
+        for (auto _ : state) {
+            bs = bs.resize(n - 64);
+            bs = bs.resize(n);
+        }
+        bench::setItems(state, n);
+    }
+
+    void bitSetResizeInPlace(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        auto bs = halfFilledBitSet(n, 1);
+        for (auto _ : state) {
+            bs.resizeInPlace(n - 64);
+            bs.resizeInPlace(n);
+            benchmark::ClobberMemory();
+        }
+        bench::setItems(state, n);
+    }
+
+} // namespace
+
+#define BENCH_BIT_COUNTS RangeMultiplier(16)->Range(1 << 10, 1 << 22)
+
+BENCHMARK(bitSetSet)->BENCH_BIT_COUNTS;
+BENCHMARK(bitSetIndexedGet)->BENCH_BIT_COUNTS;
+BENCHMARK(bitSetIterate)->BENCH_BIT_COUNTS;
+BENCHMARK(bitSetSparseIterate)->BENCH_BIT_COUNTS;
+BENCHMARK(bitSetSparseFindNext)->BENCH_BIT_COUNTS;
+BENCHMARK(bitSetSparseSetBits)->BENCH_BIT_COUNTS;
+BENCHMARK(bitSetCount)->BENCH_BIT_COUNTS;
+BENCHMARK(bitSetAnd)->BENCH_BIT_COUNTS;
+BENCHMARK(bitSetOr)->BENCH_BIT_COUNTS;
+BENCHMARK(bitSetXor)->BENCH_BIT_COUNTS;
+BENCHMARK(bitSetCopy)->BENCH_BIT_COUNTS;
+BENCHMARK(bitSetMove)->BENCH_BIT_COUNTS;
+BENCHMARK(bitSetSlideWindow)->BENCH_BIT_COUNTS;
+BENCHMARK(bitSetShiftRight)->BENCH_BIT_COUNTS;
+BENCHMARK(bitSetRangeBitByBit)->BENCH_BIT_COUNTS;
+BENCHMARK(bitSetRangeWords)->BENCH_BIT_COUNTS;
+BENCHMARK(bitSetResizeCopy)->BENCH_BIT_COUNTS;
+BENCHMARK(bitSetResizeInPlace)->BENCH_BIT_COUNTS;
+
+// Bit counts from 1K to 100M for the word level operations.
+#define BENCH_BULK_BIT_COUNTS Arg(1000)->Arg(100000)->Arg(10000000)->Arg(100000000)
+
+BENCHMARK(bitSetBulkCount)->BENCH_BULK_BIT_COUNTS;
+BENCHMARK(bitSetBulkAny)->BENCH_BULK_BIT_COUNTS;
+BENCHMARK(bitSetBulkAll)->BENCH_BULK_BIT_COUNTS;
+BENCHMARK(bitSetBulkAnd)->BENCH_BULK_BIT_COUNTS;
+BENCHMARK(bitSetBulkOr)->BENCH_BULK_BIT_COUNTS;
+BENCHMARK(bitSetBulkXor)->BENCH_BULK_BIT_COUNTS;
+BENCHMARK(bitSetBulkAndNot)->BENCH_BULK_BIT_COUNTS;
+BENCHMARK(bitSetBulkFlip)->BENCH_BULK_BIT_COUNTS;
+
+BENCHMARK_TEMPLATE(bitKernelPopcount, original::bitKernels::level::SCALAR)->BENCH_BULK_BIT_COUNTS;
+BENCHMARK_TEMPLATE(bitKernelPopcount, original::bitKernels::level::AVX2)->BENCH_BULK_BIT_COUNTS;
+BENCHMARK_TEMPLATE(bitKernelPopcount, original::bitKernels::level::AVX512)->BENCH_BULK_BIT_COUNTS;
+BENCHMARK_TEMPLATE(bitKernelAnd, original::bitKernels::level::SCALAR)->BENCH_BULK_BIT_COUNTS;
+BENCHMARK_TEMPLATE(bitKernelAnd, original::bitKernels::level::AVX2)->BENCH_BULK_BIT_COUNTS;
+BENCHMARK_TEMPLATE(bitKernelAnd, original::bitKernels::level::AVX512)->BENCH_BULK_BIT_COUNTS;
@@ -0,0 +1,20 @@
+#include "bench_common.h"
+#include "blocksList.h"
+
+using blocksListInt = original::blocksList<int>;
+using blocksListP64 = original::blocksList<bench::payload<64>>;
+using blocksListP256 = original::blocksList<bench::payload<256>>;
+
+BENCH_LIST(blocksListInt, BENCH_COUNTS);
+BENCH_LIST(blocksListP64, BENCH_COUNTS);
+BENCH_LIST(blocksListP256, BENCH_COUNTS);
+
+BENCH_RESERVE(blocksListInt, BENCH_COUNTS);
+BENCH_RESERVE(blocksListP256, BENCH_COUNTS);
+
+// Blocks of the old fixed size, next to the default of about 4 KiB, for the churn of queue usage.
+using blocksListInt16 = original::blocksList<int, 16>;
+
+BENCH_CHURN(blocksListInt, BENCH_COUNTS);
+BENCH_CHURN(blocksListInt16, BENCH_COUNTS);
+BENCH_CHURN(blocksListP256, BENCH_COUNTS);
@@ -0,0 +1,23 @@
+#include "bench_common.h"
+#include "chain.h"
+
+using chainInt = original::chain<int>;
+using chainP64 = original::chain<bench::payload<64>>;
+using chainP256 = original::chain<bench::payload<256>>;
+
+BENCH_LIST(chainInt, BENCH_COUNTS_SMALL);
+BENCH_LIST(chainP64, BENCH_COUNTS_SMALL);
+BENCH_LIST(chainP256, BENCH_COUNTS_SMALL);
+BENCH_INDEXED(chainInt, BENCH_COUNTS_SMALL);
+BENCH_CONCAT(chainInt, BENCH_COUNTS_SMALL);
+// Only the fast loop: comparing against end() of a chain dereferences its null end node.
+BENCHMARK(bench::listFastRangeFor<chainInt>)->BENCH_COUNTS_SMALL;
+
+// Nodes recycled through a poolAllocator owned by each list.
+using chainIntPool = original::chain<int, original::poolAllocator<int>>;
+using chainP64Pool = original::chain<bench::payload<64>, original::poolAllocator<bench::payload<64>>>;
+
+BENCH_LIST(chainIntPool, BENCH_COUNTS_SMALL);
+BENCH_LIST(chainP64Pool, BENCH_COUNTS_SMALL);
+// Lists never share a pool, so concat() moves the elements into nodes of the receiving list.
+BENCH_CONCAT(chainIntPool, BENCH_COUNTS_SMALL);
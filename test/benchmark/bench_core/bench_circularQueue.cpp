@@ -0,0 +1,13 @@
+#include "bench_common.h"
+#include "circularQueue.h"
+
+using circularQueueInt = original::circularQueue<int>;
+using circularQueueP64 = original::circularQueue<bench::payload<64>>;
+using circularQueueP256 = original::circularQueue<bench::payload<256>>;
+
+BENCH_LIST(circularQueueInt, BENCH_COUNTS);
+BENCH_LIST(circularQueueP64, BENCH_COUNTS);
+BENCH_LIST(circularQueueP256, BENCH_COUNTS);
+
+BENCH_RESERVE(circularQueueInt, BENCH_COUNTS);
+BENCH_RESERVE(circularQueueP256, BENCH_COUNTS);
@@ -0,0 +1,460 @@
+#ifndef BENCH_COMMON_H
+#define BENCH_COMMON_H
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <random>
+#include <utility>
+#include <vector>
+#include "iterable.h"
+#include "serial.h"
+
+namespace bench {
+
+    // Element of SIZE bytes ordered by its key, used to measure how element size affects the containers.
+    template<uint32_t SIZE>
+    struct payload {
+        static_assert(SIZE >= sizeof(int64_t));
+
+        int64_t key;
+        char pad[SIZE - sizeof(int64_t)];
+
+        payload(const int64_t key = 0) : key(key), pad() {}
+
+        bool operator==(const payload& other) const { return key == other.key; }
+        bool operator!=(const payload& other) const { return key != other.key; }
+        bool operator<(const payload& other) const { return key < other.key; }
+        bool operator<=(const payload& other) const { return key <= other.key; }
+        bool operator>(const payload& other) const { return key > other.key; }
+        bool operator>=(const payload& other) const { return key >= other.key; }
+
+        friend std::ostream& operator<<(std::ostream& os, const payload& p) {
+            return os << "payload(" << p.key << ")";
+        }
+    };
+
+    template<typename TYPE>
+    TYPE makeValue(const int64_t i) {
+        return TYPE(i);
+    }
+
+    template<typename TYPE>
+    TYPE elemOf(const original::serial<TYPE>&);
+
+    // Element type of a serial container.
+    template<typename SERIAL>
+    using elem_t = decltype(elemOf(std::declval<SERIAL>()));
+
+    // Deterministic pseudo random sequence of indexes in [0, n).
+    inline std::vector<int64_t> randomIndexes(const int64_t n, const uint32_t seed = 42) {
+        std::mt19937 gen(seed);
+        std::uniform_int_distribution<int64_t> dist(0, n - 1);
+        std::vector<int64_t> idx(n);
+        for (int64_t i = 0; i < n; ++i) {
+            idx[i] = dist(gen);
+        }
+        return idx;
+    }
+
+    template<typename LIST>
+    LIST filledList(const int64_t n) {
+        LIST list;
+        for (int64_t i = 0; i < n; ++i) {
+            list.pushEnd(makeValue<elem_t<LIST>>(i));
+        }
+        return list;
+    }
+
+    inline void setItems(benchmark::State& state, const int64_t per_iteration) {
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * per_iteration);
+    }
+
+    // ---- Generic benchmarks for every baseList implementation ----
+
+    template<typename LIST>
+    void listPushEnd(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        for (auto _ : state) {
+            LIST list;
+            for (int64_t i = 0; i < n; ++i) {
+                list.pushEnd(makeValue<elem_t<LIST>>(i));
+            }
+            benchmark::DoNotOptimize(&list);
+        }
+        setItems(state, n);
+    }
+
+    template<typename LIST>
+    void listPushBegin(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        for (auto _ : state) {
+            LIST list;
+            for (int64_t i = 0; i < n; ++i) {
+                list.pushBegin(makeValue<elem_t<LIST>>(i));
+            }
+            benchmark::DoNotOptimize(&list);
+        }
+        setItems(state, n);
+    }
+
+    template<typename LIST>
+    void listPopEnd(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        for (auto _ : state) {
+            state.PauseTiming();
+            auto list = filledList<LIST>(n);
+            state.ResumeTiming();
+            while (!list.empty()) {
+                benchmark::DoNotOptimize(list.popEnd());
+            }
+        }
+        setItems(state, n);
+    }
+
+    template<typename LIST>
+    void listPopBegin(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        for (auto _ : state) {
+            state.PauseTiming();
+            auto list = filledList<LIST>(n);
+            state.ResumeTiming();
+            while (!list.empty()) {
+                benchmark::DoNotOptimize(list.popBegin());
+            }
+        }
+        setItems(state, n);
+    }
+
+    template<typename LIST>
+    void listIndexedGet(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto list = filledList<LIST>(n);
+        const auto idx = randomIndexes(n);
+        for (auto _ : state) {
+            for (int64_t i = 0; i < n; ++i) {
+                benchmark::DoNotOptimize(list.get(idx[i]));
+            }
+        }
+        setItems(state, n);
+    }
+
+    // Indexes 0 to n - 1 in order, the loop for (i...) list[i].
+    template<typename LIST>
+    void listSequentialGet(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        // Not const: the chains only move their finger on non-const access.
+        auto list = filledList<LIST>(n);
+        for (auto _ : state) {
+            for (int64_t i = 0; i < n; ++i) {
+                benchmark::DoNotOptimize(list.get(i));
+            }
+        }
+        setItems(state, n);
+    }
+
+    // Random walk moving at most 8 positions between two accesses.
+    template<typename LIST>
+    void listNearbyGet(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        auto list = filledList<LIST>(n);
+        const auto idx = randomIndexes(n);
+        for (auto _ : state) {
+            int64_t pos = n / 2;
+            for (int64_t i = 0; i < n; ++i) {
+                pos = std::clamp<int64_t>(pos + idx[i] % 17 - 8, 0, n - 1);
+                benchmark::DoNotOptimize(list.get(pos));
+            }
+        }
+        setItems(state, n);
+    }
+
+    // Inserts n elements into the middle of a list of n, each one right after the previous one.
+    template<typename LIST>
+    void listSequentialPush(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        for (auto _ : state) {
+            state.PauseTiming();
+            LIST list = filledList<LIST>(n);
+            state.ResumeTiming();
+            for (int64_t i = 0; i < n; ++i) {
+                list.push(n / 2 + i, makeValue<elem_t<LIST>>(i));
+            }
+            benchmark::DoNotOptimize(&list);
+        }
+        setItems(state, n);
+    }
+
+    // Builds a list of n elements, each one pushed at a random index of the list built so far.
+    template<typename LIST>
+    void listRandomPush(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto idx = randomIndexes(n);
+        for (auto _ : state) {
+            LIST list;
+            for (int64_t i = 0; i < n; ++i) {
+                list.push(idx[i] % (i + 1), makeValue<elem_t<LIST>>(i));
+            }
+            benchmark::DoNotOptimize(&list);
+        }
+        setItems(state, n);
+    }
+
+    // Empties a list of n elements, each time popping at a random index.
+    template<typename LIST>
+    void listRandomPop(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto idx = randomIndexes(n);
+        for (auto _ : state) {
+            state.PauseTiming();
+            LIST list = filledList<LIST>(n);
+            state.ResumeTiming();
+            for (int64_t i = 0; i < n; ++i) {
+                benchmark::DoNotOptimize(list.pop(idx[i] % (n - i)));
+            }
+        }
+        setItems(state, n);
+    }
+
+    // Keeps n elements in the list while pushing at the end and popping at the beginning, the way
+    // a queue is used. Each iteration passes n elements through.
+    template<typename LIST>
+    void listQueueChurn(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        LIST list = filledList<LIST>(n);
+        for (auto _ : state) {
+            for (int64_t i = 0; i < n; ++i) {
+                list.pushEnd(makeValue<elem_t<LIST>>(i));
+                benchmark::DoNotOptimize(list.popBegin());
+            }
+        }
+        setItems(state, n);
+    }
+
+    // Same as listQueueChurn in the other direction, pushing at the beginning and popping at the end.
+    template<typename LIST>
+    void listReversedQueueChurn(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        LIST list = filledList<LIST>(n);
+        for (auto _ : state) {
+            for (int64_t i = 0; i < n; ++i) {
+                list.pushBegin(makeValue<elem_t<LIST>>(i));
+                benchmark::DoNotOptimize(list.popEnd());
+            }
+        }
+        setItems(state, n);
+    }
+
+    // Joins n lists of 64 elements into one, the way a merging stage collects its inputs. Freeing
+    // the lists is left out of the timing.
+    template<typename LIST>
+    void listConcat(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        for (auto _ : state) {
+            state.PauseTiming();
+            auto parts = std::make_unique<LIST[]>(n);
+            for (int64_t i = 0; i < n; ++i) {
+                parts[i] = filledList<LIST>(64);
+            }
+            auto joined = std::make_unique<LIST>();
+            state.ResumeTiming();
+            for (int64_t i = 0; i < n; ++i) {
+                joined->concat(parts[i]);
+            }
+            benchmark::DoNotOptimize(joined.get());
+            state.PauseTiming();
+            joined.reset();
+            parts.reset();
+            state.ResumeTiming();
+        }
+        setItems(state, n);
+    }
+
+    // listConcat without concat(): every element is popped off its list and pushed onto the result.
+    template<typename LIST>
+    void listConcatByElement(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        for (auto _ : state) {
+            state.PauseTiming();
+            auto parts = std::make_unique<LIST[]>(n);
+            for (int64_t i = 0; i < n; ++i) {
+                parts[i] = filledList<LIST>(64);
+            }
+            auto joined = std::make_unique<LIST>();
+            state.ResumeTiming();
+            for (int64_t i = 0; i < n; ++i) {
+                while (!parts[i].empty()) {
+                    joined->pushEnd(parts[i].popBegin());
+                }
+            }
+            benchmark::DoNotOptimize(joined.get());
+            state.PauseTiming();
+            joined.reset();
+            parts.reset();
+            state.ResumeTiming();
+        }
+        setItems(state, n);
+    }
+
+    template<typename LIST>
+    void listIterate(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto list = filledList<LIST>(n);
+        for (auto _ : state) {
+            for (const auto it = list.begin(); it.isValid(); it.next()) {
+                benchmark::DoNotOptimize(it.get());
+            }
+        }
+        setItems(state, n);
+    }
+
+    // Range-for through begin() and end(), which wrap heap allocated virtual iterators.
+    template<typename LIST>
+    void listRangeFor(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto list = filledList<LIST>(n);
+        for (auto _ : state) {
+            for (const auto& e : list) {
+                benchmark::DoNotOptimize(e);
+            }
+        }
+        setItems(state, n);
+    }
+
+    // Range-for through fastBegin() and fastEnd().
+    template<typename LIST>
+    void listFastRangeFor(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto list = filledList<LIST>(n);
+        for (auto _ : state) {
+            for (const auto& e : original::fast(list)) {
+                benchmark::DoNotOptimize(e);
+            }
+        }
+        setItems(state, n);
+    }
+
+    template<typename LIST>
+    void listCopy(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto list = filledList<LIST>(n);
+        for (auto _ : state) {
+            LIST copied(list);
+            benchmark::DoNotOptimize(&copied);
+        }
+        setItems(state, n);
+    }
+
+    template<typename LIST>
+    void listMove(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        auto list = filledList<LIST>(n);
+        for (auto _ : state) {
+            LIST moved(std::move(list));
+            list = std::move(moved);
+            benchmark::DoNotOptimize(&list);
+        }
+        setItems(state, 1);
+    }
+
+    // Builds and destroys 1024 lists of n elements each, the way short lists come and go as locals
+    // or members. Items are lists, so allocations show directly in the rate.
+    template<typename LIST>
+    void listShortLived(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        for (auto _ : state) {
+            for (int64_t k = 0; k < 1024; ++k) {
+                LIST list;
+                for (int64_t i = 0; i < n; ++i) {
+                    list.pushEnd(makeValue<elem_t<LIST>>(i));
+                }
+                benchmark::DoNotOptimize(&list);
+            }
+        }
+        setItems(state, 1024);
+    }
+
+    // ---- Capacity control, for lists providing reserve() and range construction ----
+
+    template<typename LIST>
+    void listReservePushEnd(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        for (auto _ : state) {
+            LIST list;
+            list.reserve(n);
+            for (int64_t i = 0; i < n; ++i) {
+                list.pushEnd(makeValue<elem_t<LIST>>(i));
+            }
+            benchmark::DoNotOptimize(&list);
+        }
+        setItems(state, n);
+    }
+
+    template<typename LIST>
+    void listRangeConstruct(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto list = filledList<LIST>(n);
+        for (auto _ : state) {
+            LIST copied(list.begin(), list.end());
+            benchmark::DoNotOptimize(&copied);
+        }
+        setItems(state, n);
+    }
+
+} // namespace bench
+
+// Element counts shared by every container benchmark.
+#define BENCH_COUNTS RangeMultiplier(8)->Range(1 << 8, 1 << 14)
+
+// Smaller counts for containers whose operations are linear in the size.
+#define BENCH_COUNTS_SMALL RangeMultiplier(4)->Range(1 << 6, 1 << 10)
+
+// Registers every generic list benchmark for LIST with the given element counts.
+#define BENCH_LIST(LIST, COUNTS) \
+    BENCHMARK(bench::listPushEnd<LIST>)->COUNTS; \
+    BENCHMARK(bench::listPushBegin<LIST>)->COUNTS; \
+    BENCHMARK(bench::listPopEnd<LIST>)->COUNTS; \
+    BENCHMARK(bench::listPopBegin<LIST>)->COUNTS; \
+    BENCHMARK(bench::listIndexedGet<LIST>)->COUNTS; \
+    BENCHMARK(bench::listIterate<LIST>)->COUNTS; \
+    BENCHMARK(bench::listCopy<LIST>)->COUNTS; \
+    BENCHMARK(bench::listMove<LIST>)->COUNTS
+
+// Registers the short lived list benchmark for LIST, around the sizes small buffers are made for.
+#define BENCH_SHORT_LIVED(LIST) \
+    BENCHMARK(bench::listShortLived<LIST>)->Arg(0)->Arg(4)->Arg(8)->Arg(16)
+
+// Registers the capacity control benchmarks for LIST with the given element counts.
+#define BENCH_RESERVE(LIST, COUNTS) \
+    BENCHMARK(bench::listReservePushEnd<LIST>)->COUNTS; \
+    BENCHMARK(bench::listRangeConstruct<LIST>)->COUNTS
+
+// Registers the index pattern benchmarks for LIST, next to the random indexes of listIndexedGet.
+#define BENCH_INDEXED(LIST, COUNTS) \
+    BENCHMARK(bench::listSequentialGet<LIST>)->COUNTS; \
+    BENCHMARK(bench::listNearbyGet<LIST>)->COUNTS; \
+    BENCHMARK(bench::listSequentialPush<LIST>)->COUNTS
+
+// Registers the benchmarks pushing and popping at random indexes for LIST.
+#define BENCH_RANDOM_INDEX(LIST, COUNTS) \
+    BENCHMARK(bench::listRandomPush<LIST>)->COUNTS; \
+    BENCHMARK(bench::listRandomPop<LIST>)->COUNTS
+
+// Registers the benchmarks streaming elements through a list of steady size for LIST.
+#define BENCH_CHURN(LIST, COUNTS) \
+    BENCHMARK(bench::listQueueChurn<LIST>)->COUNTS; \
+    BENCHMARK(bench::listReversedQueueChurn<LIST>)->COUNTS
+
+// Registers the benchmarks joining many short lists for LIST, which has to provide concat().
+#define BENCH_CONCAT(LIST, COUNTS) \
+    BENCHMARK(bench::listConcat<LIST>)->COUNTS; \
+    BENCHMARK(bench::listConcatByElement<LIST>)->COUNTS
+
+// Registers the range-for benchmarks for LIST, which has to provide fastBegin() and fastEnd().
+#define BENCH_RANGE_FOR(LIST, COUNTS) \
+    BENCHMARK(bench::listRangeFor<LIST>)->COUNTS; \
+    BENCHMARK(bench::listFastRangeFor<LIST>)->COUNTS
+
+#endif // BENCH_COMMON_H
@@ -0,0 +1,60 @@
+#include <mutex>
+#include <thread>
+#include "bench_common.h"
+#include "concurrentPrique.h"
+#include "prique.h"
+
+namespace {
+
+    constexpr int64_t PRIQUE_PREFILL = 1 << 14;
+
+    // The baseline being replaced: one prique guarded by a mutex.
+    class lockedPrique {
+        original::prique<int64_t> prique_;
+        std::mutex mutex_;
+    public:
+        void push(const int64_t e) {
+            std::lock_guard lock(this->mutex_);
+            this->prique_.push(e);
+        }
+
+        bool tryPop(int64_t& e) {
+            std::lock_guard lock(this->mutex_);
+            if (this->prique_.empty())
+                return false;
+            e = this->prique_.pop();
+            return true;
+        }
+    };
+
+    template<typename PRIQUE>
+    PRIQUE* shared_prique = nullptr;
+
+    // Every thread alternates a push of a random key and a tryPop on a shared, prefilled queue.
+    template<typename PRIQUE>
+    void priquePushPop(benchmark::State& state) {
+        if (state.thread_index() == 0) {
+            shared_prique<PRIQUE> = new PRIQUE;
+            const auto keys = bench::randomIndexes(PRIQUE_PREFILL, 7);
+            for (int64_t i = 0; i < PRIQUE_PREFILL; ++i) {
+                shared_prique<PRIQUE>->push(keys[i]);
+            }
+        }
+        const auto keys = bench::randomIndexes(PRIQUE_PREFILL, state.thread_index() + 1);
+        int64_t i = 0;
+        int64_t e = 0;
+        for (auto _ : state) {
+            shared_prique<PRIQUE>->push(keys[i++ & (PRIQUE_PREFILL - 1)]);
+            benchmark::DoNotOptimize(shared_prique<PRIQUE>->tryPop(e));
+        }
+        if (state.thread_index() == 0) {
+            delete shared_prique<PRIQUE>;
+            shared_prique<PRIQUE> = nullptr;
+        }
+        bench::setItems(state, 2);
+    }
+
+} // namespace
+
+BENCHMARK_TEMPLATE(priquePushPop, lockedPrique)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(priquePushPop, original::concurrentPrique<int64_t>)->ThreadRange(1, 16)->UseRealTime();
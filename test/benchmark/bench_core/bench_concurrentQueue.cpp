@@ -0,0 +1,108 @@
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "bench_common.h"
+#include "circularQueue.h"
+#include "mpmcQueue.h"
+#include "queue.h"
+#include "spscQueue.h"
+
+namespace {
+
+    constexpr int64_t TRANSFER_ITEMS = 1 << 18;
+
+    // The baseline being replaced: a queue guarded by a mutex.
+    template<typename TYPE>
+    class lockedQueue {
+        original::queue<TYPE, original::circularQueue> queue_;
+        std::mutex mutex_;
+    public:
+        explicit lockedQueue(uint32_t) {}
+
+        void push(const TYPE& e) {
+            std::lock_guard lock(this->mutex_);
+            this->queue_.push(e);
+        }
+
+        TYPE pop() {
+            while (true) {
+                {
+                    std::lock_guard lock(this->mutex_);
+                    if (!this->queue_.empty())
+                        return this->queue_.pop();
+                }
+                std::this_thread::yield();
+            }
+        }
+    };
+
+    // Moves TRANSFER_ITEMS integers from range(0) producer threads to as many consumer threads.
+    template<typename QUEUE>
+    void queueTransfer(benchmark::State& state) {
+        const int64_t threads = state.range(0);
+        const int64_t per_thread = TRANSFER_ITEMS / threads;
+        for (auto _ : state) {
+            QUEUE q(1024);
+            std::vector<std::thread> workers;
+            for (int64_t t = 0; t < threads; ++t) {
+                workers.emplace_back([&q, per_thread] {
+                    for (int64_t i = 0; i < per_thread; ++i) {
+                        q.push(i);
+                    }
+                });
+                workers.emplace_back([&q, per_thread] {
+                    int64_t sum = 0;
+                    for (int64_t i = 0; i < per_thread; ++i) {
+                        sum += q.pop();
+                    }
+                    benchmark::DoNotOptimize(sum);
+                });
+            }
+            for (auto& worker : workers) {
+                worker.join();
+            }
+        }
+        bench::setItems(state, per_thread * threads);
+    }
+
+    // Single producer and consumer moving the integers in batches of range(0).
+    void spscQueueBatchTransfer(benchmark::State& state) {
+        const auto batch_size = static_cast<uint32_t>(state.range(0));
+        for (auto _ : state) {
+            original::spscQueue<int64_t> q(1024);
+            std::thread producer([&q, batch_size] {
+                std::vector<int64_t> batch(batch_size);
+                for (int64_t next = 0; next < TRANSFER_ITEMS;) {
+                    const uint32_t n = std::min<int64_t>(batch_size, TRANSFER_ITEMS - next);
+                    for (uint32_t i = 0; i < n; ++i) {
+                        batch[i] = next + i;
+                    }
+                    const uint32_t pushed = q.pushBatch(batch.data(), n);
+                    next += pushed;
+                    if (pushed == 0)
+                        std::this_thread::yield();
+                }
+            });
+            std::vector<int64_t> batch(batch_size);
+            int64_t sum = 0;
+            for (int64_t received = 0; received < TRANSFER_ITEMS;) {
+                const uint32_t n = q.popBatch(batch.data(), batch_size);
+                for (uint32_t i = 0; i < n; ++i) {
+                    sum += batch[i];
+                }
+                received += n;
+                if (n == 0)
+                    std::this_thread::yield();
+            }
+            benchmark::DoNotOptimize(sum);
+            producer.join();
+        }
+        bench::setItems(state, TRANSFER_ITEMS);
+    }
+
+} // namespace
+
+BENCHMARK_TEMPLATE(queueTransfer, lockedQueue<int64_t>)->Arg(1)->Arg(2)->Arg(4)->UseRealTime();
+BENCHMARK_TEMPLATE(queueTransfer, original::spscQueue<int64_t>)->Arg(1)->UseRealTime();
+BENCHMARK_TEMPLATE(queueTransfer, original::mpmcQueue<int64_t>)->Arg(1)->Arg(2)->Arg(4)->UseRealTime();
+BENCHMARK(spscQueueBatchTransfer)->Arg(16)->Arg(256)->UseRealTime();
@@ -0,0 +1,112 @@
+#include "bench_common.h"
+#include "deque.h"
+#include "blocksList.h"
+#include "circularQueue.h"
+
+namespace {
+
+    template<typename ADAPTER, typename TYPE>
+    ADAPTER filledDeque(const int64_t n) {
+        ADAPTER adapter;
+        for (int64_t i = 0; i < n; ++i) {
+            adapter.pushEnd(bench::makeValue<TYPE>(i));
+        }
+        return adapter;
+    }
+
+    template<typename ADAPTER, typename TYPE>
+    void dequePush(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        for (auto _ : state) {
+            ADAPTER adapter;
+            for (int64_t i = 0; i < n; ++i) {
+                adapter.pushEnd(bench::makeValue<TYPE>(i));
+            }
+            benchmark::DoNotOptimize(&adapter);
+        }
+        bench::setItems(state, n);
+    }
+
+    template<typename ADAPTER, typename TYPE>
+    void dequePop(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        for (auto _ : state) {
+            state.PauseTiming();
+            auto adapter = filledDeque<ADAPTER, TYPE>(n);
+            state.ResumeTiming();
+            while (!adapter.empty()) {
+                benchmark::DoNotOptimize(adapter.popBegin());
+            }
+        }
+        bench::setItems(state, n);
+    }
+
+    template<typename ADAPTER, typename TYPE>
+    void dequePushBegin(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        for (auto _ : state) {
+            ADAPTER adapter;
+            for (int64_t i = 0; i < n; ++i) {
+                adapter.pushBegin(bench::makeValue<TYPE>(i));
+            }
+            benchmark::DoNotOptimize(&adapter);
+        }
+        bench::setItems(state, n);
+    }
+
+    template<typename ADAPTER, typename TYPE>
+    void dequePopEnd(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        for (auto _ : state) {
+            state.PauseTiming();
+            auto adapter = filledDeque<ADAPTER, TYPE>(n);
+            state.ResumeTiming();
+            while (!adapter.empty()) {
+                benchmark::DoNotOptimize(adapter.popEnd());
+            }
+        }
+        bench::setItems(state, n);
+    }
+
+    template<typename ADAPTER, typename TYPE>
+    void dequeCopy(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto adapter = filledDeque<ADAPTER, TYPE>(n);
+        for (auto _ : state) {
+            ADAPTER copied(adapter);
+            benchmark::DoNotOptimize(&copied);
+        }
+        bench::setItems(state, n);
+    }
+
+    template<typename ADAPTER, typename TYPE>
+    void dequeMove(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        auto adapter = filledDeque<ADAPTER, TYPE>(n);
+        for (auto _ : state) {
+            ADAPTER moved(std::move(adapter));
+            adapter = std::move(moved);
+            benchmark::DoNotOptimize(&adapter);
+        }
+        bench::setItems(state, 1);
+    }
+
+} // namespace
+
+using p64 = bench::payload<64>;
+using p256 = bench::payload<256>;
+
+#define BENCH_DEQUE(SERIAL, TYPE) \
+    BENCHMARK_TEMPLATE(dequePush, original::deque<TYPE, SERIAL>, TYPE)->BENCH_COUNTS; \
+    BENCHMARK_TEMPLATE(dequePop, original::deque<TYPE, SERIAL>, TYPE)->BENCH_COUNTS; \
+    BENCHMARK_TEMPLATE(dequePushBegin, original::deque<TYPE, SERIAL>, TYPE)->BENCH_COUNTS; \
+    BENCHMARK_TEMPLATE(dequePopEnd, original::deque<TYPE, SERIAL>, TYPE)->BENCH_COUNTS; \
+    BENCHMARK_TEMPLATE(dequeCopy, original::deque<TYPE, SERIAL>, TYPE)->BENCH_COUNTS; \
+    BENCHMARK_TEMPLATE(dequeMove, original::deque<TYPE, SERIAL>, TYPE)->BENCH_COUNTS
+
+BENCH_DEQUE(original::chain, int);
+BENCH_DEQUE(original::chain, p64);
+BENCH_DEQUE(original::chain, p256);
+BENCH_DEQUE(original::blocksList, int);
+BENCH_DEQUE(original::circularQueue, int);
+BENCH_DEQUE(original::circularQueue, p64);
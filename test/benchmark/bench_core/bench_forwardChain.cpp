@@ -0,0 +1,23 @@
+#include "bench_common.h"
+#include "forwardChain.h"
+
+using forwardChainInt = original::forwardChain<int>;
+using forwardChainP64 = original::forwardChain<bench::payload<64>>;
+using forwardChainP256 = original::forwardChain<bench::payload<256>>;
+
+BENCH_LIST(forwardChainInt, BENCH_COUNTS_SMALL);
+BENCH_LIST(forwardChainP64, BENCH_COUNTS_SMALL);
+BENCH_LIST(forwardChainP256, BENCH_COUNTS_SMALL);
+BENCH_INDEXED(forwardChainInt, BENCH_COUNTS_SMALL);
+BENCH_CONCAT(forwardChainInt, BENCH_COUNTS_SMALL);
+// Only the fast loop: comparing against end() of a forwardChain dereferences its null end node.
+BENCHMARK(bench::listFastRangeFor<forwardChainInt>)->BENCH_COUNTS_SMALL;
+
+// Nodes recycled through a poolAllocator owned by each list.
+using forwardChainIntPool = original::forwardChain<int, original::poolAllocator<int>>;
+using forwardChainP64Pool = original::forwardChain<bench::payload<64>, original::poolAllocator<bench::payload<64>>>;
+
+BENCH_LIST(forwardChainIntPool, BENCH_COUNTS_SMALL);
+BENCH_LIST(forwardChainP64Pool, BENCH_COUNTS_SMALL);
+// Lists never share a pool, so concat() moves the elements into nodes of the receiving list.
+BENCH_CONCAT(forwardChainIntPool, BENCH_COUNTS_SMALL);
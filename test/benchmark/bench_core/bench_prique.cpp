@@ -0,0 +1,154 @@
+#include "addressablePrique.h"
+#include "bench_common.h"
+#include "prique.h"
+#include "vector.h"
+
+namespace {
+
+    template<typename ADAPTER, typename TYPE>
+    ADAPTER filledPrique(const int64_t n) {
+        ADAPTER adapter;
+        for (int64_t i = 0; i < n; ++i) {
+            adapter.push(bench::makeValue<TYPE>(i));
+        }
+        return adapter;
+    }
+
+    template<typename ADAPTER, typename TYPE>
+    void priquePush(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        for (auto _ : state) {
+            ADAPTER adapter;
+            for (int64_t i = 0; i < n; ++i) {
+                adapter.push(bench::makeValue<TYPE>(i));
+            }
+            benchmark::DoNotOptimize(&adapter);
+        }
+        bench::setItems(state, n);
+    }
+
+    template<typename ADAPTER, typename TYPE>
+    void priquePop(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        for (auto _ : state) {
+            state.PauseTiming();
+            auto adapter = filledPrique<ADAPTER, TYPE>(n);
+            state.ResumeTiming();
+            while (!adapter.empty()) {
+                benchmark::DoNotOptimize(adapter.pop());
+            }
+        }
+        bench::setItems(state, n);
+    }
+
+    template<typename ADAPTER, typename TYPE>
+    void priqueCopy(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto adapter = filledPrique<ADAPTER, TYPE>(n);
+        for (auto _ : state) {
+            ADAPTER copied(adapter);
+            benchmark::DoNotOptimize(&copied);
+        }
+        bench::setItems(state, n);
+    }
+
+    template<typename ADAPTER, typename TYPE>
+    void priqueMove(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        auto adapter = filledPrique<ADAPTER, TYPE>(n);
+        for (auto _ : state) {
+            ADAPTER moved(std::move(adapter));
+            adapter = std::move(moved);
+            benchmark::DoNotOptimize(&adapter);
+        }
+        bench::setItems(state, 1);
+    }
+
+    // Pushes n random keys onto a queue already holding n, as one batch.
+    template<typename ADAPTER, typename TYPE>
+    void priquePushAll(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto keys = bench::randomIndexes(n);
+        original::vector<TYPE> batch;
+        for (int64_t i = 0; i < n; ++i) {
+            batch.pushEnd(bench::makeValue<TYPE>(keys[i]));
+        }
+        for (auto _ : state) {
+            state.PauseTiming();
+            auto adapter = filledPrique<ADAPTER, TYPE>(n);
+            state.ResumeTiming();
+            adapter.pushAll(batch.begin(), batch.end());
+            benchmark::DoNotOptimize(&adapter);
+        }
+        bench::setItems(state, n);
+    }
+
+    template<typename ADAPTER, typename TYPE>
+    void priquePopN(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        for (auto _ : state) {
+            state.PauseTiming();
+            auto adapter = filledPrique<ADAPTER, TYPE>(n);
+            state.ResumeTiming();
+            benchmark::DoNotOptimize(adapter.drainSorted());
+        }
+        bench::setItems(state, n);
+    }
+
+    // Lowers n randomly chosen keys, as relaxing edges in Dijkstra does.
+    template<typename ADAPTER, typename TYPE>
+    void priqueDecreaseKey(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto idx = bench::randomIndexes(n);
+        for (auto _ : state) {
+            state.PauseTiming();
+            ADAPTER adapter;
+            original::vector<typename ADAPTER::handle> handles;
+            handles.reserve(n);
+            for (int64_t i = 0; i < n; ++i) {
+                handles.pushEnd(adapter.push(bench::makeValue<TYPE>(n + i)));
+            }
+            state.ResumeTiming();
+            for (int64_t i = 0; i < n; ++i) {
+                adapter.decreaseKey(handles[idx[i]], bench::makeValue<TYPE>(idx[i] - i));
+            }
+            benchmark::DoNotOptimize(adapter.top());
+        }
+        bench::setItems(state, n);
+    }
+
+} // namespace
+
+using p64 = bench::payload<64>;
+using p256 = bench::payload<256>;
+
+#define BENCH_PRIQUE(TYPE) \
+    BENCHMARK_TEMPLATE(priquePush, original::prique<TYPE>, TYPE)->BENCH_COUNTS; \
+    BENCHMARK_TEMPLATE(priquePop, original::prique<TYPE>, TYPE)->BENCH_COUNTS; \
+    BENCHMARK_TEMPLATE(priqueCopy, original::prique<TYPE>, TYPE)->BENCH_COUNTS; \
+    BENCHMARK_TEMPLATE(priqueMove, original::prique<TYPE>, TYPE)->BENCH_COUNTS; \
+    BENCHMARK_TEMPLATE(priquePushAll, original::prique<TYPE>, TYPE)->BENCH_COUNTS; \
+    BENCHMARK_TEMPLATE(priquePopN, original::prique<TYPE>, TYPE)->BENCH_COUNTS
+
+BENCH_PRIQUE(int);
+BENCH_PRIQUE(p64);
+BENCH_PRIQUE(p256);
+
+// Binary against 4-ary layout, over block and contiguous storage.
+#define BENCH_PRIQUE_ARITY(TYPE, SERIAL, ARITY) \
+    BENCHMARK_TEMPLATE(priquePush, original::prique<TYPE, original::increaseComparator, SERIAL, ARITY>, TYPE)->BENCH_COUNTS; \
+    BENCHMARK_TEMPLATE(priquePop, original::prique<TYPE, original::increaseComparator, SERIAL, ARITY>, TYPE)->BENCH_COUNTS
+
+BENCH_PRIQUE_ARITY(int, original::blocksList, 4);
+BENCH_PRIQUE_ARITY(int, original::vector, 2);
+BENCH_PRIQUE_ARITY(int, original::vector, 4);
+BENCH_PRIQUE_ARITY(p64, original::blocksList, 4);
+
+#define BENCH_ADDRESSABLE_PRIQUE(TYPE, ARITY) \
+    BENCHMARK_TEMPLATE(priquePush, original::addressablePrique<TYPE, original::increaseComparator, ARITY>, TYPE)->BENCH_COUNTS; \
+    BENCHMARK_TEMPLATE(priquePop, original::addressablePrique<TYPE, original::increaseComparator, ARITY>, TYPE)->BENCH_COUNTS; \
+    BENCHMARK_TEMPLATE(priqueDecreaseKey, original::addressablePrique<TYPE, original::increaseComparator, ARITY>, TYPE)->BENCH_COUNTS
+
+BENCH_ADDRESSABLE_PRIQUE(int64_t, 2);
+BENCH_ADDRESSABLE_PRIQUE(int64_t, 4);
+BENCH_ADDRESSABLE_PRIQUE(p64, 4);
@@ -0,0 +1,99 @@
+#include "bench_common.h"
+#include "queue.h"
+#include "blocksList.h"
+#include "circularQueue.h"
+
+namespace {
+
+    template<typename ADAPTER, typename TYPE>
+    ADAPTER filledQueue(const int64_t n) {
+        ADAPTER adapter;
+        for (int64_t i = 0; i < n; ++i) {
+            adapter.push(bench::makeValue<TYPE>(i));
+        }
+        return adapter;
+    }
+
+    template<typename ADAPTER, typename TYPE>
+    void queuePush(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        for (auto _ : state) {
+            ADAPTER adapter;
+            for (int64_t i = 0; i < n; ++i) {
+                adapter.push(bench::makeValue<TYPE>(i));
+            }
+            benchmark::DoNotOptimize(&adapter);
+        }
+        bench::setItems(state, n);
+    }
+
+    template<typename ADAPTER, typename TYPE>
+    void queuePop(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        for (auto _ : state) {
+            state.PauseTiming();
+            auto adapter = filledQueue<ADAPTER, TYPE>(n);
+            state.ResumeTiming();
+            while (!adapter.empty()) {
+                benchmark::DoNotOptimize(adapter.pop());
+            }
+        }
+        bench::setItems(state, n);
+    }
+
+    // Steady FIFO traffic: the queue holds n elements, every step pops the head and pushes a new tail.
+    template<typename ADAPTER, typename TYPE>
+    void queueFifo(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        auto adapter = filledQueue<ADAPTER, TYPE>(n);
+        int64_t next = n;
+        for (auto _ : state) {
+            for (int64_t i = 0; i < n; ++i) {
+                benchmark::DoNotOptimize(adapter.pop());
+                adapter.push(bench::makeValue<TYPE>(next++));
+            }
+        }
+        bench::setItems(state, n);
+    }
+
+    template<typename ADAPTER, typename TYPE>
+    void queueCopy(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto adapter = filledQueue<ADAPTER, TYPE>(n);
+        for (auto _ : state) {
+            ADAPTER copied(adapter);
+            benchmark::DoNotOptimize(&copied);
+        }
+        bench::setItems(state, n);
+    }
+
+    template<typename ADAPTER, typename TYPE>
+    void queueMove(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        auto adapter = filledQueue<ADAPTER, TYPE>(n);
+        for (auto _ : state) {
+            ADAPTER moved(std::move(adapter));
+            adapter = std::move(moved);
+            benchmark::DoNotOptimize(&adapter);
+        }
+        bench::setItems(state, 1);
+    }
+
+} // namespace
+
+using p64 = bench::payload<64>;
+using p256 = bench::payload<256>;
+
+#define BENCH_QUEUE(SERIAL, TYPE) \
+    BENCHMARK_TEMPLATE(queuePush, original::queue<TYPE, SERIAL>, TYPE)->BENCH_COUNTS; \
+    BENCHMARK_TEMPLATE(queuePop, original::queue<TYPE, SERIAL>, TYPE)->BENCH_COUNTS; \
+    BENCHMARK_TEMPLATE(queueFifo, original::queue<TYPE, SERIAL>, TYPE)->BENCH_COUNTS; \
+    BENCHMARK_TEMPLATE(queueCopy, original::queue<TYPE, SERIAL>, TYPE)->BENCH_COUNTS; \
+    BENCHMARK_TEMPLATE(queueMove, original::queue<TYPE, SERIAL>, TYPE)->BENCH_COUNTS
+
+BENCH_QUEUE(original::chain, int);
+BENCH_QUEUE(original::chain, p64);
+BENCH_QUEUE(original::chain, p256);
+BENCH_QUEUE(original::blocksList, int);
+BENCH_QUEUE(original::circularQueue, int);
+BENCH_QUEUE(original::circularQueue, p64);
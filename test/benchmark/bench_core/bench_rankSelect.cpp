@@ -0,0 +1,79 @@
+#include "bench_common.h"
+#include "bitSet.h"
+#include "rankSelect.h"
+
+namespace {
+
+    original::bitSet halfFilledBitSet(const int64_t n, const uint32_t seed) {
+        original::bitSet bs(n);
+        std::mt19937_64 gen(seed);
+        for (int64_t i = 0; i < n; i += 64) {
+            const uint64_t bits = gen();
+            for (int64_t j = 0; j < 64 && i + j < n; ++j) {
+                if (bits >> j & 1) bs.set(i + j, true);
+            }
+        }
+        return bs;
+    }
+
+    void rankSelectBuild(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto bs = halfFilledBitSet(n, 1);
+        for (auto _ : state) {
+            const original::rankSelect rs(bs);
+            benchmark::DoNotOptimize(rs.ones());
+        }
+        bench::setItems(state, n);
+    }
+
+    void rankSelectRank(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto bs = halfFilledBitSet(n, 1);
+        const original::rankSelect rs(bs);
+        const auto idx = bench::randomIndexes(n);
+        for (auto _ : state) {
+            for (int64_t i = 0; i < n; ++i) {
+                benchmark::DoNotOptimize(rs.rank1(idx[i]));
+            }
+        }
+        bench::setItems(state, n);
+    }
+
+    void rankSelectSelect(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto bs = halfFilledBitSet(n, 1);
+        const original::rankSelect rs(bs);
+        const auto idx = bench::randomIndexes(rs.ones());
+        for (auto _ : state) {
+            for (uint32_t i = 0; i < rs.ones(); ++i) {
+                benchmark::DoNotOptimize(rs.select1(idx[i]));
+            }
+        }
+        bench::setItems(state, rs.ones());
+    }
+
+    // What a rank costs without the index: counting the set bits in front of the position.
+    void bitSetScanRank(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto bs = halfFilledBitSet(n, 1);
+        const auto idx = bench::randomIndexes(n);
+        for (auto _ : state) {
+            for (int64_t i = 0; i < n; i += n / 16) {
+                uint32_t count = 0;
+                for (uint32_t pos = bs.findFirst(); pos < idx[i]; pos = bs.findNext(pos)) {
+                    count += 1;
+                }
+                benchmark::DoNotOptimize(count);
+            }
+        }
+        bench::setItems(state, 16);
+    }
+
+} // namespace
+
+#define BENCH_RANK_COUNTS RangeMultiplier(16)->Range(1 << 12, 1 << 24)
+
+BENCHMARK(rankSelectBuild)->BENCH_RANK_COUNTS;
+BENCHMARK(rankSelectRank)->BENCH_RANK_COUNTS;
+BENCHMARK(rankSelectSelect)->BENCH_RANK_COUNTS;
+BENCHMARK(bitSetScanRank)->BENCH_RANK_COUNTS;
@@ -0,0 +1,181 @@
+#include "bench_common.h"
+#include "bitSet.h"
+#include "roaringBitmap.h"
+
+namespace {
+
+    // Sets each of n bits with probability permille / 1000, or in runs of 1000 bits when permille is 0.
+    original::bitSet densityBitSet(const int64_t n, const int64_t permille, const uint32_t seed) {
+        original::bitSet bs(n);
+        std::mt19937_64 gen(seed);
+        for (int64_t i = 0; i < n; ++i) {
+            const bool set = permille == 0 ? i / 1000 % 3 == 0 : static_cast<int64_t>(gen() % 1000) < permille;
+            if (set) bs.set(i, true);
+        }
+        return bs;
+    }
+
+    original::roaringBitmap densityRoaring(const int64_t n, const int64_t permille, const uint32_t seed) {
+        original::roaringBitmap rb(densityBitSet(n, permille, seed));
+        rb.runOptimize();
+        return rb;
+    }
+
+    void setBytes(benchmark::State& state, const uint64_t bytes) {
+        state.counters["bytes"] = static_cast<double>(bytes);
+    }
+
+    void roaringBitmapAdd(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto idx = bench::randomIndexes(n);
+        for (auto _ : state) {
+            original::roaringBitmap rb;
+            for (int64_t i = 0; i < n / 2; ++i) {
+                rb.add(idx[i]);
+            }
+            benchmark::DoNotOptimize(rb.cardinality());
+        }
+        bench::setItems(state, n / 2);
+    }
+
+    void roaringBitmapContains(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto rb = densityRoaring(n, state.range(1), 1);
+        const auto idx = bench::randomIndexes(n);
+        for (auto _ : state) {
+            for (int64_t i = 0; i < n; ++i) {
+                benchmark::DoNotOptimize(rb.contains(idx[i]));
+            }
+        }
+        setBytes(state, rb.sizeInBytes());
+        bench::setItems(state, n);
+    }
+
+    void bitSetContains(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto bs = densityBitSet(n, state.range(1), 1);
+        const auto idx = bench::randomIndexes(n);
+        for (auto _ : state) {
+            for (int64_t i = 0; i < n; ++i) {
+                benchmark::DoNotOptimize(bs.get(idx[i]));
+            }
+        }
+        setBytes(state, (n + 63) / 64 * 8);
+        bench::setItems(state, n);
+    }
+
+    void roaringBitmapAnd(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto a = densityRoaring(n, state.range(1), 1);
+        const auto b = densityRoaring(n, state.range(1), 2);
+        for (auto _ : state) {
+            auto res = a & b;
+            benchmark::DoNotOptimize(res.empty());
+        }
+        setBytes(state, a.sizeInBytes());
+        bench::setItems(state, n);
+    }
+
+    void bitSetAnd(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto a = densityBitSet(n, state.range(1), 1);
+        const auto b = densityBitSet(n, state.range(1), 2);
+        for (auto _ : state) {
+            auto res = a & b;
+            benchmark::DoNotOptimize(res);
+        }
+        setBytes(state, (n + 63) / 64 * 8);
+        bench::setItems(state, n);
+    }
+
+    void roaringBitmapOr(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto a = densityRoaring(n, state.range(1), 1);
+        const auto b = densityRoaring(n, state.range(1), 2);
+        for (auto _ : state) {
+            auto res = a | b;
+            benchmark::DoNotOptimize(res.empty());
+        }
+        setBytes(state, a.sizeInBytes());
+        bench::setItems(state, n);
+    }
+
+    void bitSetOr(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto a = densityBitSet(n, state.range(1), 1);
+        const auto b = densityBitSet(n, state.range(1), 2);
+        for (auto _ : state) {
+            auto res = a | b;
+            benchmark::DoNotOptimize(res);
+        }
+        setBytes(state, (n + 63) / 64 * 8);
+        bench::setItems(state, n);
+    }
+
+    void roaringBitmapIterate(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto rb = densityRoaring(n, state.range(1), 1);
+        for (auto _ : state) {
+            uint64_t sum = 0;
+            for (const uint32_t v : rb) {
+                sum += v;
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        setBytes(state, rb.sizeInBytes());
+        bench::setItems(state, n);
+    }
+
+    void bitSetIterateSetBits(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto bs = densityBitSet(n, state.range(1), 1);
+        for (auto _ : state) {
+            uint64_t sum = 0;
+            for (const uint32_t v : bs.setBits()) {
+                sum += v;
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        setBytes(state, (n + 63) / 64 * 8);
+        bench::setItems(state, n);
+    }
+
+    void roaringBitmapRank(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto rb = densityRoaring(n, state.range(1), 1);
+        const auto idx = bench::randomIndexes(n);
+        for (auto _ : state) {
+            for (int64_t i = 0; i < n; i += 64) {
+                benchmark::DoNotOptimize(rb.rank(idx[i]));
+            }
+        }
+        bench::setItems(state, n / 64);
+    }
+
+    void roaringBitmapSerialize(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto rb = densityRoaring(n, state.range(1), 1);
+        for (auto _ : state) {
+            auto res = original::roaringBitmap::deserialize(rb.serialize());
+            benchmark::DoNotOptimize(res.empty());
+        }
+        setBytes(state, rb.sizeInBytes());
+        bench::setItems(state, n);
+    }
+
+} // namespace
+
+// Universe sizes against the permille of set bits: sparse, half full, and 0 for runs of 1000 set bits.
+#define BENCH_ROARING_DENSITIES ArgsProduct({{1 << 16, 1 << 20, 1 << 24}, {1, 500, 0}})
+
+BENCHMARK(roaringBitmapAdd)->RangeMultiplier(16)->Range(1 << 12, 1 << 20);
+BENCHMARK(roaringBitmapContains)->BENCH_ROARING_DENSITIES;
+BENCHMARK(bitSetContains)->BENCH_ROARING_DENSITIES;
+BENCHMARK(roaringBitmapAnd)->BENCH_ROARING_DENSITIES;
+BENCHMARK(bitSetAnd)->BENCH_ROARING_DENSITIES;
+BENCHMARK(roaringBitmapOr)->BENCH_ROARING_DENSITIES;
+BENCHMARK(bitSetOr)->BENCH_ROARING_DENSITIES;
+BENCHMARK(roaringBitmapIterate)->BENCH_ROARING_DENSITIES;
+BENCHMARK(bitSetIterateSetBits)->BENCH_ROARING_DENSITIES;
+BENCHMARK(roaringBitmapRank)->BENCH_ROARING_DENSITIES;
+BENCHMARK(roaringBitmapSerialize)->BENCH_ROARING_DENSITIES;
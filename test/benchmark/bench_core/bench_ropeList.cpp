@@ -0,0 +1,32 @@
+#include "bench_common.h"
+#include "blocksList.h"
+#include "chain.h"
+#include "ropeList.h"
+#include "vector.h"
+
+using ropeListInt = original::ropeList<int>;
+using ropeListP64 = original::ropeList<bench::payload<64>>;
+using ropeListP256 = original::ropeList<bench::payload<256>>;
+
+BENCH_LIST(ropeListInt, BENCH_COUNTS);
+BENCH_LIST(ropeListP64, BENCH_COUNTS);
+BENCH_LIST(ropeListP256, BENCH_COUNTS);
+BENCH_INDEXED(ropeListInt, BENCH_COUNTS);
+
+// Random index updates on larger lists, where the linear shifts of the other lists show. Large
+// payloads make those shifts slow enough that the regular counts already tell them apart.
+#define BENCH_COUNTS_LARGE RangeMultiplier(8)->Range(1 << 10, 1 << 16)
+
+using vectorInt = original::vector<int>;
+using vectorP256 = original::vector<bench::payload<256>>;
+using chainInt = original::chain<int>;
+using blocksListInt = original::blocksList<int>;
+using blocksListP256 = original::blocksList<bench::payload<256>>;
+
+BENCH_RANDOM_INDEX(ropeListInt, BENCH_COUNTS_LARGE);
+BENCH_RANDOM_INDEX(ropeListP256, BENCH_COUNTS);
+BENCH_RANDOM_INDEX(vectorInt, BENCH_COUNTS_LARGE);
+BENCH_RANDOM_INDEX(vectorP256, BENCH_COUNTS);
+BENCH_RANDOM_INDEX(blocksListInt, BENCH_COUNTS_LARGE);
+BENCH_RANDOM_INDEX(blocksListP256, BENCH_COUNTS);
+BENCH_RANDOM_INDEX(chainInt, BENCH_COUNTS_SMALL);
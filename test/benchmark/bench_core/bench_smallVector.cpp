@@ -0,0 +1,20 @@
+#include "bench_common.h"
+#include "smallVector.h"
+#include "vector.h"
+
+using smallVectorInt = original::smallVector<int>;
+using smallVectorP64 = original::smallVector<bench::payload<64>>;
+
+// Pushing at the beginning shifts every element, so the generic benchmarks stay at small counts.
+BENCH_LIST(smallVectorInt, BENCH_COUNTS_SMALL);
+BENCH_LIST(smallVectorP64, BENCH_COUNTS_SMALL);
+BENCH_RESERVE(smallVectorInt, BENCH_COUNTS);
+BENCH_RANGE_FOR(smallVectorInt, BENCH_COUNTS);
+
+using vectorInt = original::vector<int>;
+using vectorP64 = original::vector<bench::payload<64>>;
+
+BENCH_SHORT_LIVED(smallVectorInt);
+BENCH_SHORT_LIVED(smallVectorP64);
+BENCH_SHORT_LIVED(vectorInt);
+BENCH_SHORT_LIVED(vectorP64);
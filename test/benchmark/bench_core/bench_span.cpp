@@ -0,0 +1,75 @@
+#include <cstring>
+#include <memory>
+#include "bench_common.h"
+#include "algorithms.h"
+#include "span.h"
+#include "vector.h"
+
+namespace {
+
+    // Copying a vector out to a plain buffer element by element, the only way before span.
+    void vectorCopyOutByGet(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto vec = bench::filledList<original::vector<int>>(n);
+        const auto out = std::make_unique<int[]>(n);
+        for (auto _ : state) {
+            for (int64_t i = 0; i < n; ++i) {
+                out[i] = vec.get(i);
+            }
+            benchmark::DoNotOptimize(out.get());
+        }
+        bench::setItems(state, n);
+    }
+
+    void spanCopyOutByMemcpy(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto vec = bench::filledList<original::vector<int>>(n);
+        const auto out = std::make_unique<int[]>(n);
+        for (auto _ : state) {
+            const auto s = vec.asSpan();
+            std::memcpy(out.get(), s.data(), s.sizeInBytes());
+            benchmark::DoNotOptimize(out.get());
+        }
+        bench::setItems(state, n);
+    }
+
+    void sortThroughIterators(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto idx = bench::randomIndexes(n);
+        original::vector<int64_t> vec;
+        for (int64_t i = 0; i < n; ++i) {
+            vec.pushEnd(idx[i]);
+        }
+        for (auto _ : state) {
+            state.PauseTiming();
+            auto copied = vec;
+            state.ResumeTiming();
+            original::algorithms::sort(copied.first(), copied.last());
+            benchmark::DoNotOptimize(&copied);
+        }
+        bench::setItems(state, n);
+    }
+
+    void sortThroughSpan(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto idx = bench::randomIndexes(n);
+        original::vector<int64_t> vec;
+        for (int64_t i = 0; i < n; ++i) {
+            vec.pushEnd(idx[i]);
+        }
+        for (auto _ : state) {
+            state.PauseTiming();
+            auto copied = vec;
+            state.ResumeTiming();
+            original::algorithms::sort(copied.asSpan());
+            benchmark::DoNotOptimize(&copied);
+        }
+        bench::setItems(state, n);
+    }
+
+} // namespace
+
+BENCHMARK(vectorCopyOutByGet)->BENCH_COUNTS;
+BENCHMARK(spanCopyOutByMemcpy)->BENCH_COUNTS;
+BENCHMARK(sortThroughIterators)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK(sortThroughSpan)->RangeMultiplier(16)->Range(16, 1 << 16);
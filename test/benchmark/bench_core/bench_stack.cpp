@@ -0,0 +1,82 @@
+#include "bench_common.h"
+#include "stack.h"
+#include "blocksList.h"
+#include "vector.h"
+
+namespace {
+
+    template<typename ADAPTER, typename TYPE>
+    ADAPTER filledStack(const int64_t n) {
+        ADAPTER adapter;
+        for (int64_t i = 0; i < n; ++i) {
+            adapter.push(bench::makeValue<TYPE>(i));
+        }
+        return adapter;
+    }
+
+    template<typename ADAPTER, typename TYPE>
+    void stackPush(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        for (auto _ : state) {
+            ADAPTER adapter;
+            for (int64_t i = 0; i < n; ++i) {
+                adapter.push(bench::makeValue<TYPE>(i));
+            }
+            benchmark::DoNotOptimize(&adapter);
+        }
+        bench::setItems(state, n);
+    }
+
+    template<typename ADAPTER, typename TYPE>
+    void stackPop(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        for (auto _ : state) {
+            state.PauseTiming();
+            auto adapter = filledStack<ADAPTER, TYPE>(n);
+            state.ResumeTiming();
+            while (!adapter.empty()) {
+                benchmark::DoNotOptimize(adapter.pop());
+            }
+        }
+        bench::setItems(state, n);
+    }
+
+    template<typename ADAPTER, typename TYPE>
+    void stackCopy(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto adapter = filledStack<ADAPTER, TYPE>(n);
+        for (auto _ : state) {
+            ADAPTER copied(adapter);
+            benchmark::DoNotOptimize(&copied);
+        }
+        bench::setItems(state, n);
+    }
+
+    template<typename ADAPTER, typename TYPE>
+    void stackMove(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        auto adapter = filledStack<ADAPTER, TYPE>(n);
+        for (auto _ : state) {
+            ADAPTER moved(std::move(adapter));
+            adapter = std::move(moved);
+            benchmark::DoNotOptimize(&adapter);
+        }
+        bench::setItems(state, 1);
+    }
+
+} // namespace
+
+using p64 = bench::payload<64>;
+using p256 = bench::payload<256>;
+
+#define BENCH_STACK(SERIAL, TYPE) \
+    BENCHMARK_TEMPLATE(stackPush, original::stack<TYPE, SERIAL>, TYPE)->BENCH_COUNTS; \
+    BENCHMARK_TEMPLATE(stackPop, original::stack<TYPE, SERIAL>, TYPE)->BENCH_COUNTS; \
+    BENCHMARK_TEMPLATE(stackCopy, original::stack<TYPE, SERIAL>, TYPE)->BENCH_COUNTS; \
+    BENCHMARK_TEMPLATE(stackMove, original::stack<TYPE, SERIAL>, TYPE)->BENCH_COUNTS
+
+BENCH_STACK(original::chain, int);
+BENCH_STACK(original::chain, p64);
+BENCH_STACK(original::chain, p256);
+BENCH_STACK(original::vector, int);
+BENCH_STACK(original::blocksList, int);
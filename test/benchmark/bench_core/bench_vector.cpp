@@ -0,0 +1,37 @@
+#include <memory>
+#include "bench_common.h"
+#include "vector.h"
+
+namespace {
+
+    // The floor for listFastRangeFor<vectorInt>: the same loop over a plain heap array.
+    void rawPointerIterate(benchmark::State& state) {
+        const int64_t n = state.range(0);
+        const auto values = std::make_unique<int[]>(n);
+        for (int64_t i = 0; i < n; ++i) {
+            values[i] = static_cast<int>(i);
+        }
+        for (auto _ : state) {
+            for (const int* p = values.get(); p != values.get() + n; ++p) {
+                benchmark::DoNotOptimize(*p);
+            }
+        }
+        bench::setItems(state, n);
+    }
+
+} // namespace
+
+using vectorInt = original::vector<int>;
+using vectorP64 = original::vector<bench::payload<64>>;
+using vectorP256 = original::vector<bench::payload<256>>;
+
+BENCH_LIST(vectorInt, BENCH_COUNTS);
+BENCH_LIST(vectorP64, BENCH_COUNTS);
+BENCH_LIST(vectorP256, BENCH_COUNTS);
+
+BENCH_RESERVE(vectorInt, BENCH_COUNTS);
+BENCH_RESERVE(vectorP256, BENCH_COUNTS);
+
+BENCH_RANGE_FOR(vectorInt, BENCH_COUNTS);
+BENCH_RANGE_FOR(vectorP256, BENCH_COUNTS);
+BENCHMARK(rawPointerIterate)->BENCH_COUNTS;
@@ -0,0 +1,158 @@
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <limits>
+#include <map>
+#include <queue>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+#include "addressablePrique.h"
+#include "comparator.h"
+#include "error.h"
+
+namespace original {
+
+    // 测试 push 与 pop 的顺序和 std::priority_queue 一致
+    TEST(AddressablePriqueTest, PushPopOrderTest) {
+        addressablePrique<int> pq;
+        std::priority_queue<int, std::vector<int>, std::greater<>> expected;
+        std::mt19937 gen(5);
+        for (int i = 0; i < 500; ++i) {
+            const int v = static_cast<int>(gen() % 100);
+            pq.push(v);
+            expected.push(v);
+        }
+        EXPECT_EQ(pq.size(), 500);
+        while (!expected.empty()) {
+            EXPECT_EQ(pq.top(), expected.top());
+            EXPECT_EQ(pq.pop(), expected.top());
+            expected.pop();
+        }
+        EXPECT_TRUE(pq.empty());
+        EXPECT_THROW(pq.pop(), noElementError);
+        EXPECT_THROW(pq.top(), noElementError);
+    }
+
+    // 测试通过句柄读取, decreaseKey 与 update
+    TEST(AddressablePriqueTest, HandleUpdateTest) {
+        addressablePrique<int> pq;
+        const auto h10 = pq.push(10);
+        const auto h20 = pq.push(20);
+        const auto h30 = pq.push(30);
+        EXPECT_EQ(pq.get(h20), 20);
+        EXPECT_EQ(pq.topHandle(), h10);
+
+        pq.decreaseKey(h30, 5);
+        EXPECT_EQ(pq.topHandle(), h30);
+        EXPECT_EQ(pq.get(h30), 5);
+        EXPECT_THROW(pq.decreaseKey(h30, 6), valueError);
+
+        pq.update(h30, 25);
+        EXPECT_EQ(pq.topHandle(), h10);
+        pq.update(h10, 40);
+        EXPECT_EQ(pq.pop(), 20);
+        EXPECT_EQ(pq.pop(), 25);
+        EXPECT_EQ(pq.pop(), 40);
+    }
+
+    // 测试任意位置删除与句柄复用
+    TEST(AddressablePriqueTest, EraseTest) {
+        addressablePrique<std::string, decreaseComparator> pq;
+        const auto ha = pq.push("a");
+        const auto hb = pq.emplace(2, 'b');
+        const auto hc = pq.push(std::string("c"));
+        EXPECT_EQ(pq.erase(hb), "bb");
+        EXPECT_FALSE(pq.contains(hb));
+        EXPECT_THROW(pq.get(hb), noElementError);
+        EXPECT_THROW(pq.erase(hb), noElementError);
+        EXPECT_THROW(pq.update(100, "x"), noElementError);
+        EXPECT_TRUE(pq.contains(ha));
+        EXPECT_EQ(pq.size(), 2);
+
+        const auto hd = pq.push("d");
+        EXPECT_EQ(hd, hb);
+        EXPECT_EQ(pq.pop(), "d");
+        EXPECT_EQ(pq.pop(), "c");
+        EXPECT_FALSE(pq.contains(hc));
+        EXPECT_EQ(pq.toString(false), "addressablePrique(\"a\")");
+        pq.clear();
+        EXPECT_TRUE(pq.empty());
+        EXPECT_FALSE(pq.contains(ha));
+    }
+
+    // 测试随机的插入、修改、删除与弹出, 与 std::set 对照
+    TEST(AddressablePriqueTest, RandomOperationsTest) {
+        addressablePrique<int, increaseComparator, 3> pq;
+        std::map<uint32_t, int> alive;
+        std::multiset<int> expected;
+        std::mt19937 gen(9);
+        for (int i = 0; i < 5000; ++i) {
+            const uint32_t op = gen() % 5;
+            const int v = static_cast<int>(gen() % 10000);
+            if (op <= 1 || alive.empty()) {
+                const auto h = pq.push(v);
+                EXPECT_FALSE(alive.contains(h));
+                alive[h] = v;
+                expected.insert(v);
+                continue;
+            }
+            if (op == 4) {
+                const auto h = pq.topHandle();
+                EXPECT_EQ(pq.pop(), *expected.begin());
+                expected.erase(expected.begin());
+                alive.erase(h);
+            } else {
+                auto it = alive.begin();
+                std::advance(it, gen() % alive.size());
+                expected.erase(expected.find(it->second));
+                if (op == 2) {
+                    pq.update(it->first, v);
+                    it->second = v;
+                    expected.insert(v);
+                } else {
+                    EXPECT_EQ(pq.erase(it->first), it->second);
+                    alive.erase(it);
+                }
+            }
+            ASSERT_EQ(pq.size(), expected.size());
+            if (!expected.empty()) {
+                ASSERT_EQ(pq.top(), *expected.begin());
+            }
+        }
+    }
+
+    // 测试用 decreaseKey 实现 Dijkstra 最短路径
+    TEST(AddressablePriqueTest, DijkstraTest) {
+        struct edge { uint32_t to; int64_t weight; };
+        const std::vector<std::vector<edge>> graph = {
+            {{1, 7}, {2, 9}, {5, 14}},
+            {{0, 7}, {2, 10}, {3, 15}},
+            {{0, 9}, {1, 10}, {3, 11}, {5, 2}},
+            {{1, 15}, {2, 11}, {4, 6}},
+            {{3, 6}, {5, 9}},
+            {{0, 14}, {2, 2}, {4, 9}},
+        };
+        constexpr int64_t inf = std::numeric_limits<int64_t>::max();
+        std::vector<int64_t> dist(graph.size(), inf);
+        std::vector<uint32_t> handles(graph.size());
+        std::map<uint32_t, uint32_t> vertex_of;
+        addressablePrique<int64_t> pq;
+        dist[0] = 0;
+        for (uint32_t v = 0; v < graph.size(); ++v) {
+            handles[v] = pq.push(dist[v]);
+            vertex_of[handles[v]] = v;
+        }
+        while (!pq.empty()) {
+            const uint32_t u = vertex_of[pq.topHandle()];
+            pq.pop();
+            for (const auto& [to, weight] : graph[u]) {
+                if (pq.contains(handles[to]) && dist[u] + weight < dist[to]) {
+                    dist[to] = dist[u] + weight;
+                    pq.decreaseKey(handles[to], dist[to]);
+                }
+            }
+        }
+        EXPECT_EQ(dist, (std::vector<int64_t>{0, 7, 9, 20, 20, 11}));
+    }
+}
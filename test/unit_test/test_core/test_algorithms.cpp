@@ -1,5 +1,8 @@
+#include <atomic>
 #include <gtest/gtest.h>
 #include "array.h"
+#include "chain.h"
+#include "comparator.h"
 #include "vector.h"
 #include "algorithms.h"
 
@@ -133,4 +136,232 @@ namespace original {
             EXPECT_EQ(it.get(), expected[idx++]);
         }
     }
+
+    // 测试连续存储快速路径与多态路径结果一致
+    TEST(AlgorithmsTest, ContiguousMatchesPolymorphicTest) {
+        const vector vec = {4, 1, 3, 1, 5, 9, 2, 6, 1};
+        const chain ch = {4, 1, 3, 1, 5, 9, 2, 6, 1};
+        const greaterFilter greaterThan4(4);
+        const lessFilter lessThan1(1);
+
+        EXPECT_EQ(algorithms::count(vec.first(), vec.last(), 1), algorithms::count(ch.first(), ch.last(), 1));
+        EXPECT_EQ(algorithms::count(vec.first(), vec.last(), greaterThan4),
+                  algorithms::count(ch.first(), ch.last(), greaterThan4));
+        EXPECT_FALSE(algorithms::allOf(vec.first(), vec.last(), greaterThan4));
+        EXPECT_TRUE(algorithms::anyOf(vec.first(), vec.last(), greaterThan4));
+        EXPECT_TRUE(algorithms::noneOf(vec.first(), vec.last(), lessThan1));
+
+        const auto vec_found = algorithms::find(vec.begin(), vec.end(), 9);
+        const auto ch_found = algorithms::find(ch.begin(), ch.end(), 9);
+        EXPECT_EQ(vec_found->get(), ch_found->get());
+        EXPECT_EQ(algorithms::distance(*vec_found, vec.begin()), 5);
+        delete vec_found;
+        delete ch_found;
+
+        const auto vec_missing = algorithms::find(vec.begin(), vec.end(), 7);
+        EXPECT_TRUE(vec_missing->equal(vec.end()));
+        delete vec_missing;
+
+        const auto vec_n = algorithms::find(vec.begin(), 4, greaterThan4);
+        EXPECT_EQ(algorithms::distance(*vec_n, vec.begin()), 4);
+        delete vec_n;
+    }
+
+    // 测试子区间上的快速路径
+    TEST(AlgorithmsTest, ContiguousSubRangeTest) {
+        vector vec = {1, 2, 3, 4, 5, 6};
+        const auto begin = vec.begin();
+        const auto end = vec.begin();
+        begin += 1;
+        end += 4;
+        EXPECT_EQ(algorithms::count(begin, end, 6), 0);
+        EXPECT_EQ(algorithms::count(begin, end, 5), 1);
+
+        int sum = 0;
+        algorithms::forEach(begin, end, [&sum](const int val) { sum += val; });
+        EXPECT_EQ(sum, 14);
+
+        const auto mid = algorithms::reverse(begin, end);
+        EXPECT_EQ(algorithms::distance(*mid, vec.begin()), 3);
+        delete mid;
+        const int expected[] = {1, 5, 4, 3, 2, 6};
+        for (uint32_t i = 0; i < vec.size(); ++i) {
+            EXPECT_EQ(vec[i], expected[i]);
+        }
+
+        algorithms::fill(begin, end, 0);
+        EXPECT_EQ(algorithms::count(vec.first(), vec.last(), 0), 4);
+        EXPECT_EQ(vec[0], 1);
+        EXPECT_EQ(vec[5], 6);
+    }
+
+    // 测试 equal 逐元素比较
+    TEST(AlgorithmsTest, EqualElementsTest) {
+        const vector vec1 = {1, 2, 3, 4, 5};
+        const vector vec2 = {1, 9, 3, 4, 5};
+        EXPECT_FALSE(algorithms::equal(vec1.first(), vec1.last(), vec2.first(), vec2.last()));
+
+        const chain ch1 = {1, 2, 3, 4, 5};
+        const chain ch2 = {1, 9, 3, 4, 5};
+        EXPECT_TRUE(algorithms::equal(ch1.first(), ch1.last(), ch1.first(), ch1.last()));
+        EXPECT_FALSE(algorithms::equal(ch1.first(), ch1.last(), ch2.first(), ch2.last()));
+    }
+
+    // 测试堆操作在快速路径与多态路径下都保持堆序
+    TEST(AlgorithmsTest, HeapOrderTest) {
+        vector<int> vec;
+        chain<int> ch;
+        const increaseComparator<int> comp;
+        for (const int v : {5, 4, 3, 2, 1, 0, 7, 6}) {
+            vec.pushEnd(v);
+            algorithms::heapAdjustUp(vec.begin(), vec.last(), comp);
+            ch.pushEnd(v);
+            algorithms::heapAdjustUp(ch.begin(), ch.last(), comp);
+        }
+        for (uint32_t i = 1; i < vec.size(); ++i) {
+            EXPECT_LE(vec[(i - 1) / 2], vec[i]);
+            EXPECT_LE(ch[(i - 1) / 2], ch[i]);
+        }
+
+        vector heap = {9, 8, 7, 6, 5, 4, 3, 2, 1};
+        algorithms::heapInit(heap.begin(), heap.last(), comp);
+        for (uint32_t i = 1; i < heap.size(); ++i) {
+            EXPECT_LE(heap[(i - 1) / 2], heap[i]);
+        }
+    }
+
+    // 测试多叉堆在快速路径与多态路径下都保持堆序
+    TEST(AlgorithmsTest, DaryHeapOrderTest) {
+        vector<int> vec;
+        chain<int> ch;
+        const increaseComparator<int> comp;
+        for (int v = 20; v > 0; --v) {
+            vec.pushEnd(v);
+            algorithms::heapAdjustUp<4>(vec.begin(), vec.last(), comp);
+            ch.pushEnd(v);
+            algorithms::heapAdjustUp<4>(ch.begin(), ch.last(), comp);
+        }
+        for (uint32_t i = 1; i < vec.size(); ++i) {
+            EXPECT_LE(vec[(i - 1) / 4], vec[i]);
+            EXPECT_LE(ch[(i - 1) / 4], ch[i]);
+        }
+
+        vector heap = {9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 12, 11};
+        chain linked = {9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 12, 11};
+        algorithms::heapInit<3>(heap.begin(), heap.last(), comp);
+        algorithms::heapInit<3>(linked.begin(), linked.last(), comp);
+        for (uint32_t i = 1; i < heap.size(); ++i) {
+            EXPECT_LE(heap[(i - 1) / 3], heap[i]);
+            EXPECT_LE(linked[(i - 1) / 3], linked[i]);
+        }
+
+        // 弹出堆顶后下沉, 依次得到有序序列
+        int previous = -1;
+        while (!heap.empty()) {
+            algorithms::swap(heap.begin(), heap.last());
+            const int cur = heap.popEnd();
+            EXPECT_LE(previous, cur);
+            previous = cur;
+            algorithms::heapAdjustDown<3>(heap.begin(), heap.last(), heap.begin(), comp);
+        }
+        EXPECT_EQ(previous, 12);
+    }
+
+    // 测试 sort 方法（连续存储与链式存储）
+    TEST(AlgorithmsTest, SortTest) {
+        vector vec = {5, 3, 9, 1, 7, 3, 8, 2, 6, 4, 0, 3, 7, 1, 9, 5, 2, 8, 6, 4};
+        chain ch = {5, 3, 9, 1, 7, 3, 8, 2, 6, 4, 0, 3, 7, 1, 9, 5, 2, 8, 6, 4};
+        algorithms::sort(vec.first(), vec.last());
+        algorithms::sort(ch.first(), ch.last());
+        for (uint32_t i = 1; i < vec.size(); ++i) {
+            EXPECT_LE(vec[i - 1], vec[i]);
+            EXPECT_EQ(ch[i], vec[i]);
+        }
+
+        algorithms::sort(vec.first(), vec.last(), decreaseComparator<int>());
+        for (uint32_t i = 1; i < vec.size(); ++i) {
+            EXPECT_GE(vec[i - 1], vec[i]);
+        }
+    }
+
+    // 测试 stableSort 方法保持相等元素的相对顺序
+    TEST(AlgorithmsTest, StableSortTest) {
+        vector<int> vec;
+        for (int i = 0; i < 100; ++i) {
+            vec.pushEnd((i * 37) % 10 * 100 + i);
+        }
+        const auto byHundreds = [](const int& a, const int& b) { return a / 100 < b / 100; };
+        algorithms::stableSort(vec.first(), vec.last(), byHundreds);
+        for (uint32_t i = 1; i < vec.size(); ++i) {
+            EXPECT_LE(vec[i - 1] / 100, vec[i] / 100);
+            if (vec[i - 1] / 100 == vec[i] / 100) {
+                EXPECT_LT(vec[i - 1] % 100, vec[i] % 100);
+            }
+        }
+    }
+
+    // 测试 partialSort 与 nthElement 方法
+    TEST(AlgorithmsTest, PartialSortAndNthElementTest) {
+        vector vec = {9, 4, 7, 1, 8, 2, 6, 3, 5, 0};
+        algorithms::partialSort(vec.first(), vec.last(), 4);
+        for (int i = 0; i < 4; ++i) {
+            EXPECT_EQ(vec[i], i);
+        }
+
+        chain ch = {9, 4, 7, 1, 8, 2, 6, 3, 5, 0};
+        algorithms::nthElement(ch.first(), ch.last(), 6);
+        EXPECT_EQ(ch[6], 6);
+        for (int i = 0; i < 6; ++i) {
+            EXPECT_LT(ch[i], 6);
+        }
+        for (int i = 7; i < 10; ++i) {
+            EXPECT_GT(ch[i], 6);
+        }
+    }
+
+    // 测试执行策略重载与顺序版本结果一致
+    TEST(AlgorithmsTest, ExecutionPolicyTest) {
+        vector<int> vec;
+        for (int i = 0; i < 200000; ++i) {
+            vec.pushEnd(i % 1000);
+        }
+        const greaterFilter greaterThan998(998);
+        const lessFilter lessThan0(0);
+
+        EXPECT_EQ(algorithms::count(execution::par, vec.first(), vec.last(), 7), 200);
+        EXPECT_EQ(algorithms::count(execution::parUnseq, vec.first(), vec.last(), greaterThan998),
+                  algorithms::count(vec.first(), vec.last(), greaterThan998));
+        EXPECT_EQ(algorithms::count(execution::seq, vec.first(), vec.last(), 7), 200);
+        EXPECT_TRUE(algorithms::anyOf(execution::par, vec.first(), vec.last(), greaterThan998));
+        EXPECT_FALSE(algorithms::allOf(execution::par, vec.first(), vec.last(), greaterThan998));
+        EXPECT_TRUE(algorithms::noneOf(execution::par, vec.first(), vec.last(), lessThan0));
+
+        const auto found = algorithms::find(execution::par, vec.begin(), vec.end(), 999);
+        EXPECT_EQ(algorithms::distance(*found, vec.begin()), 999);
+        delete found;
+        const auto missing = algorithms::find(execution::par, vec.begin(), vec.end(), 1000);
+        EXPECT_TRUE(missing->equal(vec.end()));
+        delete missing;
+
+        std::atomic<int64_t> sum = 0;
+        algorithms::forEach(execution::par, vec.first(), vec.last(), [&sum](const int val) {
+            sum.fetch_add(val);
+        });
+        EXPECT_EQ(sum.load(), 200LL * 499500);
+
+        vector<int> target;
+        for (uint32_t i = 0; i < vec.size(); ++i) {
+            target.pushEnd(-1);
+        }
+        const auto copied = algorithms::copy(execution::par, vec.first(), vec.last(), target.first());
+        EXPECT_FALSE(copied->isValid());
+        delete copied;
+        EXPECT_TRUE(algorithms::equal(vec.first(), vec.last(), target.first(), target.last()));
+
+        algorithms::fill(execution::par, vec.first(), vec.last(), 3);
+        EXPECT_EQ(algorithms::count(execution::par, vec.first(), vec.last(), 3), vec.size());
+
+        const chain ch = {1, 2, 3, 3};
+        EXPECT_EQ(algorithms::count(execution::par, ch.first(), ch.last(), 3), 2);
+    }
 }
@@ -0,0 +1,102 @@
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <set>
+#include "allocator.h"
+
+namespace original {
+
+    struct alignas(32) wide {
+        int64_t values[5];
+    };
+
+    // 测试释放的对象被优先复用
+    TEST(PoolAllocatorTest, ReuseTest) {
+        poolAllocator<int64_t> alloc;
+        int64_t* first = alloc.allocate(1);
+        int64_t* second = alloc.allocate(1);
+        EXPECT_NE(first, second);
+        alloc.deallocate(first, 1);
+        EXPECT_EQ(alloc.allocate(1), first);
+        alloc.deallocate(first, 1);
+        alloc.deallocate(second, 1);
+    }
+
+    // 测试大量分配互不重叠且满足对齐
+    TEST(PoolAllocatorTest, DistinctAlignedTest) {
+        poolAllocator<wide> alloc;
+        std::set<wide*> seen;
+        for (int i = 0; i < 10000; ++i) {
+            wide* w = alloc.allocate(1);
+            EXPECT_EQ(reinterpret_cast<std::uintptr_t>(w) % alignof(wide), 0);
+            w->values[0] = i;
+            EXPECT_TRUE(seen.insert(w).second);
+        }
+        for (wide* w : seen) {
+            alloc.deallocate(w, 1);
+        }
+    }
+
+    // 测试多个对象的请求绕过对象池
+    TEST(PoolAllocatorTest, ArrayBypassTest) {
+        poolAllocator<int> alloc;
+        int* arr = alloc.allocate(100);
+        for (int i = 0; i < 100; ++i) {
+            arr[i] = i;
+        }
+        EXPECT_EQ(arr[99], 99);
+        alloc.deallocate(arr, 100);
+    }
+
+    // 测试副本共享同一个对象池
+    TEST(PoolAllocatorTest, CopySharesPoolTest) {
+        poolAllocator<int> alloc;
+        const auto copied = alloc;
+        int* p = alloc.allocate(1);
+        auto other = copied;
+        other.deallocate(p, 1);
+        EXPECT_EQ(alloc.allocate(1), p);
+        alloc.deallocate(p, 1);
+    }
+
+    // 测试只有共享对象池的分配器相等, 全局分配器总是相等
+    TEST(PoolAllocatorTest, EqualityTest) {
+        poolAllocator<int> alloc;
+        const auto copied = alloc;
+        const poolAllocator<int> other;
+        EXPECT_TRUE(alloc == copied);
+        EXPECT_FALSE(alloc == other);
+        auto moved = std::move(alloc);
+        EXPECT_TRUE(moved == copied);
+        EXPECT_TRUE(allocator<int>{} == allocator<int>{});
+    }
+
+    // 测试换绑到其他类型的副本共享对象池, 相同大小的类型共用同一个池
+    TEST(PoolAllocatorTest, RebindSharesPoolTest) {
+        poolAllocator<int> alloc;
+        poolAllocator<wide> wide_alloc(alloc);
+        const poolAllocator<wide> again(alloc);
+        EXPECT_TRUE(wide_alloc == again);
+        EXPECT_FALSE(wide_alloc == poolAllocator<wide>{});
+        wide* w = wide_alloc.allocate(1);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(w) % alignof(wide), 0);
+        poolAllocator<wide>(again).deallocate(w, 1);
+        EXPECT_EQ(wide_alloc.allocate(1), w);
+        wide_alloc.deallocate(w, 1);
+
+        int* p = alloc.allocate(1);
+        alloc.deallocate(p, 1);
+        poolAllocator<float> float_alloc(alloc);
+        EXPECT_EQ(reinterpret_cast<int*>(float_alloc.allocate(1)), p);
+        float_alloc.deallocate(reinterpret_cast<float*>(p), 1);
+        EXPECT_TRUE(allocator<wide>(allocator<int>{}) == allocator<wide>{});
+    }
+
+    // 测试全局分配器
+    TEST(AllocatorTest, AllocateTest) {
+        allocator<int> alloc;
+        int* arr = alloc.allocate(10);
+        arr[9] = 9;
+        EXPECT_EQ(arr[9], 9);
+        alloc.deallocate(arr, 10);
+    }
+}
@@ -293,4 +293,17 @@ TEST(ArrayTest, ToString) {
     EXPECT_TRUE(true);
 }
 
+TEST(ArrayTest, FastRangeTest) {
+    array<int> arr = {1, 2, 3};
+    for (auto& e : fast(arr)) {
+        e += 1;
+    }
+    EXPECT_TRUE(compareArrays(arr, std::array<int, 3>{2, 3, 4}));
+    EXPECT_EQ(arr.fastEnd() - arr.fastBegin(), 3);
+    EXPECT_EQ(arr.fastBegin(), &arr.data());
+
+    const array<int> empty;
+    EXPECT_EQ(empty.fastBegin(), empty.fastEnd());
+}
+
 }  // namespace original
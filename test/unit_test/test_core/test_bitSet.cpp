@@ -212,3 +212,290 @@ TEST(BitSetTest, Iterator) {
     ASSERT_EQ(it3->getElem(), true);  // 5位
     ASSERT_EQ(it4->getElem(), true);  // 10位
 }
+
+TEST(BitSetTest, AnyNoneAll) {
+    original::bitSet bs1(1000);
+    EXPECT_FALSE(bs1.any());
+    EXPECT_TRUE(bs1.none());
+    EXPECT_FALSE(bs1.all());
+    bs1.set(999, true);
+    EXPECT_TRUE(bs1.any());
+    EXPECT_FALSE(bs1.none());
+
+    const original::bitSet bs2 = ~original::bitSet(1000);
+    EXPECT_TRUE(bs2.all());
+    EXPECT_EQ(bs2.count(), 1000);
+    original::bitSet bs3 = bs2;
+    bs3.set(500, false);
+    EXPECT_FALSE(bs3.all());
+    bs3.set(500, true);
+    bs3.set(-1, false);
+    EXPECT_FALSE(bs3.all());
+
+    const original::bitSet empty(0);
+    EXPECT_TRUE(empty.all());
+    EXPECT_TRUE(empty.none());
+    EXPECT_EQ(empty.count(), 0);
+}
+
+TEST(BitSetTest, AndNotAndFlip) {
+    constexpr int64_t SIZE = 777;
+    std::mt19937 gen(3);
+    original::bitSet bs1(SIZE);
+    original::bitSet bs2(SIZE);
+    std::bitset<SIZE> bs3;
+    std::bitset<SIZE> bs4;
+    for (int i = 0; i < SIZE / 2; ++i) {
+        const auto a = gen() % SIZE;
+        const auto b = gen() % SIZE;
+        bs1.set(a, true);
+        bs3.set(a, true);
+        bs2.set(b, true);
+        bs4.set(b, true);
+    }
+    bs1.andNot(bs2);
+    bs3 &= ~bs4;
+    EXPECT_TRUE(compareBitSets(bs1, bs3));
+
+    bs1.flip();
+    bs3.flip();
+    EXPECT_TRUE(compareBitSets(bs1, bs3));
+    EXPECT_EQ(bs1.count(), bs3.count());
+}
+
+TEST(BitSetTest, MixedSizeOperators) {
+    original::bitSet small(100);
+    original::bitSet large = ~original::bitSet(300);
+    small.set(3, true);
+    small.set(99, true);
+
+    original::bitSet or_result = small;
+    or_result |= large;
+    EXPECT_EQ(or_result.size(), 100);
+    EXPECT_TRUE(or_result.all());
+
+    original::bitSet and_result = large;
+    and_result &= small;
+    EXPECT_EQ(and_result.size(), 300);
+    EXPECT_EQ(and_result.count(), 2);
+    EXPECT_TRUE(and_result.get(99));
+
+    original::bitSet not_result = large;
+    not_result.andNot(small);
+    EXPECT_EQ(not_result.count(), 298);
+    EXPECT_FALSE(not_result.get(3));
+}
+
+// Every kernel level has to agree with the scalar kernels, including on the tails
+TEST(BitSetTest, KernelLevels) {
+    using namespace original::bitKernels;
+    std::mt19937_64 gen(17);
+    const auto& ref = kernelsOf(level::SCALAR);
+    for (const auto l : {level::AVX2, level::AVX512}) {
+        const auto& k = kernelsOf(l);
+        for (const uint32_t n : {0u, 1u, 3u, 4u, 7u, 8u, 9u, 31u, 64u, 1000u}) {
+            std::vector<word> a(n), b(n);
+            for (uint32_t i = 0; i < n; ++i) {
+                a[i] = gen();
+                b[i] = gen();
+            }
+            EXPECT_EQ(k.popcount(a.data(), n), ref.popcount(a.data(), n));
+            EXPECT_EQ(k.anyWords(a.data(), n), ref.anyWords(a.data(), n));
+
+            auto expected = a;
+            auto actual = a;
+            for (const auto& [kernel, ref_kernel] : {std::pair{k.andWords, ref.andWords},
+                                                     std::pair{k.orWords, ref.orWords},
+                                                     std::pair{k.xorWords, ref.xorWords},
+                                                     std::pair{k.andNotWords, ref.andNotWords}}) {
+                kernel(actual.data(), b.data(), n);
+                ref_kernel(expected.data(), b.data(), n);
+                EXPECT_EQ(actual, expected);
+            }
+            k.notWords(actual.data(), n);
+            ref.notWords(expected.data(), n);
+            EXPECT_EQ(actual, expected);
+
+            std::vector<word> zeros(n, 0), ones(n, ~static_cast<word>(0));
+            EXPECT_FALSE(k.anyWords(zeros.data(), n));
+            EXPECT_TRUE(k.allWords(ones.data(), n));
+            if (n > 0) {
+                ones[n - 1] ^= 1;
+                zeros[n - 1] = 4;
+                EXPECT_FALSE(k.allWords(ones.data(), n));
+                EXPECT_TRUE(k.anyWords(zeros.data(), n));
+            }
+        }
+    }
+}
+
+TEST(BitSetTest, FullLastBlock) {
+    const original::bitSet bs = ~original::bitSet(128);
+    EXPECT_EQ(bs.count(), 128);
+    EXPECT_TRUE(bs.all());
+    EXPECT_TRUE(bs.get(-1));
+}
+
+TEST(BitSetTest, FindSetBits) {
+    original::bitSet bs(1000);
+    EXPECT_EQ(bs.findFirst(), 1000);
+    EXPECT_EQ(bs.findLast(), 1000);
+    EXPECT_EQ(bs.findNext(0), 1000);
+    EXPECT_EQ(bs.indexOf(true), 1000);
+    EXPECT_EQ(bs.indexOf(false), 0);
+
+    for (const int64_t i : {5, 63, 64, 700, 999}) {
+        bs.set(i, true);
+    }
+    EXPECT_EQ(bs.findFirst(), 5);
+    EXPECT_EQ(bs.findNext(5), 63);
+    EXPECT_EQ(bs.findNext(63), 64);
+    EXPECT_EQ(bs.findNext(64), 700);
+    EXPECT_EQ(bs.findNext(100), 700);
+    EXPECT_EQ(bs.findNext(999), 1000);
+    EXPECT_EQ(bs.findNext(5000), 1000);
+    EXPECT_EQ(bs.findLast(), 999);
+    EXPECT_EQ(bs.indexOf(true), 5);
+
+    const original::bitSet full = ~original::bitSet(130);
+    EXPECT_EQ(full.indexOf(false), 130);
+    EXPECT_EQ(full.indexOf(true), 0);
+    EXPECT_EQ(full.findLast(), 129);
+}
+
+TEST(BitSetTest, SetBitIteration) {
+    constexpr int64_t SIZE = 5000;
+    std::mt19937 gen(21);
+    original::bitSet bs(SIZE);
+    std::bitset<SIZE> expected;
+    for (int i = 0; i < 60; ++i) {
+        const auto index = gen() % SIZE;
+        bs.set(index, true);
+        expected.set(index, true);
+    }
+    bs.set(SIZE - 1, true);
+    expected.set(SIZE - 1, true);
+
+    std::vector<uint32_t> visited;
+    for (const uint32_t index : bs.setBits()) {
+        visited.push_back(index);
+    }
+    std::vector<uint32_t> scanned;
+    for (uint32_t i = bs.findFirst(); i < bs.size(); i = bs.findNext(i)) {
+        scanned.push_back(i);
+    }
+    std::vector<uint32_t> reference;
+    for (uint32_t i = 0; i < SIZE; ++i) {
+        if (expected[i]) reference.push_back(i);
+    }
+    EXPECT_EQ(visited, reference);
+    EXPECT_EQ(scanned, reference);
+
+    const original::bitSet empty(300);
+    EXPECT_TRUE(empty.setBits().begin() == empty.setBits().end());
+}
+
+TEST(BitSetTest, IteratorAcrossBlocks) {
+    original::bitSet bs(200);
+    bs.set(70, true);
+    bs.set(150, true);
+    int64_t i = 0;
+    for (const auto it = bs.begin(); it.isValid(); it.next()) {
+        EXPECT_EQ(it.get(), i == 70 || i == 150);
+        i += 1;
+    }
+    EXPECT_EQ(i, 200);
+}
+
+TEST(BitSetTest, RangeOperations) {
+    constexpr size_t N = 300;
+    original::bitSet bs(N);
+    std::bitset<N> ref;
+    std::mt19937 gen(11);
+    for (int round = 0; round < 200; ++round) {
+        uint32_t lo = gen() % (N + 1);
+        uint32_t hi = gen() % (N + 1);
+        if (lo > hi) std::swap(lo, hi);
+        switch (round % 3) {
+            case 0:
+                bs.setRange(lo, hi);
+                for (uint32_t i = lo; i < hi; ++i) ref.set(i);
+                break;
+            case 1:
+                bs.clearRange(lo, hi);
+                for (uint32_t i = lo; i < hi; ++i) ref.reset(i);
+                break;
+            default:
+                bs.flipRange(lo, hi);
+                for (uint32_t i = lo; i < hi; ++i) ref.flip(i);
+                break;
+        }
+        ASSERT_TRUE(compareBitSets(bs, ref));
+
+        uint32_t expected = 0;
+        for (uint32_t i = lo; i < hi; ++i) expected += ref[i];
+        ASSERT_EQ(bs.countRange(lo, hi), expected);
+    }
+    EXPECT_EQ(bs.countRange(0, N), ref.count());
+    EXPECT_THROW(bs.setRange(10, 5), original::outOfBoundError);
+    EXPECT_THROW(bs.clearRange(0, N + 1), original::outOfBoundError);
+    EXPECT_THROW(static_cast<void>(bs.countRange(0, N + 1)), original::outOfBoundError);
+}
+
+TEST(BitSetTest, ShiftOperators) {
+    constexpr size_t N = 200;
+    std::mt19937 gen(12);
+    original::bitSet base(N);
+    std::bitset<N> base_ref;
+    for (uint32_t i = 0; i < N; ++i) {
+        if (gen() % 2) {
+            base.set(i, true);
+            base_ref.set(i);
+        }
+    }
+    for (const uint32_t steps : {0u, 1u, 5u, 63u, 64u, 65u, 128u, 130u, 199u, 200u, 500u}) {
+        auto left = base;
+        left <<= steps;
+        ASSERT_TRUE(compareBitSets(left, base_ref << steps)) << "<<= " << steps;
+        auto right = base;
+        right >>= steps;
+        ASSERT_TRUE(compareBitSets(right, base_ref >> steps)) << ">>= " << steps;
+    }
+}
+
+TEST(BitSetTest, ResizeInPlace) {
+    original::bitSet bs(130);
+    bs.setRange(0, 130);
+    bs.resizeInPlace(70);
+    EXPECT_EQ(bs.size(), 70);
+    EXPECT_EQ(bs.count(), 70);
+    EXPECT_TRUE(bs.all());
+
+    // Growing back within the kept words must not bring the dropped bits back.
+    bs.resizeInPlace(200);
+    EXPECT_EQ(bs.size(), 200);
+    EXPECT_EQ(bs.count(), 70);
+    EXPECT_EQ(bs.findLast(), 69);
+    EXPECT_FALSE(bs.all());
+    bs.flip();
+    EXPECT_EQ(bs.count(), 130);
+    EXPECT_EQ(bs.findFirst(), 70);
+
+    bs.resizeInPlace(10);
+    EXPECT_TRUE(bs.none());
+    bs.flip();
+    EXPECT_EQ(bs.count(), 10);
+    EXPECT_TRUE(bs.all());
+    const auto copy = bs.resize(64);
+    EXPECT_EQ(copy.count(), 10);
+    uint32_t seen = 0;
+    for (const uint32_t i : bs.setBits()) {
+        EXPECT_LT(i, 10);
+        seen += 1;
+    }
+    EXPECT_EQ(seen, 10);
+
+    bs.resizeInPlace(0);
+    EXPECT_EQ(bs.size(), 0);
+    EXPECT_EQ(bs.count(), 0);
+}
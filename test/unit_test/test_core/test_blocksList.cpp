@@ -1,7 +1,10 @@
 #include <algorithm>
 #include <gtest/gtest.h>
 #include "blocksList.h"
+#include "chain.h"
 #include <deque>
+#include <random>
+#include <string>
 
 // 对比函数，用于比较 original::blocksList 和 std::deque
 void compareBlocksList(const original::blocksList<int>& originalBL, const std::deque<int>& stdDQ) {
@@ -11,6 +14,19 @@ void compareBlocksList(const original::blocksList<int>& originalBL, const std::d
     }
 }
 
+template<uint32_t BLOCK_SIZE>
+void compareSmallBlocks(const original::blocksList<int, BLOCK_SIZE>& originalBL, const std::deque<int>& stdDQ) {
+    ASSERT_EQ(originalBL.size(), stdDQ.size());
+    uint32_t i = 0;
+    for (auto it = originalBL.begin(); it.isValid(); ++it, ++i) {
+        ASSERT_EQ(*it, stdDQ[i]);
+    }
+    ASSERT_EQ(i, stdDQ.size());
+    for (size_t j = 0; j < stdDQ.size(); ++j) {
+        ASSERT_EQ(originalBL.get(j), stdDQ[j]);
+    }
+}
+
 // 测试 original::blocksList 类
 class BlocksListTest : public testing::Test {
 protected:
@@ -352,3 +368,192 @@ TEST_F(BlocksListTest, MixedPushPopTest) {
     compareBlocksList(this->originalBL, this->stdDQ);
 }
 
+// 测试右值插入与原位构造
+TEST_F(BlocksListTest, EmplaceTest) {
+    original::blocksList<std::string> bl;
+    std::string moved(64, 'm');
+    bl.pushEnd(std::move(moved));
+    EXPECT_TRUE(moved.empty());
+    bl.emplaceEnd(3, 'a');
+    bl.emplaceBegin("begin");
+    bl.emplace(1, "middle", 3);
+    bl.push(2, std::string("pushed"));
+
+    const std::deque<std::string> expected = {"begin", "mid", "pushed", std::string(64, 'm'), "aaa"};
+    ASSERT_EQ(bl.size(), expected.size());
+    for (uint32_t i = 0; i < bl.size(); ++i) {
+        EXPECT_EQ(bl.get(i), expected[i]);
+    }
+    EXPECT_EQ(bl.pop(3), std::string(64, 'm'));
+    EXPECT_EQ(bl.pop(1), "mid");
+    EXPECT_EQ(bl.popBegin(), "begin");
+    EXPECT_EQ(bl.popEnd(), "aaa");
+
+    original::blocksList<std::string> other = std::move(bl);
+    EXPECT_EQ(other.size(), 1);
+    EXPECT_EQ(bl.size(), 0);
+    bl.emplaceEnd("reused");
+    EXPECT_EQ(bl.get(0), "reused");
+}
+
+// 测试预留容量与收缩
+TEST_F(BlocksListTest, ReserveShrinkTest) {
+    this->originalBL.reserve(1000);
+    const uint32_t reserved = this->originalBL.capacity();
+    EXPECT_GE(reserved, 1000);
+
+    // 预留后追加不会新增块
+    for (int i = 0; i < 1000; ++i) {
+        this->originalBL.pushEnd(i);
+        this->stdDQ.push_back(i);
+    }
+    EXPECT_EQ(this->originalBL.capacity(), reserved);
+    compareBlocksList(this->originalBL, this->stdDQ);
+
+    for (int i = 0; i < 450; ++i) {
+        this->originalBL.popEnd();
+        this->stdDQ.pop_back();
+        this->originalBL.popBegin();
+        this->stdDQ.pop_front();
+    }
+    this->originalBL.shrinkToFit();
+    EXPECT_LT(this->originalBL.capacity(), 100 + original::blocksList<int>::blockSize());
+    compareBlocksList(this->originalBL, this->stdDQ);
+
+    for (int i = 0; i < 100; ++i) {
+        this->originalBL.pushBegin(-i);
+        this->stdDQ.push_front(-i);
+        this->originalBL.pushEnd(i);
+        this->stdDQ.push_back(i);
+    }
+    compareBlocksList(this->originalBL, this->stdDQ);
+
+    while (!this->originalBL.empty()) {
+        this->originalBL.popEnd();
+    }
+    this->originalBL.shrinkToFit();
+    this->originalBL.pushEnd(1);
+    EXPECT_EQ(this->originalBL.get(0), 1);
+}
+
+// 测试区间构造与批量追加
+TEST_F(BlocksListTest, RangePushEndTest) {
+    const original::chain<int> c = {1, 2, 3, 4, 5};
+    original::blocksList<int> fromChain(c.begin(), c.end());
+    compareBlocksList(fromChain, {1, 2, 3, 4, 5});
+
+    for (int i = 0; i < 100; ++i) {
+        this->originalBL.pushBegin(i);
+        this->stdDQ.push_front(i);
+    }
+    this->originalBL.pushEnd(fromChain.begin(), fromChain.end());
+    for (int i = 1; i <= 5; ++i) {
+        this->stdDQ.push_back(i);
+    }
+    compareBlocksList(this->originalBL, this->stdDQ);
+}
+
+// 测试块大小参数
+TEST(BlocksListBlockTest, BlockSizeTest) {
+    struct large { char bytes[1024]; };
+    EXPECT_EQ(original::blocksList<int>::blockSize(), 1024);
+    EXPECT_EQ(original::blocksList<large>::blockSize(), 16);
+    EXPECT_EQ((original::blocksList<int, 4>::blockSize()), 4);
+
+    original::blocksList<int, 4> bl = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+    EXPECT_EQ(bl.blockCount(), 3);
+    original::blocksList<int, 4> copy = bl;
+    copy.pushBegin(0);
+    EXPECT_EQ(copy.get(0), 0);
+    EXPECT_EQ(copy.get(-1), 9);
+    EXPECT_EQ(bl.size(), 9);
+}
+
+template<uint32_t BLOCK_SIZE>
+void checkSmallBlockEnds() {
+    original::blocksList<int, BLOCK_SIZE> bl;
+    bl.pushEnd(1);
+    EXPECT_EQ(bl.popBegin(), 1);
+    bl.pushBegin(2);
+    EXPECT_EQ(bl.popEnd(), 2);
+    EXPECT_TRUE(bl.empty());
+
+    std::deque<int> dq;
+    for (int i = 0; i < 3 * static_cast<int>(BLOCK_SIZE); ++i) {
+        bl.pushBegin(-i);
+        dq.push_front(-i);
+        bl.pushEnd(i);
+        dq.push_back(i);
+        compareSmallBlocks(bl, dq);
+    }
+    while (!dq.empty()) {
+        ASSERT_EQ(bl.popBegin(), dq.front());
+        dq.pop_front();
+        ASSERT_EQ(bl.popEnd(), dq.back());
+        dq.pop_back();
+        compareSmallBlocks(bl, dq);
+    }
+    bl.pushEnd(3);
+    EXPECT_EQ(bl.popBegin(), 3);
+    EXPECT_TRUE(bl.empty());
+}
+
+// 测试最小块大小下空列表两端的初始位置
+TEST(BlocksListBlockTest, SmallestBlockTest) {
+    checkSmallBlockEnds<4>();
+    checkSmallBlockEnds<5>();
+    checkSmallBlockEnds<6>();
+}
+
+// 测试两端反复压入弹出时块的回收与复用
+TEST(BlocksListBlockTest, ChurnTest) {
+    original::blocksList<int, 4> bl;
+    std::deque<int> dq;
+    std::mt19937 gen(11);
+    for (int step = 0; step < 200000; ++step) {
+        const uint32_t op = gen() % 8;
+        if (op < 2 || dq.empty()) {
+            bl.pushEnd(step);
+            dq.push_back(step);
+        } else if (op < 4) {
+            bl.pushBegin(step);
+            dq.push_front(step);
+        } else if (op < 5) {
+            ASSERT_EQ(bl.popBegin(), dq.front());
+            dq.pop_front();
+        } else if (op < 6) {
+            ASSERT_EQ(bl.popEnd(), dq.back());
+            dq.pop_back();
+        } else if (op < 7) {
+            const uint32_t index = gen() % (dq.size() + 1);
+            bl.push(index, -step);
+            dq.insert(dq.begin() + index, -step);
+        } else {
+            const uint32_t index = gen() % dq.size();
+            ASSERT_EQ(bl.pop(index), dq[index]);
+            dq.erase(dq.begin() + index);
+        }
+        ASSERT_EQ(bl.size(), dq.size());
+        if (step % 1000 == 0) {
+            std::deque<int> expected(dq);
+            compareSmallBlocks(bl, expected);
+        }
+    }
+
+    // 队列式使用：容量只随元素数量变化，不会随已弹出的元素增长
+    original::blocksList<int, 4> queue;
+    for (int i = 0; i < 40; ++i) {
+        queue.pushEnd(i);
+    }
+    const uint32_t capacity = queue.capacity();
+    for (int i = 40; i < 100000; ++i) {
+        ASSERT_EQ(queue.popBegin(), i - 40);
+        queue.pushEnd(i);
+        ASSERT_LE(queue.capacity(), capacity + 2 * 4);
+    }
+    while (!queue.empty()) {
+        queue.popBegin();
+    }
+    queue.pushBegin(1);
+    EXPECT_EQ(queue.get(0), 1);
+}
@@ -1,11 +1,14 @@
 #include <list>
 #include <random>
 #include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
 #include "chain.h"
 
 namespace original {
-    template <typename T>
-    bool compareChainsAndLists(const chain<T>& c, const std::list<T>& l) {
+    template <typename T, typename ALLOC>
+    bool compareChainsAndLists(const chain<T, ALLOC>& c, const std::list<T>& l) {
         if (c.size() != l.size()) {
             return false;
         }
@@ -391,4 +394,345 @@ namespace original {
         // 检查 c1 是否为空
         EXPECT_EQ(c1.size(), 0);
     }
+
+    // 测试右值插入与原位构造
+    TEST(ChainTest, EmplaceTest) {
+        chain<std::string> c;
+        std::string moved(64, 'm');
+        c.pushEnd(std::move(moved));
+        EXPECT_TRUE(moved.empty());
+        c.emplaceEnd(3, 'a');
+        c.emplaceBegin("begin");
+        c.emplace(1, "middle", 3);
+        c.push(2, std::string("pushed"));
+
+        const std::list<std::string> l = {"begin", "mid", "pushed", std::string(64, 'm'), "aaa"};
+        EXPECT_EQ(c.size(), 5);
+        EXPECT_TRUE(compareChainsAndLists(c, l));
+        EXPECT_EQ(c.popEnd(), "aaa");
+        EXPECT_EQ(c.popBegin(), "begin");
+        EXPECT_EQ(c.pop(1), "pushed");
+    }
+
+    // 测试使用对象池分配器的链表
+    TEST(ChainTest, PoolAllocatorTest) {
+        chain<std::string, poolAllocator<std::string>> c = {"b", "c"};
+        c.pushBegin("a");
+        c.emplaceEnd(2, 'd');
+        EXPECT_TRUE(compareChainsAndLists(c, std::list<std::string>{"a", "b", "c", "dd"}));
+        auto copied = c;
+        EXPECT_EQ(copied.popBegin(), "a");
+        c += copied;
+        EXPECT_TRUE(compareChainsAndLists(c, std::list<std::string>{"a", "b", "c", "dd", "b", "c", "dd"}));
+        EXPECT_TRUE(copied.empty());
+    }
+
+    // 测试连接后的节点在原链表销毁后仍然有效
+    TEST(ChainTest, PooledNodesOutliveSourceTest) {
+        chain<std::string, poolAllocator<std::string>> c1 = {"a", "b"};
+        {
+            chain<std::string, poolAllocator<std::string>> c2;
+            for (int i = 0; i < 100; ++i) {
+                c2.pushEnd(std::to_string(i));
+            }
+            c1 += c2;
+            c2.pushEnd("reused");
+        }
+        EXPECT_EQ(c1.size(), 102);
+        EXPECT_EQ(c1.get(2), "0");
+        EXPECT_EQ(c1.get(-1), "99");
+        while (c1.size() > 1) {
+            c1.popBegin();
+        }
+        chain<std::string, poolAllocator<std::string>> moved;
+        {
+            chain<std::string, poolAllocator<std::string>> source = {"x", "y"};
+            moved = std::move(source);
+            source.pushEnd("z");
+        }
+        EXPECT_TRUE(compareChainsAndLists(moved, std::list<std::string>{"x", "y"}));
+    }
+
+    // 测试共享同一个对象池的链表连接时直接转移节点
+    TEST(ChainTest, SharedPoolConcatTest) {
+        using pooled = chain<std::string, poolAllocator<std::string>>;
+        const poolAllocator<std::string> alloc;
+        pooled c1(alloc);
+        c1.pushEnd("a");
+        const std::string* node;
+        {
+            pooled c2(alloc);
+            for (int i = 0; i < 100; ++i) {
+                c2.pushEnd(std::to_string(i));
+            }
+            node = &c2[50];
+            c1.concat(c2);
+            EXPECT_TRUE(c2.empty());
+            c2.pushEnd("reused");
+        }
+        EXPECT_EQ(c1.size(), 101);
+        EXPECT_EQ(&c1[51], node);
+        EXPECT_EQ(c1.get(-1), "99");
+
+        // 各自构造的对象池之间只能逐个复制元素
+        pooled other = {"x"};
+        node = &other[0];
+        c1.concat(other);
+        EXPECT_NE(&c1[-1], node);
+        EXPECT_EQ(c1.get(-1), "x");
+    }
+
+    TEST(ChainTest, FastRangeTest) {
+        chain<int> c = {1, 2, 3, 4};
+        for (auto& e : fast(c)) {
+            e *= 10;
+        }
+        EXPECT_TRUE(compareChainsAndLists(c, std::list<int>{10, 20, 30, 40}));
+
+        const chain<int>& view = c;
+        std::list<int> seen;
+        for (const int e : fast(view)) {
+            seen.push_back(e);
+        }
+        EXPECT_EQ(seen, (std::list<int>{10, 20, 30, 40}));
+
+        c.popEnd();
+        c.popBegin();
+        EXPECT_EQ(*c.fastBegin(), 20);
+        auto it = c.fastBegin();
+        ++it;
+        EXPECT_EQ(*it, 30);
+        EXPECT_EQ(++it, c.fastEnd());
+        c.popEnd();
+        c.popEnd();
+        EXPECT_EQ(c.fastBegin(), c.fastEnd());
+        c.pushEnd(5);
+        EXPECT_EQ(*c.fastBegin()++, 5);
+    }
+
+    TEST(ChainTest, FingerConsistencyTest) {
+        // Indexed access moves the cached finger, every kind of update has to keep it in place.
+        chain<int> c;
+        std::vector<int> expected;
+        std::mt19937 gen(11);
+        int next = 0;
+        for (int step = 0; step < 20000; ++step) {
+            const uint32_t size = expected.size();
+            const int64_t near = size == 0 ? 0 : (step * 7 + static_cast<int64_t>(gen() % 5)) % size;
+            switch (gen() % 9) {
+                case 0:
+                    c.pushBegin(next);
+                    expected.insert(expected.begin(), next++);
+                    break;
+                case 1:
+                    c.pushEnd(next);
+                    expected.push_back(next++);
+                    break;
+                case 2:
+                    c.push(near, next);
+                    expected.insert(expected.begin() + near, next++);
+                    break;
+                case 3:
+                    if (size > 0) {
+                        EXPECT_EQ(c.popBegin(), expected.front());
+                        expected.erase(expected.begin());
+                    }
+                    break;
+                case 4:
+                    if (size > 0) {
+                        EXPECT_EQ(c.popEnd(), expected.back());
+                        expected.pop_back();
+                    }
+                    break;
+                case 5:
+                    if (size > 0 && size < 300) {
+                        EXPECT_EQ(c.pop(near), expected[near]);
+                        expected.erase(expected.begin() + near);
+                    }
+                    break;
+                case 6:
+                    if (size > 0) {
+                        c.set(near, -step);
+                        expected[near] = -step;
+                    }
+                    break;
+                default:
+                    if (size > 0) {
+                        ASSERT_EQ(c.get(near), expected[near]) << "step " << step;
+                        ASSERT_EQ(c[-1], expected.back());
+                    }
+            }
+            ASSERT_EQ(c.size(), expected.size());
+        }
+        for (uint32_t i = 0; i < expected.size(); ++i) {
+            ASSERT_EQ(c.get(i), expected[i]);
+        }
+
+        // Copies and moves start from their own nodes.
+        chain<int> copied = c;
+        copied.set(0, 42);
+        EXPECT_EQ(c.get(0), expected[0]);
+        chain<int> moved = std::move(copied);
+        EXPECT_EQ(moved.get(0), 42);
+        EXPECT_EQ(moved.get(-1), expected.back());
+    }
+
+    TEST(ChainTest, SpliceTest) {
+        chain<int> a = {1, 2, 3};
+        chain<int> b = {10, 20, 30, 40};
+        a.splice(1, b, 1, 3);
+        EXPECT_EQ(a, (chain<int>{1, 20, 30, 2, 3}));
+        EXPECT_EQ(b, (chain<int>{10, 40}));
+        a.splice(0, b);
+        EXPECT_EQ(a, (chain<int>{10, 40, 1, 20, 30, 2, 3}));
+        EXPECT_TRUE(b.empty());
+
+        // An emptied list takes new elements as usual, and concatenating onto it works.
+        b.pushEnd(5);
+        chain<int> empty;
+        empty.concat(b);
+        empty += a;
+        EXPECT_EQ(empty, (chain<int>{5, 10, 40, 1, 20, 30, 2, 3}));
+        EXPECT_TRUE(a.empty() && b.empty());
+        EXPECT_EQ(empty.getBegin(), 5);
+        EXPECT_EQ(empty.getEnd(), 3);
+
+        chain<int> tail = empty.split(-3);
+        EXPECT_EQ(empty, (chain<int>{5, 10, 40, 1, 20}));
+        EXPECT_EQ(tail, (chain<int>{30, 2, 3}));
+        EXPECT_TRUE(empty.split(5).empty());
+        chain<int> all = empty.split(0);
+        EXPECT_TRUE(empty.empty());
+        EXPECT_EQ(all.size(), 5);
+        all.pushEnd(6);
+        EXPECT_EQ(all.getEnd(), 6);
+
+        EXPECT_THROW(all.splice(0, all), valueError);
+        EXPECT_THROW(all.splice(7, tail), outOfBoundError);
+        EXPECT_THROW(all.splice(0, tail, 2, 1), outOfBoundError);
+        EXPECT_THROW(all.splice(0, tail, 0, 4), outOfBoundError);
+        EXPECT_THROW(static_cast<void>(all.split(7)), outOfBoundError);
+        EXPECT_EQ(tail.size(), 3);
+    }
+
+    TEST(ChainTest, SpliceFingerTest) {
+        // Splices move nodes under the fingers of both lists, compare against vectors after each one.
+        std::mt19937 gen(13);
+        chain<int> lists[2];
+        std::vector<int> expected[2];
+        int next = 0;
+        for (int step = 0; step < 3000; ++step) {
+            const uint32_t to = gen() % 2;
+            auto& dst = lists[to];
+            auto& src = lists[1 - to];
+            auto& dst_exp = expected[to];
+            auto& src_exp = expected[1 - to];
+            const uint32_t index = gen() % (dst_exp.size() + 1);
+            switch (gen() % 4) {
+                case 0: {
+                    const uint32_t first = gen() % (src_exp.size() + 1);
+                    const uint32_t last = first + gen() % (src_exp.size() - first + 1);
+                    dst.splice(index, src, first, last);
+                    dst_exp.insert(dst_exp.begin() + index, src_exp.begin() + first, src_exp.begin() + last);
+                    src_exp.erase(src_exp.begin() + first, src_exp.begin() + last);
+                    break;
+                }
+                case 1: {
+                    chain<int> part = dst.split(index);
+                    src.concat(part);
+                    src_exp.insert(src_exp.end(), dst_exp.begin() + index, dst_exp.end());
+                    dst_exp.erase(dst_exp.begin() + index, dst_exp.end());
+                    break;
+                }
+                default:
+                    for (int i = 0; i < 4; ++i) {
+                        dst.push(index, next);
+                        dst_exp.insert(dst_exp.begin() + index, next++);
+                    }
+            }
+            for (uint32_t l = 0; l < 2; ++l) {
+                ASSERT_EQ(lists[l].size(), expected[l].size()) << "step " << step;
+                if (!expected[l].empty()) {
+                    const uint32_t probe = gen() % expected[l].size();
+                    ASSERT_EQ(lists[l].get(probe), expected[l][probe]) << "step " << step;
+                    ASSERT_EQ(lists[l].get(-1), expected[l].back()) << "step " << step;
+                }
+            }
+        }
+        for (uint32_t l = 0; l < 2; ++l) {
+            uint32_t i = 0;
+            for (const int e : fast(lists[l])) {
+                ASSERT_EQ(e, expected[l][i++]);
+            }
+            ASSERT_EQ(i, expected[l].size());
+        }
+    }
+
+    TEST(ChainTest, SpliceThreadTest) {
+        // Pooled lists that exchanged nodes are afterwards used from different threads, each must
+        // only touch its own pool.
+        using pooled = chain<std::string, poolAllocator<std::string>>;
+        pooled shared = {"s0", "s1"};
+        pooled local;
+        for (int i = 0; i < 100; ++i) {
+            local.pushEnd(std::to_string(i));
+        }
+        shared.concat(local);
+        local.splice(0, shared, 0, 2);
+        pooled tail = shared.split(50);
+        pooled moved = std::move(tail);
+        ASSERT_EQ(shared.size(), 50);
+        ASSERT_EQ(local.size(), 2);
+        ASSERT_EQ(moved.size(), 50);
+
+        auto churn = [](pooled& list, const std::string& tag) {
+            for (int i = 0; i < 20000; ++i) {
+                list.pushEnd(tag + std::to_string(i));
+                if (i % 3 != 0) {
+                    list.popBegin();
+                }
+            }
+        };
+        std::thread t1(churn, std::ref(shared), "a");
+        std::thread t2(churn, std::ref(local), "b");
+        std::thread t3(churn, std::ref(moved), "c");
+        t1.join();
+        t2.join();
+        t3.join();
+        EXPECT_EQ(shared.size(), 50 + 6667);
+        EXPECT_EQ(local.size(), 2 + 6667);
+        EXPECT_EQ(moved.size(), 50 + 6667);
+        EXPECT_EQ(shared.get(-1), "a19999");
+        EXPECT_EQ(local.get(-1), "b19999");
+        EXPECT_EQ(moved.get(-1), "c19999");
+    }
+
+    TEST(ChainTest, ConstConcurrentReadTest) {
+        // Const lookups leave the finger alone, so threads may read one list at the same time.
+        chain<int> c;
+        for (int i = 0; i < 2000; ++i) {
+            c.pushEnd(i);
+        }
+        static_cast<void>(c[1000]);
+        const auto& view = c;
+        auto scan = [&view](const int stride, bool& ok) {
+            for (int i = 0; i < 2000; i += stride) {
+                ok = ok && view.get(i) == i;
+            }
+        };
+        bool ok[4] = {true, true, true, true};
+        std::thread readers[4];
+        for (int t = 0; t < 4; ++t) {
+            readers[t] = std::thread(scan, t + 1, std::ref(ok[t]));
+        }
+        for (auto& r : readers) {
+            r.join();
+        }
+        for (const bool b : ok) {
+            EXPECT_TRUE(b);
+        }
+        for (int i = 0; i < 2000; ++i) {
+            ASSERT_EQ(c.get(i), i);
+        }
+    }
 }
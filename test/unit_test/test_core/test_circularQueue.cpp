@@ -0,0 +1,261 @@
+#include <deque>
+#include <gtest/gtest.h>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include "circularQueue.h"
+#include "vector.h"
+
+// 对比函数，用于比较 original::circularQueue 和 std::deque
+template<typename T>
+void compareCircularQueue(const original::circularQueue<T>& originalCQ, const std::deque<T>& stdDQ) {
+    ASSERT_EQ(originalCQ.size(), stdDQ.size());
+    for (size_t i = 0; i < stdDQ.size(); ++i) {
+        ASSERT_EQ(originalCQ.get(i), stdDQ[i]);
+    }
+}
+
+// 测试 original::circularQueue 类
+class CircularQueueTest : public testing::Test {
+protected:
+    void SetUp() override {
+        originalCQ = original::circularQueue<int>();
+        stdDQ = std::deque<int>();
+    }
+
+    original::circularQueue<int> originalCQ;
+    std::deque<int> stdDQ;
+};
+
+// 测试两端的 push 和 pop 操作
+TEST_F(CircularQueueTest, PushPopTest) {
+    this->originalCQ.pushEnd(1);
+    this->stdDQ.push_back(1);
+    this->originalCQ.pushBegin(2);
+    this->stdDQ.push_front(2);
+    this->originalCQ.push(1, 3);
+    this->stdDQ.insert(this->stdDQ.begin() + 1, 3);
+    compareCircularQueue(this->originalCQ, this->stdDQ);
+
+    EXPECT_EQ(this->originalCQ.popEnd(), 1);
+    this->stdDQ.pop_back();
+    EXPECT_EQ(this->originalCQ.popBegin(), 2);
+    this->stdDQ.pop_front();
+    compareCircularQueue(this->originalCQ, this->stdDQ);
+
+    EXPECT_EQ(this->originalCQ.pop(0), 3);
+    EXPECT_TRUE(this->originalCQ.empty());
+    EXPECT_THROW(this->originalCQ.popBegin(), original::noElementError);
+    EXPECT_THROW(this->originalCQ.popEnd(), original::noElementError);
+}
+
+// 测试元素绕过缓冲区末尾以及在绕回状态下扩容
+TEST_F(CircularQueueTest, WrapAroundTest) {
+    for (int i = 0; i < 10; ++i) {
+        this->originalCQ.pushEnd(i);
+        this->stdDQ.push_back(i);
+    }
+    for (int round = 0; round < 100; ++round) {
+        EXPECT_EQ(this->originalCQ.popBegin(), this->stdDQ.front());
+        this->stdDQ.pop_front();
+        this->originalCQ.pushEnd(round + 10);
+        this->stdDQ.push_back(round + 10);
+    }
+    EXPECT_EQ(this->originalCQ.capacity(), 16);
+    compareCircularQueue(this->originalCQ, this->stdDQ);
+
+    for (int i = 0; i < 100; ++i) {
+        this->originalCQ.pushBegin(-i);
+        this->stdDQ.push_front(-i);
+        this->originalCQ.pushEnd(i);
+        this->stdDQ.push_back(i);
+    }
+    compareCircularQueue(this->originalCQ, this->stdDQ);
+    EXPECT_EQ(this->originalCQ.capacity(), 256);
+}
+
+// 测试索引访问、负索引与越界
+TEST_F(CircularQueueTest, IndexAndSetTest) {
+    this->originalCQ = {1, 2, 3, 4};
+    this->originalCQ.popBegin();
+    this->originalCQ.pushEnd(5);
+    EXPECT_EQ(this->originalCQ[0], 2);
+    EXPECT_EQ(this->originalCQ.get(-1), 5);
+    this->originalCQ.set(1, 30);
+    this->originalCQ[-2] = 40;
+    EXPECT_EQ(this->originalCQ.get(1), 30);
+    EXPECT_EQ(this->originalCQ.get(2), 40);
+    EXPECT_EQ(this->originalCQ.indexOf(40), 2);
+    EXPECT_EQ(this->originalCQ.indexOf(100), this->originalCQ.size());
+    EXPECT_THROW(this->originalCQ.get(4), original::outOfBoundError);
+    EXPECT_THROW(this->originalCQ.set(-5, 0), original::outOfBoundError);
+}
+
+// 测试随机位置插入和删除
+TEST_F(CircularQueueTest, InsertPopMiddleTest) {
+    std::mt19937 gen(7);
+    for (int i = 0; i < 2000; ++i) {
+        const uint32_t size = this->stdDQ.size();
+        if (size > 0 && gen() % 3 == 0) {
+            const uint32_t index = gen() % size;
+            EXPECT_EQ(this->originalCQ.pop(index), this->stdDQ[index]);
+            this->stdDQ.erase(this->stdDQ.begin() + index);
+        } else {
+            const uint32_t index = gen() % (size + 1);
+            this->originalCQ.push(index, i);
+            this->stdDQ.insert(this->stdDQ.begin() + index, i);
+        }
+    }
+    compareCircularQueue(this->originalCQ, this->stdDQ);
+}
+
+// 测试迭代器遍历与修改
+TEST_F(CircularQueueTest, IteratorTest) {
+    for (int i = 0; i < 20; ++i) {
+        this->originalCQ.pushBegin(i);
+        this->stdDQ.push_front(i);
+    }
+    size_t i = 0;
+    for (const auto it = this->originalCQ.begin(); it.isValid(); it.next()) {
+        EXPECT_EQ(it.get(), this->stdDQ[i]);
+        i += 1;
+    }
+    EXPECT_EQ(i, this->stdDQ.size());
+
+    auto it = this->originalCQ.begin();
+    it += 3;
+    it.set(100);
+    EXPECT_EQ(this->originalCQ.get(3), 100);
+    EXPECT_EQ(this->originalCQ.end() - this->originalCQ.begin(), this->originalCQ.size());
+    EXPECT_EQ(this->originalCQ.last().get(), this->stdDQ.back());
+}
+
+// 测试拷贝与移动
+TEST_F(CircularQueueTest, CopyMoveTest) {
+    for (int i = 0; i < 40; ++i) {
+        this->originalCQ.pushBegin(i);
+    }
+    original::circularQueue<int> copied(this->originalCQ);
+    EXPECT_EQ(copied, this->originalCQ);
+    copied.popBegin();
+    EXPECT_EQ(this->originalCQ.size(), 40);
+
+    original::circularQueue<int> moved(std::move(copied));
+    EXPECT_EQ(moved.size(), 39);
+    EXPECT_TRUE(copied.empty());
+    copied = moved;
+    EXPECT_EQ(copied, moved);
+    moved = std::move(this->originalCQ);
+    EXPECT_EQ(moved.size(), 40);
+    EXPECT_TRUE(this->originalCQ.empty());
+}
+
+// 测试容量控制
+TEST_F(CircularQueueTest, ReserveShrinkTest) {
+    EXPECT_EQ(this->originalCQ.capacity(), 16);
+    this->originalCQ.reserve(100);
+    EXPECT_EQ(this->originalCQ.capacity(), 128);
+    for (int i = 0; i < 100; ++i) {
+        this->originalCQ.pushBegin(i);
+        this->stdDQ.push_front(i);
+    }
+    EXPECT_EQ(this->originalCQ.capacity(), 128);
+    for (int i = 0; i < 70; ++i) {
+        this->originalCQ.popEnd();
+        this->stdDQ.pop_back();
+    }
+    this->originalCQ.shrinkToFit();
+    EXPECT_EQ(this->originalCQ.capacity(), 32);
+    compareCircularQueue(this->originalCQ, this->stdDQ);
+}
+
+// 测试原位构造与右值插入
+TEST_F(CircularQueueTest, EmplaceTest) {
+    original::circularQueue<std::string> cq;
+    std::string moved(64, 'm');
+    cq.pushEnd(std::move(moved));
+    EXPECT_TRUE(moved.empty());
+    cq.emplaceEnd(3, 'a');
+    cq.emplaceBegin("begin");
+    cq.emplace(1, "middle", 3);
+    std::deque<std::string> expected = {"begin", "mid", std::string(64, 'm'), "aaa"};
+    // 参数引用队列自身的元素时, 扩容不能使其失效
+    for (int i = 0; i < 20; ++i) {
+        cq.emplaceEnd(cq[0]);
+        expected.emplace_back("begin");
+    }
+    compareCircularQueue(cq, expected);
+}
+
+namespace {
+    // 构造失败的元素类型: 负值构造时抛出, moves_left 减到 0 时下一次移动抛出
+    struct fragile {
+        static inline int64_t alive = 0;
+        static inline int moves_left = -1;
+        int value;
+
+        explicit fragile(const int v) : value(v) {
+            if (v < 0) throw std::runtime_error("fragile");
+            alive += 1;
+        }
+        fragile(const fragile& other) : value(other.value) { alive += 1; }
+        fragile(fragile&& other) : value(other.value) {
+            if (moves_left == 0) {
+                moves_left = -1;
+                throw std::runtime_error("fragile move");
+            }
+            if (moves_left > 0) moves_left -= 1;
+            alive += 1;
+        }
+        fragile& operator=(const fragile& other) = default;
+        fragile& operator=(fragile&& other) = default;
+        ~fragile() { alive -= 1; }
+
+        bool operator==(const fragile& other) const { return value == other.value; }
+        bool operator!=(const fragile& other) const { return value != other.value; }
+        bool operator<(const fragile& other) const { return value < other.value; }
+        friend std::ostream& operator<<(std::ostream& os, const fragile& f) { return os << f.value; }
+    };
+}
+
+// 测试元素构造抛出异常时队列保持原状
+TEST_F(CircularQueueTest, ThrowingEmplaceTest) {
+    {
+        original::circularQueue<fragile> cq;
+        for (int i = 0; i < 10; ++i) {
+            cq.emplaceEnd(i);
+        }
+        const auto check = [&cq] {
+            ASSERT_EQ(cq.size(), 10);
+            for (int i = 0; i < 10; ++i) {
+                ASSERT_EQ(cq.get(i).value, i);
+            }
+            ASSERT_EQ(fragile::alive, 10);
+        };
+        EXPECT_THROW(cq.emplaceBegin(-1), std::runtime_error);
+        check();
+        EXPECT_THROW(cq.emplace(3, -1), std::runtime_error);
+        check();
+        // 两端各自移出第一个元素时失败
+        fragile::moves_left = 0;
+        EXPECT_THROW(cq.emplace(2, 100), std::runtime_error);
+        check();
+        fragile::moves_left = 0;
+        EXPECT_THROW(cq.emplace(8, 100), std::runtime_error);
+        check();
+        cq.emplace(2, 100);
+        cq.emplaceBegin(0);
+        EXPECT_EQ(cq.size(), 12);
+        EXPECT_EQ(cq.get(3).value, 100);
+    }
+    EXPECT_EQ(fragile::alive, 0);
+}
+
+// 测试由迭代器范围构造
+TEST_F(CircularQueueTest, RangeConstructTest) {
+    const original::vector<int> source = {1, 2, 3, 4, 5};
+    const original::circularQueue<int> cq(source.begin(), source.end());
+    compareCircularQueue(cq, std::deque<int>{1, 2, 3, 4, 5});
+    const original::circularQueue<int> arr_cq(original::array<int>{7, 8});
+    compareCircularQueue(arr_cq, std::deque<int>{7, 8});
+}
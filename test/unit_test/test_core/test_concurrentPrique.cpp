@@ -0,0 +1,100 @@
+#include <algorithm>
+#include <numeric>
+#include <atomic>
+#include <gtest/gtest.h>
+#include <random>
+#include <set>
+#include <thread>
+#include <vector>
+#include "comparator.h"
+#include "concurrentPrique.h"
+#include "error.h"
+
+namespace original {
+
+    // 测试单个分片时与 prique 一样严格有序
+    TEST(ConcurrentPriqueTest, SingleShardOrderTest) {
+        concurrentPrique<int> pq(1);
+        std::vector<int> values(200);
+        std::iota(values.begin(), values.end(), 0);
+        std::shuffle(values.begin(), values.end(), std::mt19937(3));
+        for (const int v : values) {
+            pq.push(v);
+        }
+        EXPECT_EQ(pq.size(), 200);
+        EXPECT_EQ(pq.top(), 0);
+        int e = -1;
+        for (int i = 0; i < 200; ++i) {
+            EXPECT_TRUE(pq.tryPop(e));
+            EXPECT_EQ(e, i);
+        }
+        EXPECT_FALSE(pq.tryPop(e));
+        EXPECT_THROW(pq.top(), noElementError);
+        EXPECT_THROW(concurrentPrique<int>(0), valueError);
+    }
+
+    // 测试多个分片时 top 始终为剩余元素中的全局最优, 且弹出的元素不丢失不重复
+    TEST(ConcurrentPriqueTest, ShardedTest) {
+        concurrentPrique<int, decreaseComparator> pq(8);
+        std::set<int> remaining;
+        for (int i = 0; i < 1000; ++i) {
+            pq.push(i);
+            remaining.insert(i);
+        }
+        std::vector<int> popped;
+        int e;
+        while (!remaining.empty()) {
+            ASSERT_EQ(pq.top(), *remaining.rbegin());
+            ASSERT_TRUE(pq.tryPop(e));
+            ASSERT_EQ(remaining.erase(e), 1);
+            popped.push_back(e);
+        }
+        EXPECT_FALSE(pq.tryPop(e));
+        EXPECT_EQ(popped.size(), 1000);
+        EXPECT_TRUE(pq.empty());
+        std::sort(popped.begin(), popped.end());
+        for (int i = 0; i < 1000; ++i) {
+            ASSERT_EQ(popped[i], i);
+        }
+    }
+
+    // 测试多线程同时入队与出队时每个元素恰好被取出一次
+    TEST(ConcurrentPriqueTest, ConcurrentStressTest) {
+        constexpr int producers = 4;
+        constexpr int consumers = 4;
+        constexpr int per_producer = 20000;
+        concurrentPrique<int> pq(8);
+        std::vector<std::atomic<int>> seen(producers * per_producer);
+        std::atomic<int> popped{0};
+
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; ++p) {
+            threads.emplace_back([&pq, p] {
+                for (int i = 0; i < per_producer; ++i) {
+                    pq.push(p * per_producer + i);
+                }
+            });
+        }
+        for (int c = 0; c < consumers; ++c) {
+            threads.emplace_back([&] {
+                int e;
+                while (popped.load() < producers * per_producer) {
+                    if (pq.tryPop(e)) {
+                        seen[e].fetch_add(1);
+                        popped.fetch_add(1);
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+
+        EXPECT_TRUE(pq.empty());
+        for (const auto& hit : seen) {
+            ASSERT_EQ(hit.load(), 1);
+        }
+    }
+}
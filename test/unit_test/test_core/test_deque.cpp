@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 #include <deque>
+#include <string>
 #include "blocksList.h"
+#include "circularQueue.h"
 #include "deque.h"
 #include "forwardChain.h"
 #include "vector.h"
@@ -159,6 +161,40 @@ TEST(DequeTest, BlocksListDeque) {
     EXPECT_TRUE(d2.empty());
 }
 
+// Test deque with `circularQueue` as the underlying container
+TEST(DequeTest, CircularQueueDeque) {
+    original::deque<int, original::circularQueue> d1;
+    std::deque<int> d2;
+
+    EXPECT_EQ(d1.size(), 0);
+    EXPECT_TRUE(d1.empty());
+    EXPECT_TRUE(d2.empty());
+
+    // Test pushBegin, pushEnd, head, tail, popBegin, popEnd
+    d1.pushBegin(10);
+    d2.push_front(10);
+    EXPECT_EQ(d1.head(), d2.front());
+    EXPECT_EQ(d1.tail(), d2.back());
+    EXPECT_TRUE(compareDeques(d1, d2));
+
+    d1.pushEnd(20);
+    d2.push_back(20);
+    EXPECT_EQ(d1.head(), d2.front());
+    EXPECT_EQ(d1.tail(), d2.back());
+    EXPECT_TRUE(compareDeques(d1, d2));
+
+    EXPECT_EQ(d1.popBegin(), 10);
+    d2.pop_front();
+    EXPECT_EQ(d1.head(), d2.front());
+    EXPECT_EQ(d1.tail(), d2.back());
+    EXPECT_TRUE(compareDeques(d1, d2));
+
+    EXPECT_EQ(d1.popEnd(), 20);
+    d2.pop_back();
+    EXPECT_TRUE(d1.empty());
+    EXPECT_TRUE(d2.empty());
+}
+
 // Test copy constructor
 TEST(DequeTest, CopyConstructor) {
     original::deque<int> d1;
@@ -222,3 +258,19 @@ TEST(DequeTest, MoveAssignmentOperator) {
     EXPECT_TRUE(compareDeques(d3, d2));
     EXPECT_TRUE(d1.empty());  // d1 should be empty after move
 }
+
+// Test rvalue push and in-place emplace
+TEST(DequeTest, EmplaceTest) {
+    original::deque<std::string> d;
+    std::string moved(64, 'm');
+    d.pushBegin(std::move(moved));
+    EXPECT_TRUE(moved.empty());
+    d.pushEnd(std::string("end"));
+    d.emplaceBegin(3, 'a');
+    d.emplaceEnd("tail");
+
+    EXPECT_EQ(d.popBegin(), "aaa");
+    EXPECT_EQ(d.popBegin(), std::string(64, 'm'));
+    EXPECT_EQ(d.popEnd(), "tail");
+    EXPECT_EQ(d.popEnd(), "end");
+}
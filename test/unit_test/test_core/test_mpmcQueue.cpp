@@ -0,0 +1,113 @@
+#include <algorithm>
+#include <atomic>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "error.h"
+#include "mpmcQueue.h"
+
+namespace original {
+
+    // 测试容量取整与单线程下的先进先出
+    TEST(MpmcQueueTest, BasicTest) {
+        mpmcQueue<int> q(3);
+        EXPECT_EQ(q.capacity(), 4);
+        for (int round = 0; round < 3; ++round) {
+            for (int i = 0; i < 4; ++i) {
+                EXPECT_TRUE(q.tryPush(i));
+            }
+            EXPECT_FALSE(q.tryPush(4));
+            EXPECT_EQ(q.size(), 4);
+            int e = -1;
+            for (int i = 0; i < 4; ++i) {
+                EXPECT_TRUE(q.tryPop(e));
+                EXPECT_EQ(e, i);
+            }
+            EXPECT_FALSE(q.tryPop(e));
+            EXPECT_TRUE(q.empty());
+        }
+        EXPECT_THROW(mpmcQueue<int>(0), valueError);
+        EXPECT_THROW(mpmcQueue<int>((1u << 31) + 1), valueError);
+    }
+
+    // 测试批量入队与出队
+    TEST(MpmcQueueTest, BatchTest) {
+        mpmcQueue<int> q(8);
+        int src[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+        int dst[10] = {};
+        EXPECT_EQ(q.pushBatch(src, 10), 8);
+        EXPECT_EQ(q.popBatch(dst, 5), 5);
+        EXPECT_EQ(q.pushBatch(src + 8, 2), 2);
+        EXPECT_EQ(q.popBatch(dst + 5, 10), 5);
+        const int expected[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+        for (int i = 0; i < 10; ++i) {
+            EXPECT_EQ(dst[i], expected[i]);
+        }
+    }
+
+    // 测试只能移动的元素以及析构时释放剩余元素
+    TEST(MpmcQueueTest, MoveOnlyTest) {
+        mpmcQueue<std::unique_ptr<std::string>> q(4);
+        q.push(std::make_unique<std::string>("a"));
+        q.push(std::make_unique<std::string>("b"));
+        EXPECT_EQ(*q.pop(), "a");
+        std::unique_ptr<std::string> p;
+        EXPECT_TRUE(q.tryPop(p));
+        EXPECT_EQ(*p, "b");
+        q.push(std::make_unique<std::string>("c"));
+    }
+
+    // 测试多个生产者与多个消费者并发时每个元素恰好被取出一次, 且同一生产者的元素保持顺序
+    TEST(MpmcQueueTest, ConcurrentStressTest) {
+        constexpr int producers = 4;
+        constexpr int consumers = 4;
+        constexpr int64_t per_producer = 50000;
+        mpmcQueue<int64_t> q(128);
+        std::vector<std::atomic<int>> seen(producers * per_producer);
+        std::atomic<int64_t> popped{0};
+        std::atomic<bool> ordered{true};
+
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; ++p) {
+            threads.emplace_back([&q, p] {
+                for (int64_t i = 0; i < per_producer; ++i) {
+                    q.push(p * per_producer + i);
+                }
+            });
+        }
+        for (int c = 0; c < consumers; ++c) {
+            threads.emplace_back([&] {
+                int64_t last[producers];
+                std::fill(last, last + producers, -1);
+                int64_t batch[8];
+                while (popped.load() < producers * per_producer) {
+                    const uint32_t n = q.popBatch(batch, 8);
+                    if (n == 0) {
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    for (uint32_t i = 0; i < n; ++i) {
+                        const int64_t producer = batch[i] / per_producer;
+                        if (batch[i] <= last[producer])
+                            ordered.store(false);
+                        last[producer] = batch[i];
+                        seen[batch[i]].fetch_add(1);
+                    }
+                    popped.fetch_add(n);
+                }
+            });
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+
+        EXPECT_TRUE(ordered.load());
+        EXPECT_EQ(popped.load(), producers * per_producer);
+        for (const auto& hit : seen) {
+            ASSERT_EQ(hit.load(), 1);
+        }
+        EXPECT_TRUE(q.empty());
+    }
+}
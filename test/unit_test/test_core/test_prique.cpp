@@ -1,7 +1,11 @@
 #include <gtest/gtest.h>
 #include <queue>
+#include <random>
+#include <string>
 #include "prique.h"
 #include "blocksList.h"
+#include "chain.h"
+#include "vector.h"
 
 
 // Custom comparator to create a min-heap instead of max-heap
@@ -25,12 +29,13 @@ auto initPriQue(const std::initializer_list<T> &list) -> std::priority_queue<T,
 template <typename T,
           template <typename> typename Callback,
           template <typename> typename SERIAL,
+          uint32_t ARITY,
           typename Container = std::vector<T>,
           typename Comparator = std::greater<T>>
-bool comparePriques(const original::prique<T, Callback, SERIAL>& originalPrique,
+bool comparePriques(const original::prique<T, Callback, SERIAL, ARITY>& originalPrique,
                     const std::priority_queue<T, Container, Comparator>& stdQueue) {
     std::priority_queue<T, Container, Comparator> tempStd = stdQueue;
-    original::prique<T, Callback, SERIAL> tempOriginal = originalPrique;
+    original::prique<T, Callback, SERIAL, ARITY> tempOriginal = originalPrique;
 
     while (!tempOriginal.empty()) {
         if (tempOriginal.top() != tempStd.top()) {
@@ -205,3 +210,76 @@ TEST(PriqueTest, MoveAssignmentOperator) {
     EXPECT_TRUE(comparePriques(p3, p2));
     EXPECT_TRUE(p1.empty());  // p1 should be empty after move
 }
+
+// Test rvalue push and in-place emplace
+TEST(PriqueTest, EmplaceTest) {
+    original::prique<std::string> p;
+    std::string moved(64, 'm');
+    p.push(std::move(moved));
+    EXPECT_TRUE(moved.empty());
+    p.emplace(3, 'a');
+    p.emplace("zz");
+    p.push(std::string("b"));
+
+    EXPECT_EQ(p.pop(), "aaa");
+    EXPECT_EQ(p.pop(), "b");
+    EXPECT_EQ(p.pop(), std::string(64, 'm'));
+    EXPECT_EQ(p.pop(), "zz");
+}
+
+// Test 4-ary heaps over contiguous and linked storage
+TEST(PriqueTest, FourAryPrique) {
+    std::mt19937 gen(11);
+    original::prique<int, original::increaseComparator, original::vector, 4> p1;
+    original::prique<int, original::increaseComparator, original::chain, 4> p2;
+    auto p3 = initPriQue<int>({});
+    for (int i = 0; i < 300; ++i) {
+        const int v = static_cast<int>(gen() % 1000);
+        p1.push(v);
+        p2.push(v);
+        p3.push(v);
+    }
+    EXPECT_TRUE(comparePriques(p1, p3));
+    EXPECT_TRUE(comparePriques(p2, p3));
+
+    original::prique<int, original::decreaseComparator, original::vector, 4> p4({5, 9, 1, 7, 3, 8, 2});
+    auto p5 = initPriQue<int, std::vector<int>, std::less<int>>({5, 9, 1, 7, 3, 8, 2});
+    EXPECT_TRUE(comparePriques(p4, p5));
+}
+
+// Test pushAll with small batches (sift-up) and large batches (re-heapify)
+TEST(PriqueTest, PushAllTest) {
+    std::mt19937 gen(13);
+    original::prique<int> p1;
+    original::prique<int, original::increaseComparator, original::chain, 4> p2;
+    auto p3 = initPriQue<int>({});
+    for (const uint32_t batch : {200u, 3u, 1u, 0u, 500u, 7u}) {
+        original::vector<int> values;
+        for (uint32_t i = 0; i < batch; ++i) {
+            const int v = static_cast<int>(gen() % 1000);
+            values.pushEnd(v);
+            p3.push(v);
+        }
+        p1.pushAll(values.begin(), values.end());
+        p2.pushAll(values.begin(), values.end());
+        EXPECT_EQ(p1.size(), p3.size());
+        EXPECT_TRUE(comparePriques(p1, p3));
+        EXPECT_TRUE(comparePriques(p2, p3));
+    }
+}
+
+// Test popN and drainSorted return elements in popping order
+TEST(PriqueTest, PopNTest) {
+    original::prique<int, original::decreaseComparator> p({5, 9, 1, 7, 3, 8, 2});
+    const auto top3 = p.popN(3);
+    EXPECT_EQ(top3, (original::vector{9, 8, 7}));
+    EXPECT_EQ(p.size(), 4);
+    EXPECT_THROW(p.popN(5), original::noElementError);
+    EXPECT_EQ(p.size(), 4);
+    EXPECT_TRUE(p.popN(0).empty());
+
+    const auto rest = p.drainSorted();
+    EXPECT_EQ(rest, (original::vector{5, 3, 2, 1}));
+    EXPECT_TRUE(p.empty());
+    EXPECT_TRUE(p.drainSorted().empty());
+}
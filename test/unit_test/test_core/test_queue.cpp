@@ -1,9 +1,11 @@
 #include <gtest/gtest.h>
 #include <queue>  // std::queue
+#include <string>
 #include "queue.h"
 #include "forwardChain.h"
 #include "vector.h"
 #include "blocksList.h"
+#include "circularQueue.h"
 
 // Helper function to compare two queues (original::queue and std::queue)
 template <typename T, template <typename> typename SERIAL>
@@ -159,6 +161,40 @@ TEST(QueueTest, BlocksListQueue) {
     EXPECT_TRUE(q2.empty());
 }
 
+// Test queue with `circularQueue` as the underlying container
+TEST(QueueTest, CircularQueueQueue) {
+    original::queue<int, original::circularQueue> q1;
+    std::queue<int> q2;
+
+    EXPECT_EQ(q1.size(), 0);
+    EXPECT_TRUE(q1.empty());
+    EXPECT_TRUE(q2.empty());
+
+    // Test push, head, tail, pop
+    q1.push(10);
+    q2.push(10);
+    EXPECT_EQ(q1.head(), q2.front());
+    EXPECT_EQ(q1.tail(), q2.back());
+    EXPECT_TRUE(compareQueues(q1, q2));
+
+    q1.push(20);
+    q2.push(20);
+    EXPECT_EQ(q1.head(), q2.front());
+    EXPECT_EQ(q1.tail(), q2.back());
+    EXPECT_TRUE(compareQueues(q1, q2));
+
+    EXPECT_EQ(q1.pop(), 10);
+    q2.pop();
+    EXPECT_EQ(q1.head(), q2.front());
+    EXPECT_EQ(q1.tail(), q2.back());
+    EXPECT_TRUE(compareQueues(q1, q2));
+
+    q1.pop();
+    q2.pop();
+    EXPECT_TRUE(q1.empty());
+    EXPECT_TRUE(q2.empty());
+}
+
 // Test copy constructor
 TEST(QueueTest, CopyConstructor) {
     original::queue<int> q1;
@@ -222,4 +258,16 @@ TEST(QueueTest, MoveAssignmentOperator) {
 
     EXPECT_TRUE(compareQueues(q3, q2));
     EXPECT_TRUE(q1.empty());  // q1 should be empty after move
-}
\ No newline at end of file
+}
+
+// Test rvalue push and in-place emplace
+TEST(QueueTest, EmplaceTest) {
+    original::queue<std::string, original::blocksList> q;
+    std::string moved(64, 'm');
+    q.push(std::move(moved));
+    EXPECT_TRUE(moved.empty());
+    q.emplace(3, 'a');
+
+    EXPECT_EQ(q.pop(), std::string(64, 'm'));
+    EXPECT_EQ(q.pop(), "aaa");
+}
@@ -0,0 +1,90 @@
+#include <random>
+
+#include "rankSelect.h"
+#include "gtest/gtest.h"
+
+namespace {
+    original::bitSet randomBitSet(const uint32_t size, const uint32_t permille, const uint32_t seed)
+    {
+        original::bitSet bs(size);
+        std::mt19937 gen(seed);
+        for (uint32_t i = 0; i < size; ++i) {
+            if (gen() % 1000 < permille) bs.set(i, true);
+        }
+        return bs;
+    }
+
+    void checkAgainstScan(const original::bitSet& bs, const original::rankSelect& rs)
+    {
+        uint32_t ones = 0;
+        for (uint32_t i = 0; i <= bs.size(); ++i) {
+            ASSERT_EQ(rs.rank1(i), ones) << "at " << i;
+            ASSERT_EQ(rs.rank0(i), i - ones) << "at " << i;
+            if (i < bs.size() && bs.get(i)) {
+                ASSERT_EQ(rs.select1(ones), i) << "for " << ones;
+                ones += 1;
+            }
+        }
+        EXPECT_EQ(rs.ones(), ones);
+        EXPECT_THROW(static_cast<void>(rs.select1(ones)), original::outOfBoundError);
+    }
+}
+
+TEST(RankSelectTest, MatchesScan) {
+    for (const uint32_t size : {0u, 1u, 63u, 64u, 65u, 511u, 512u, 513u, 70000u, 200000u}) {
+        for (const uint32_t permille : {0u, 3u, 500u, 1000u}) {
+            const auto bs = randomBitSet(size, permille, size + permille);
+            const original::rankSelect rs(bs);
+            checkAgainstScan(bs, rs);
+        }
+    }
+}
+
+TEST(RankSelectTest, SparseSelect) {
+    // A handful of set bits spread over several superblocks, far apart from each other.
+    original::bitSet bs(1000000);
+    for (const uint32_t i : {3u, 65535u, 65536u, 400000u, 999999u}) {
+        bs.set(i, true);
+    }
+    const original::rankSelect rs(bs);
+    EXPECT_EQ(rs.select1(0), 3);
+    EXPECT_EQ(rs.select1(2), 65536);
+    EXPECT_EQ(rs.select1(4), 999999);
+    EXPECT_EQ(rs.rank1(1000000), 5);
+    EXPECT_EQ(rs.rank1(400000), 3);
+    EXPECT_EQ(rs.rank1(400001), 4);
+    EXPECT_THROW(static_cast<void>(rs.rank1(1000001)), original::outOfBoundError);
+}
+
+TEST(RankSelectTest, RebuildsAfterWrites) {
+    auto bs = randomBitSet(100000, 100, 7);
+    const original::rankSelect rs(bs);
+    EXPECT_FALSE(rs.stale());
+    const uint32_t before = rs.rank1(50000);
+
+    bs.set(10, !bs.get(10));
+    EXPECT_TRUE(rs.stale());
+    EXPECT_EQ(rs.rank1(50000), bs.get(10) ? before + 1 : before - 1);
+    EXPECT_FALSE(rs.stale());
+
+    bs.flip();
+    checkAgainstScan(bs, rs);
+    bs &= randomBitSet(100000, 500, 8);
+    checkAgainstScan(bs, rs);
+
+    const auto it = bs.begins();
+    it->set(!bs.get(0));
+    delete it;
+    EXPECT_TRUE(rs.stale());
+    checkAgainstScan(bs, rs);
+
+    bs = randomBitSet(3000, 900, 9);
+    checkAgainstScan(bs, rs);
+}
+
+TEST(RankSelectTest, Overhead) {
+    const original::bitSet bs(1 << 24);
+    const original::rankSelect rs(bs);
+    const double bits_bytes = (1 << 24) / 8.0;
+    EXPECT_LT(rs.sizeInBytes() / bits_bytes, 0.035);
+}
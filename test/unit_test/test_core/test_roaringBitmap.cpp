@@ -0,0 +1,209 @@
+#include <random>
+#include <set>
+
+#include "roaringBitmap.h"
+#include "gtest/gtest.h"
+
+namespace {
+    // Mixes a sparse chunk, a dense chunk and a chunk of long runs.
+    std::set<uint32_t> mixedValues(const uint32_t seed)
+    {
+        std::mt19937 gen(seed);
+        std::set<uint32_t> values;
+        for (int i = 0; i < 300; ++i) {
+            values.insert(gen() % 65536);
+        }
+        for (int i = 0; i < 20000; ++i) {
+            values.insert(3 * 65536 + gen() % 65536);
+        }
+        for (uint32_t start = 7 * 65536; start < 8 * 65536; start += 1000 + gen() % 1000) {
+            for (uint32_t v = start; v < start + 500; ++v) {
+                values.insert(v);
+            }
+        }
+        values.insert(UINT32_MAX);
+        return values;
+    }
+
+    original::roaringBitmap fromSet(const std::set<uint32_t>& values)
+    {
+        original::roaringBitmap rb;
+        for (const uint32_t v : values) {
+            rb.add(v);
+        }
+        return rb;
+    }
+
+    bool sameValues(const original::roaringBitmap& rb, const std::set<uint32_t>& values)
+    {
+        if (rb.cardinality() != values.size())
+            return false;
+        auto it = values.begin();
+        for (const uint32_t v : rb) {
+            if (v != *it++)
+                return false;
+        }
+        return true;
+    }
+}
+
+TEST(RoaringBitmapTest, AddRemoveContains) {
+    original::roaringBitmap rb;
+    EXPECT_TRUE(rb.empty());
+    EXPECT_TRUE(rb.add(5));
+    EXPECT_FALSE(rb.add(5));
+    EXPECT_TRUE(rb.add(1u << 20));
+    EXPECT_TRUE(rb.add(UINT32_MAX));
+    EXPECT_TRUE(rb.contains(5));
+    EXPECT_TRUE(rb.contains(UINT32_MAX));
+    EXPECT_FALSE(rb.contains(6));
+    EXPECT_EQ(rb.cardinality(), 3);
+
+    EXPECT_TRUE(rb.remove(1u << 20));
+    EXPECT_FALSE(rb.remove(1u << 20));
+    EXPECT_FALSE(rb.contains(1u << 20));
+    EXPECT_EQ(rb.cardinality(), 2);
+    EXPECT_EQ(rb.toString(false), "roaringBitmap(5, 4294967295)");
+
+    rb.clear();
+    EXPECT_TRUE(rb.empty());
+}
+
+TEST(RoaringBitmapTest, ChunkConversions) {
+    original::roaringBitmap rb;
+    for (uint32_t v = 0; v < 4096; ++v) {
+        rb.add(2 * v);
+    }
+    EXPECT_EQ(rb.kindOf(0), original::roaringBitmap::chunkKind::ARRAY);
+    rb.add(1);
+    EXPECT_EQ(rb.kindOf(0), original::roaringBitmap::chunkKind::BITMAP);
+    rb.remove(1);
+    EXPECT_EQ(rb.kindOf(0), original::roaringBitmap::chunkKind::ARRAY);
+    EXPECT_THROW(static_cast<void>(rb.kindOf(65536)), original::noElementError);
+
+    original::roaringBitmap runs;
+    for (uint32_t v = 100; v < 60000; ++v) {
+        runs.add(v);
+    }
+    const uint64_t before = runs.sizeInBytes();
+    EXPECT_TRUE(runs.runOptimize());
+    EXPECT_EQ(runs.kindOf(100), original::roaringBitmap::chunkKind::RUN);
+    EXPECT_LT(runs.sizeInBytes(), before / 100);
+    EXPECT_TRUE(runs.contains(100));
+    EXPECT_TRUE(runs.contains(59999));
+    EXPECT_FALSE(runs.contains(60000));
+
+    // Adding into a run chunk falls back to a plain chunk with the same values.
+    EXPECT_TRUE(runs.add(99));
+    EXPECT_EQ(runs.kindOf(100), original::roaringBitmap::chunkKind::BITMAP);
+    EXPECT_EQ(runs.cardinality(), 60000 - 99);
+}
+
+TEST(RoaringBitmapTest, SetOperations) {
+    const auto va = mixedValues(1);
+    const auto vb = mixedValues(2);
+    auto ra = fromSet(va);
+    auto rb = fromSet(vb);
+    ra.runOptimize();
+
+    std::set<uint32_t> both, either, exactlyOne, onlyA;
+    std::ranges::set_intersection(va, vb, std::inserter(both, both.end()));
+    std::ranges::set_union(va, vb, std::inserter(either, either.end()));
+    std::ranges::set_symmetric_difference(va, vb, std::inserter(exactlyOne, exactlyOne.end()));
+    std::ranges::set_difference(va, vb, std::inserter(onlyA, onlyA.end()));
+
+    EXPECT_TRUE(sameValues(ra & rb, both));
+    EXPECT_TRUE(sameValues(ra | rb, either));
+    EXPECT_TRUE(sameValues(ra ^ rb, exactlyOne));
+    auto diff = ra;
+    diff.andNot(rb);
+    EXPECT_TRUE(sameValues(diff, onlyA));
+
+    auto self = ra;
+    self ^= self;
+    EXPECT_TRUE(self.empty());
+}
+
+TEST(RoaringBitmapTest, RankSelect) {
+    const auto values = mixedValues(3);
+    auto rb = fromSet(values);
+    for (int pass = 0; pass < 2; ++pass) {
+        uint64_t k = 0;
+        for (const uint32_t v : values) {
+            if (k % 97 == 0 || v == UINT32_MAX) {
+                EXPECT_EQ(rb.select(k), v);
+                EXPECT_EQ(rb.rank(v), k + 1);
+                if (v > 0 && !values.contains(v - 1)) {
+                    EXPECT_EQ(rb.rank(v - 1), k);
+                }
+            }
+            ++k;
+        }
+        EXPECT_THROW(static_cast<void>(rb.select(values.size())), original::outOfBoundError);
+        rb.runOptimize();
+    }
+}
+
+TEST(RoaringBitmapTest, FromBitSetAndEquality) {
+    original::bitSet bs(200000);
+    for (uint32_t i = 0; i < 200000; i += 7) {
+        bs.set(i, true);
+    }
+    const original::roaringBitmap rb(bs);
+    EXPECT_EQ(rb.cardinality(), bs.count());
+    EXPECT_EQ(rb.select(0), 0);
+    EXPECT_EQ(rb.select(1), 7);
+
+    // Equality is about the values, not how the chunks store them.
+    auto optimized = fromSet(mixedValues(4));
+    const auto plain = optimized;
+    optimized.runOptimize();
+    EXPECT_TRUE(optimized == plain);
+    optimized.remove(7 * 65536 + 100);
+    EXPECT_FALSE(optimized == plain);
+}
+
+TEST(RoaringBitmapTest, Serialization) {
+    auto rb = fromSet(mixedValues(5));
+    rb.runOptimize();
+    const std::string data = rb.serialize();
+    EXPECT_EQ(data.substr(0, 4), "ORB1");
+    const auto restored = original::roaringBitmap::deserialize(data);
+    EXPECT_TRUE(restored == rb);
+    EXPECT_EQ(restored.kindOf(7 * 65536), original::roaringBitmap::chunkKind::RUN);
+
+    EXPECT_TRUE(original::roaringBitmap::deserialize(original::roaringBitmap().serialize()).empty());
+    EXPECT_THROW(original::roaringBitmap::deserialize(data.substr(0, data.size() - 1)), original::valueError);
+    EXPECT_THROW(original::roaringBitmap::deserialize(data + "x"), original::valueError);
+    EXPECT_THROW(original::roaringBitmap::deserialize("ORB2" + data.substr(4)), original::valueError);
+
+    const std::string single = original::roaringBitmap{258}.serialize();
+    EXPECT_EQ(single, std::string("ORB1\x01\x00\x00\x00" "\x00\x00" "\x00" "\x01\x00\x00\x00" "\x01\x00\x00\x00" "\x02\x01", 21));
+
+    // A chunk stored in the kind its cardinality does not call for is rejected.
+    const auto le = [](std::string& out, const uint64_t value, const int bytes) {
+        for (int i = 0; i < bytes; ++i) {
+            out += static_cast<char>(value >> 8 * i & 0xFF);
+        }
+    };
+    std::string dense_array = "ORB1";
+    le(dense_array, 1, 4);
+    le(dense_array, 0, 2);
+    le(dense_array, 0, 1);
+    le(dense_array, 4097, 4);
+    le(dense_array, 4097, 4);
+    for (uint32_t v = 0; v < 4097; ++v) {
+        le(dense_array, v, 2);
+    }
+    EXPECT_THROW(original::roaringBitmap::deserialize(dense_array), original::valueError);
+    std::string sparse_bitmap = "ORB1";
+    le(sparse_bitmap, 1, 4);
+    le(sparse_bitmap, 0, 2);
+    le(sparse_bitmap, 1, 1);
+    le(sparse_bitmap, 1, 4);
+    le(sparse_bitmap, 1024, 4);
+    for (uint32_t w = 0; w < 1024; ++w) {
+        le(sparse_bitmap, w == 0, 8);
+    }
+    EXPECT_THROW(original::roaringBitmap::deserialize(sparse_bitmap), original::valueError);
+}
@@ -0,0 +1,177 @@
+#include <random>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "deque.h"
+#include "prique.h"
+#include "queue.h"
+#include "ropeList.h"
+#include "stack.h"
+
+namespace {
+    template<typename TYPE>
+    void compareRopeList(const original::ropeList<TYPE>& list, const std::vector<TYPE>& expected)
+    {
+        ASSERT_EQ(list.size(), expected.size());
+        for (uint32_t i = 0; i < expected.size(); ++i) {
+            ASSERT_EQ(list.get(i), expected[i]) << "at " << i;
+        }
+        uint32_t i = 0;
+        for (auto it = list.begin(); it.isValid(); ++it, ++i) {
+            ASSERT_EQ(*it, expected[i]) << "iterating at " << i;
+        }
+        ASSERT_EQ(i, expected.size());
+    }
+}
+
+TEST(RopeListTest, BasicTest) {
+    original::ropeList<int> list = {1, 2, 3};
+    EXPECT_EQ(list.size(), 3);
+    EXPECT_EQ(list.get(-1), 3);
+    list.pushBegin(0);
+    list.pushEnd(4);
+    list.push(2, 10);
+    EXPECT_EQ(list.pop(2), 10);
+    list.set(1, 11);
+    list[2] += 10;
+    compareRopeList(list, {0, 11, 12, 3, 4});
+    EXPECT_EQ(list.indexOf(3), 3);
+    EXPECT_EQ(list.indexOf(7), list.size());
+    EXPECT_EQ(list.popBegin(), 0);
+    EXPECT_EQ(list.popEnd(), 4);
+    EXPECT_EQ(list.className(), "ropeList");
+
+    EXPECT_THROW(list.get(3), original::outOfBoundError);
+    EXPECT_THROW(list.push(4, 1), original::outOfBoundError);
+    EXPECT_THROW(list.pop(-4), original::outOfBoundError);
+    list.clear();
+    EXPECT_TRUE(list.empty());
+    EXPECT_THROW(list.popBegin(), original::noElementError);
+    EXPECT_THROW(list.popEnd(), original::noElementError);
+    EXPECT_FALSE(list.begin().isValid());
+}
+
+TEST(RopeListTest, RandomOpsTest) {
+    // Grows to a few levels and shrinks back to one leaf, checking against std::vector on the way.
+    original::ropeList<int> list;
+    std::vector<int> expected;
+    std::mt19937 gen(5);
+    int next = 0;
+    for (int round = 0; round < 2; ++round) {
+        const bool growing = round == 0;
+        for (int step = 0; step < 60000; ++step) {
+            const uint32_t size = expected.size();
+            const uint32_t op = gen() % 10;
+            if (growing ? (op < 7 || size == 0) : ((op < 3 && size > 0) || size == 0)) {
+                const uint32_t index = gen() % (size + 1);
+                list.push(index, next);
+                expected.insert(expected.begin() + index, next++);
+            } else if (op < 9) {
+                const uint32_t index = gen() % size;
+                ASSERT_EQ(list.pop(index), expected[index]);
+                expected.erase(expected.begin() + index);
+            } else {
+                const uint32_t index = gen() % size;
+                ASSERT_EQ(list.get(index), expected[index]);
+                list.set(index, -expected[index]);
+                expected[index] = -expected[index];
+            }
+            if (step % 5000 == 0) {
+                compareRopeList(list, expected);
+            }
+        }
+        if (growing) {
+            EXPECT_GE(list.height(), 2);
+        }
+        compareRopeList(list, expected);
+    }
+    while (!expected.empty()) {
+        ASSERT_EQ(list.popBegin(), expected.front());
+        expected.erase(expected.begin());
+    }
+    EXPECT_EQ(list.height(), 0);
+}
+
+TEST(RopeListTest, IteratorTest) {
+    original::ropeList<int> list;
+    for (int i = 0; i < 5000; ++i) {
+        list.pushEnd(i);
+    }
+
+    auto it = list.begin();
+    it += 4321;
+    EXPECT_EQ(*it, 4321);
+    it -= 4000;
+    EXPECT_EQ(*it, 321);
+    EXPECT_EQ(list.last() - it, 4999 - 321);
+
+    int expected = 4999;
+    for (auto r = list.last(); r.isValid(); --r) {
+        ASSERT_EQ(*r, expected--);
+    }
+    EXPECT_EQ(expected, -1);
+
+    // Stepping out of the list and back in lands on the same elements.
+    auto out = list.begin();
+    out -= 3;
+    EXPECT_FALSE(out.isValid());
+    out += 5;
+    EXPECT_EQ(*out, 2);
+    auto past = list.last();
+    past += 2;
+    EXPECT_FALSE(past.isValid());
+    --past;
+    --past;
+    EXPECT_EQ(*past, 4999);
+
+    for (auto& e : list) {
+        e *= 2;
+    }
+    EXPECT_EQ(list.get(2500), 5000);
+}
+
+TEST(RopeListTest, CopyMoveTest) {
+    original::ropeList<std::string> list;
+    for (int i = 0; i < 3000; ++i) {
+        list.push(list.size() / 2, std::to_string(i));
+    }
+    original::ropeList<std::string> copy = list;
+    EXPECT_EQ(copy, list);
+    copy.pop(10);
+    EXPECT_NE(copy, list);
+
+    original::ropeList<std::string> moved = std::move(copy);
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(moved.size(), 2999);
+    copy = moved;
+    EXPECT_EQ(copy, moved);
+    while (moved.size() > 100) {
+        moved.pop(moved.size() / 3);
+    }
+    EXPECT_EQ(moved.get(0), list.get(0));
+    EXPECT_EQ(moved.get(-1), list.get(-1));
+
+    const original::array<std::string> arr = {"a", "b", "c"};
+    const original::ropeList<std::string> from_array(arr);
+    EXPECT_EQ(from_array.get(2), "c");
+}
+
+TEST(RopeListTest, AdapterTest) {
+    original::stack<int, original::ropeList> s;
+    original::queue<int, original::ropeList> q;
+    original::deque<int, original::ropeList> d;
+    original::prique<int, original::increaseComparator, original::ropeList> p;
+    for (int i = 0; i < 2000; ++i) {
+        s.push(i);
+        q.push(i);
+        d.pushBegin(i);
+        p.push((i * 7919) % 2000);
+    }
+    for (int i = 0; i < 2000; ++i) {
+        EXPECT_EQ(s.pop(), 1999 - i);
+        EXPECT_EQ(q.pop(), i);
+        EXPECT_EQ(d.popEnd(), i);
+        EXPECT_EQ(p.pop(), i);
+    }
+    EXPECT_TRUE(s.empty() && q.empty() && d.empty() && p.empty());
+}
@@ -0,0 +1,184 @@
+#include <random>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "chain.h"
+#include "queue.h"
+#include "smallVector.h"
+#include "stack.h"
+
+namespace {
+    template<typename TYPE, uint32_t N>
+    void compareSmallVector(const original::smallVector<TYPE, N>& vec, const std::vector<TYPE>& expected)
+    {
+        ASSERT_EQ(vec.size(), expected.size());
+        for (uint32_t i = 0; i < expected.size(); ++i) {
+            ASSERT_EQ(vec.get(i), expected[i]) << "at " << i;
+        }
+        uint32_t i = 0;
+        for (auto it = vec.begin(); it.isValid(); ++it, ++i) {
+            ASSERT_EQ(*it, expected[i]) << "iterating at " << i;
+        }
+        ASSERT_EQ(i, expected.size());
+    }
+}
+
+TEST(SmallVectorTest, BasicTest) {
+    original::smallVector<int, 4> vec = {1, 2, 3};
+    EXPECT_TRUE(vec.isInline());
+    EXPECT_EQ(vec.capacity(), 4);
+    EXPECT_EQ(vec.get(-1), 3);
+    vec.pushBegin(0);
+    EXPECT_TRUE(vec.isInline());
+
+    // The fifth element moves everything to the heap.
+    vec.pushEnd(4);
+    EXPECT_FALSE(vec.isInline());
+    EXPECT_GE(vec.capacity(), 5);
+    vec.push(2, 10);
+    EXPECT_EQ(vec.pop(2), 10);
+    vec.set(1, 11);
+    vec[2] += 10;
+    compareSmallVector(vec, {0, 11, 12, 3, 4});
+    EXPECT_EQ(vec.indexOf(3), 3);
+    EXPECT_EQ(vec.indexOf(7), vec.size());
+    EXPECT_EQ(vec.popBegin(), 0);
+    EXPECT_EQ(vec.popEnd(), 4);
+    EXPECT_EQ(vec.className(), "smallVector");
+    EXPECT_EQ(vec.toString(false), "smallVector(11, 12, 3)");
+
+    EXPECT_THROW(vec.get(3), original::outOfBoundError);
+    EXPECT_THROW(vec.push(4, 1), original::outOfBoundError);
+    EXPECT_THROW(vec.pop(-4), original::outOfBoundError);
+    vec.shrinkToFit();
+    EXPECT_TRUE(vec.isInline());
+    compareSmallVector(vec, {11, 12, 3});
+    vec.clear();
+    EXPECT_TRUE(vec.empty());
+    EXPECT_THROW(vec.popBegin(), original::noElementError);
+    EXPECT_THROW(vec.popEnd(), original::noElementError);
+    EXPECT_FALSE(vec.begin().isValid());
+    EXPECT_EQ((original::smallVector<int, 4>::inlineCapacity()), 4);
+}
+
+TEST(SmallVectorTest, RandomOpsTest) {
+    // Moves back and forth between the inline storage and the heap, with elements owning memory.
+    original::smallVector<std::string, 6> vec;
+    std::vector<std::string> expected;
+    std::mt19937 gen(7);
+    for (int step = 0; step < 20000; ++step) {
+        const uint32_t size = expected.size();
+        const uint32_t op = gen() % 10;
+        const bool growing = step / 500 % 2 == 0 || size < 3;
+        if (size == 0 || (growing ? op < 6 : op < 3)) {
+            const uint32_t index = gen() % (size + 1);
+            std::string e(32, static_cast<char>('a' + step % 26));
+            e += std::to_string(step);
+            vec.push(index, e);
+            expected.insert(expected.begin() + index, e);
+        } else if (op < 9) {
+            const uint32_t index = gen() % size;
+            ASSERT_EQ(vec.pop(index), expected[index]);
+            expected.erase(expected.begin() + index);
+        } else {
+            vec.shrinkToFit();
+            ASSERT_EQ(vec.isInline(), expected.size() <= 6);
+        }
+        if (step % 100 == 0) {
+            compareSmallVector(vec, expected);
+        }
+    }
+    compareSmallVector(vec, expected);
+
+    // Pushing an element of the vector itself, also when that spills to the heap.
+    original::smallVector<std::string, 2> self = {"x", "y"};
+    self.pushEnd(self[0]);
+    self.pushBegin(self[2]);
+    self.emplace(1, self[-1]);
+    compareSmallVector(self, {"x", "x", "x", "y", "x"});
+}
+
+TEST(SmallVectorTest, CopyMoveTest) {
+    original::smallVector<std::string, 4> inlined = {"a", "b"};
+    original::smallVector<std::string, 4> spilled;
+    for (int i = 0; i < 10; ++i) {
+        spilled.pushEnd(std::to_string(i));
+    }
+
+    original::smallVector<std::string, 4> copy = inlined;
+    EXPECT_EQ(copy, inlined);
+    EXPECT_TRUE(copy.isInline());
+    copy = spilled;
+    EXPECT_EQ(copy, spilled);
+    copy.pop(3);
+    EXPECT_NE(copy, spilled);
+    copy = inlined;
+    EXPECT_EQ(copy, inlined);
+
+    original::smallVector<std::string, 4> moved = std::move(inlined);
+    EXPECT_TRUE(inlined.empty());
+    EXPECT_TRUE(moved.isInline());
+    compareSmallVector(moved, {"a", "b"});
+
+    const std::string* heap = &spilled.data();
+    moved = std::move(spilled);
+    EXPECT_TRUE(spilled.empty());
+    EXPECT_TRUE(spilled.isInline());
+    EXPECT_EQ(&moved.data(), heap);
+    EXPECT_EQ(moved.get(9), "9");
+    spilled.pushEnd("reused");
+    EXPECT_EQ(spilled.get(0), "reused");
+
+    const original::array<std::string> arr = {"a", "b", "c", "d", "e"};
+    const original::smallVector<std::string, 4> from_array(arr);
+    EXPECT_EQ(from_array.get(4), "e");
+    const original::chain<std::string> c = {"x", "y"};
+    const original::smallVector<std::string, 4> from_chain(c.begin(), c.end());
+    compareSmallVector(from_chain, {"x", "y"});
+}
+
+TEST(SmallVectorTest, ReserveAndFastRangeTest) {
+    original::smallVector<int, 8> vec;
+    vec.reserve(8);
+    EXPECT_TRUE(vec.isInline());
+    vec.reserve(100);
+    EXPECT_FALSE(vec.isInline());
+    const int* body = &vec.data();
+    for (int i = 0; i < 100; ++i) {
+        vec.pushEnd(i);
+    }
+    EXPECT_EQ(&vec.data(), body);
+
+    int sum = 0;
+    for (const int e : original::fast(vec)) {
+        sum += e;
+    }
+    EXPECT_EQ(sum, 4950);
+    for (auto& e : vec) {
+        e = -e;
+    }
+    EXPECT_EQ(vec.get(-1), -99);
+    EXPECT_EQ(vec.asSpan().size(), 100);
+
+    auto it = vec.begin();
+    it += 40;
+    EXPECT_EQ(*it, -40);
+    EXPECT_EQ(vec.last() - it, 59);
+
+    const original::smallVector<int, 8> empty;
+    EXPECT_EQ(empty.fastBegin(), empty.fastEnd());
+}
+
+TEST(SmallVectorTest, AdapterTest) {
+    original::stack<int, original::smallVector> s;
+    original::queue<int, original::smallVector> q;
+    for (int i = 0; i < 100; ++i) {
+        s.push(i);
+        q.push(i);
+    }
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(s.pop(), 99 - i);
+        EXPECT_EQ(q.pop(), i);
+    }
+    EXPECT_TRUE(s.empty() && q.empty());
+}
@@ -0,0 +1,168 @@
+#include <cstring>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+
+#include "algorithms.h"
+#include "blocksList.h"
+#include "span.h"
+#include "vector.h"
+#include "gtest/gtest.h"
+
+TEST(SpanTest, ViewsVectorAndArray) {
+    original::vector<int> vec;
+    for (int i = 0; i < 10; ++i) {
+        vec.pushEnd(i);
+    }
+    vec.pushBegin(-1);
+    const auto s = vec.asSpan();
+    EXPECT_EQ(s.size(), 11);
+    EXPECT_EQ(s.data(), &vec.data());
+    EXPECT_EQ(s.sizeInBytes(), 11 * sizeof(int));
+    EXPECT_EQ(s.get(0), -1);
+    EXPECT_EQ(s.get(-1), 9);
+    EXPECT_THROW(static_cast<void>(s.get(11)), original::outOfBoundError);
+
+    // Writes through the span land in the vector.
+    s.data()[1] = 100;
+    EXPECT_EQ(vec.get(1), 100);
+
+    int raw[11];
+    std::memcpy(raw, s.data(), s.sizeInBytes());
+    EXPECT_EQ(raw[10], 9);
+
+    original::array<int> arr = {3, 1, 2};
+    auto as = arr.asSpan();
+    as[0] = 4;
+    EXPECT_EQ(arr.get(0), 4);
+    EXPECT_TRUE(original::array<int>().asSpan().empty());
+}
+
+TEST(SpanTest, ConstOwnersAreReadOnly) {
+    const original::vector<int> vec = {1, 2, 3, 4};
+    const auto s = vec.asSpan();
+    static_assert(std::is_same_v<decltype(s), const original::span<const int>>);
+    EXPECT_EQ(s.data(), &vec.data());
+    EXPECT_EQ(s.get(-1), 4);
+    EXPECT_EQ(s.slice(1, 3).toString(false), "span(2, 3)");
+    auto copied = s;
+    EXPECT_THROW(copied.set(0, 5), original::unSupportedMethodError);
+    EXPECT_THROW(s.begin().set(5), original::unSupportedMethodError);
+
+    int sum = 0;
+    for (const int e : s) {
+        sum += e;
+    }
+    for (const int e : original::fast(s)) {
+        sum += e;
+    }
+    EXPECT_EQ(sum, 20);
+    EXPECT_EQ(vec.get(0), 1);
+
+    // A writable view converts to a read-only one, not the other way around.
+    original::array<int> arr = {5, 6};
+    const original::span<const int> view = arr.asSpan();
+    EXPECT_EQ(view.get(1), 6);
+    static_assert(!std::is_convertible_v<original::span<const int>, original::span<int>>);
+    static_assert(std::is_same_v<decltype(std::as_const(arr).asSpan()), original::span<const int>>);
+
+    original::blocksList<int> list = {7, 8, 9};
+    static_assert(std::is_same_v<decltype(std::as_const(list).blockSpan(0)), original::span<const int>>);
+    EXPECT_EQ(std::as_const(list).blockSpan(0).get(0), 7);
+}
+
+TEST(SpanTest, SliceAndSubspan) {
+    original::array<int> arr = {0, 1, 2, 3, 4, 5, 6, 7};
+    const auto s = arr.asSpan();
+
+    const auto sub = s.subspan(2, 3);
+    EXPECT_EQ(sub.toString(false), "span(2, 3, 4)");
+    EXPECT_EQ(s.subspan(8, 0).size(), 0);
+    EXPECT_THROW(static_cast<void>(s.subspan(6, 3)), original::outOfBoundError);
+
+    EXPECT_EQ(s.slice(1, -1).toString(false), "span(1, 2, 3, 4, 5, 6)");
+    EXPECT_EQ(s.slice(-3, 8).toString(false), "span(5, 6, 7)");
+    EXPECT_EQ(sub.slice(1, 2).get(0), 3);
+    EXPECT_THROW(static_cast<void>(s.slice(5, 4)), original::outOfBoundError);
+    EXPECT_THROW(static_cast<void>(s.slice(0, 9)), original::outOfBoundError);
+
+    int sum = 0;
+    for (const int e : sub) {
+        sum += e;
+    }
+    for (const int e : original::fast(sub)) {
+        sum += e;
+    }
+    EXPECT_EQ(sum, 18);
+    EXPECT_EQ(sub.indexOf(4), 2);
+    EXPECT_EQ(sub.indexOf(7), 3);
+}
+
+TEST(SpanTest, BlocksListBlocks) {
+    original::blocksList<int> list;
+    EXPECT_EQ(list.blockCount(), 0);
+    for (int i = 0; i < 40; ++i) {
+        list.pushEnd(i);
+    }
+    for (int i = 1; i <= 5; ++i) {
+        list.pushBegin(-i);
+    }
+
+    int expected = -5;
+    uint32_t seen = 0;
+    for (uint32_t b = 0; b < list.blockCount(); ++b) {
+        for (const int e : original::fast(list.blockSpan(b))) {
+            EXPECT_EQ(e, expected++);
+            seen += 1;
+        }
+    }
+    EXPECT_EQ(seen, list.size());
+    EXPECT_THROW(static_cast<void>(list.blockSpan(list.blockCount())), original::outOfBoundError);
+}
+
+TEST(SpanTest, Algorithms) {
+    original::vector<int> vec;
+    for (int i = 0; i < 1000; ++i) {
+        vec.pushEnd((i * 7919) % 1000);
+    }
+    const auto s = vec.asSpan();
+
+    original::algorithms::sort(s.subspan(0, 500));
+    EXPECT_TRUE(std::is_sorted(s.fastBegin(), s.fastBegin() + 500));
+    original::algorithms::sort(s, original::decreaseComparator<int>{});
+    EXPECT_EQ(vec.get(0), 999);
+    EXPECT_EQ(vec.get(-1), 0);
+
+    // The iterator overloads take the contiguous path over a span as well.
+    original::algorithms::sort(s.first(), s.last());
+    EXPECT_EQ(vec.get(0), 0);
+
+    original::algorithms::nthElement(s, 10, original::decreaseComparator<int>{});
+    EXPECT_EQ(vec.get(10), 989);
+    original::algorithms::partialSort(s, 3);
+    EXPECT_EQ(s.slice(0, 3).toString(false), "span(0, 1, 2)");
+    original::algorithms::stableSort(s);
+    EXPECT_EQ(vec.get(500), 500);
+
+    EXPECT_EQ(original::algorithms::count(s, 7), 1);
+    EXPECT_EQ(original::algorithms::count(s, [](const int e) { return e % 2 == 0; }), 500);
+    original::algorithms::fill(s.slice(0, 10), -1);
+    EXPECT_EQ(original::algorithms::count(s, -1), 10);
+    original::algorithms::forEach(s, [](int& e) { e += 1; });
+    EXPECT_EQ(vec.get(0), 0);
+    EXPECT_EQ(vec.get(-1), 1000);
+
+    // Overlapping copies move the elements as if through a temporary.
+    const auto moved = original::algorithms::copy(s.subspan(0, 20), s.subspan(5, 20));
+    EXPECT_EQ(moved.data(), s.data() + 5);
+    EXPECT_EQ(vec.get(14), 0);
+    EXPECT_EQ(vec.get(15), 11);
+    EXPECT_EQ(vec.get(24), 20);
+    original::algorithms::copy(s.subspan(10, 20), s.subspan(0, 20));
+    EXPECT_EQ(vec.get(4), 0);
+    EXPECT_EQ(vec.get(5), 11);
+    EXPECT_THROW(static_cast<void>(original::algorithms::copy(s, s.subspan(0, 10))), original::outOfBoundError);
+
+    original::algorithms::sort(original::span<int>());
+    EXPECT_EQ(original::algorithms::count(original::span<int>(), 0), 0);
+}
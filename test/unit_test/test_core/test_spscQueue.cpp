@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <thread>
+#include "error.h"
+#include "spscQueue.h"
+
+namespace original {
+
+    // 测试容量取整与单线程下的先进先出
+    TEST(SpscQueueTest, BasicTest) {
+        spscQueue<int> q(5);
+        EXPECT_EQ(q.capacity(), 8);
+        EXPECT_TRUE(q.empty());
+        for (int i = 0; i < 8; ++i) {
+            EXPECT_TRUE(q.tryPush(i));
+        }
+        EXPECT_FALSE(q.tryPush(8));
+        EXPECT_EQ(q.size(), 8);
+        int e = -1;
+        for (int i = 0; i < 8; ++i) {
+            EXPECT_TRUE(q.tryPop(e));
+            EXPECT_EQ(e, i);
+        }
+        EXPECT_FALSE(q.tryPop(e));
+        EXPECT_THROW(spscQueue<int>(0), valueError);
+        EXPECT_THROW(spscQueue<int>((1u << 31) + 1), valueError);
+    }
+
+    // 测试批量入队与出队, 包括绕过缓冲区末尾
+    TEST(SpscQueueTest, BatchTest) {
+        spscQueue<int> q(8);
+        int src[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+        int dst[10] = {};
+        EXPECT_EQ(q.pushBatch(src, 5), 5);
+        EXPECT_EQ(q.popBatch(dst, 3), 3);
+        EXPECT_EQ(q.pushBatch(src + 5, 5), 5);
+        EXPECT_EQ(q.pushBatch(src, 10), 1);
+        EXPECT_EQ(q.popBatch(dst, 10), 8);
+        const int expected[8] = {3, 4, 5, 6, 7, 8, 9, 0};
+        for (int i = 0; i < 8; ++i) {
+            EXPECT_EQ(dst[i], expected[i]);
+        }
+        EXPECT_EQ(q.popBatch(dst, 10), 0);
+    }
+
+    // 测试只能移动的元素以及析构时释放剩余元素
+    TEST(SpscQueueTest, MoveOnlyTest) {
+        spscQueue<std::unique_ptr<std::string>> q(4);
+        auto p = std::make_unique<std::string>("a");
+        EXPECT_TRUE(q.tryPush(std::move(p)));
+        EXPECT_EQ(p, nullptr);
+        q.push(std::make_unique<std::string>("b"));
+        q.push(std::make_unique<std::string>("c"));
+        EXPECT_EQ(*q.pop(), "a");
+        EXPECT_EQ(q.size(), 2);
+    }
+
+    // 测试一个生产者与一个消费者并发时元素不丢失且保持顺序
+    TEST(SpscQueueTest, ConcurrentStressTest) {
+        constexpr int64_t total = 200000;
+        spscQueue<int64_t> q(64);
+        std::thread producer([&q] {
+            int64_t batch[16];
+            int64_t next = 0;
+            while (next < total) {
+                if (next % 3 == 0) {
+                    q.push(next);
+                    next += 1;
+                } else {
+                    uint32_t n = 0;
+                    for (; n < 16 && next + n < total; ++n) {
+                        batch[n] = next + n;
+                    }
+                    next += q.pushBatch(batch, n);
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+        int64_t expected = 0;
+        int64_t batch[8];
+        while (expected < total) {
+            if (expected % 2 == 0) {
+                ASSERT_EQ(q.pop(), expected);
+                expected += 1;
+            } else {
+                const uint32_t n = q.popBatch(batch, 8);
+                for (uint32_t i = 0; i < n; ++i) {
+                    ASSERT_EQ(batch[i], expected);
+                    expected += 1;
+                }
+            }
+        }
+        producer.join();
+        EXPECT_TRUE(q.empty());
+    }
+}
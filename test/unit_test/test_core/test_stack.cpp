@@ -1,9 +1,12 @@
 #include <gtest/gtest.h>
 #include <stack>  // std::stack
+#include <string>
+#include <type_traits>
 #include "stack.h"
 #include "forwardChain.h"
 #include "vector.h"
 #include "blocksList.h"
+#include "circularQueue.h"
 
 // Helper function to check stack equality (compare original::stack with std::stack)
 template <typename T, template <typename> typename SERIAL>
@@ -146,6 +149,37 @@ TEST(StackTest, BlocksListStack) {
     EXPECT_TRUE(s2.empty());
 }
 
+// Test stack with `circularQueue` as the underlying container
+TEST(StackTest, CircularQueueStack) {
+    original::stack<int, original::circularQueue> s1;
+    std::stack<int> s2;
+
+    EXPECT_EQ(s1.size(), 0);
+    EXPECT_TRUE(s1.empty());
+    EXPECT_TRUE(s2.empty());
+
+    // Test push, pop, and top
+    s1.push(10);
+    s2.push(10);
+    EXPECT_EQ(s1.top(), s2.top());
+    EXPECT_TRUE(compareStacks(s1, s2));
+
+    s1.push(20);
+    s2.push(20);
+    EXPECT_EQ(s1.top(), s2.top());
+    EXPECT_TRUE(compareStacks(s1, s2));
+
+    EXPECT_EQ(s1.pop(), 20);
+    s2.pop();
+    EXPECT_EQ(s1.top(), s2.top());
+    EXPECT_TRUE(compareStacks(s1, s2));
+
+    s1.pop();
+    s2.pop();
+    EXPECT_TRUE(s1.empty());
+    EXPECT_TRUE(s2.empty());
+}
+
 // Test copy constructor
 TEST(StackTest, CopyConstructor) {
     original::stack<int> s1;
@@ -210,3 +244,35 @@ TEST(StackTest, MoveAssignmentOperator) {
     EXPECT_TRUE(s1.empty());  // s1 should be empty after move
 }
 
+// Test rvalue push and in-place emplace
+TEST(StackTest, EmplaceTest) {
+    original::stack<std::string> s;
+    std::string moved(64, 'm');
+    s.push(std::move(moved));
+    EXPECT_TRUE(moved.empty());
+    s.emplace(3, 'a');
+
+    original::stack<std::string, original::vector> vs;
+    vs.emplace("vector");
+
+    EXPECT_EQ(s.pop(), "aaa");
+    EXPECT_EQ(s.pop(), std::string(64, 'm'));
+    EXPECT_EQ(vs.top(), "vector");
+}
+
+// Test the single parameter aliases of the lists taking extra template parameters
+TEST(StackTest, DefaultListAliasTest) {
+    static_assert(std::is_same_v<original::stack<int>, original::stack<int, original::defaultChain>>);
+    original::stack<int, original::defaultBlocksList> bs;
+    original::stack<int, original::defaultForwardChain> fs;
+    std::stack<int> s2;
+    for (int i = 0; i < 100; ++i) {
+        bs.push(i);
+        fs.push(i);
+        s2.push(i);
+    }
+    EXPECT_TRUE(compareStacks(bs, s2));
+    EXPECT_TRUE(compareStacks(fs, s2));
+    EXPECT_EQ(bs.pop(), 99);
+    EXPECT_EQ(fs.pop(), 99);
+}
@@ -0,0 +1,69 @@
+#include <atomic>
+#include <gtest/gtest.h>
+#include "error.h"
+#include "threadPool.h"
+
+namespace original {
+
+    // 测试 parallelFor 恰好执行每个分块一次
+    TEST(ThreadPoolTest, ParallelForCoversChunksTest) {
+        threadPool pool(4);
+        constexpr int64_t chunks = 1000;
+        std::atomic<int> hits[chunks] = {};
+        pool.parallelFor(chunks, [&hits](const int64_t i) {
+            hits[i].fetch_add(1);
+        });
+        for (const auto& hit : hits) {
+            EXPECT_EQ(hit.load(), 1);
+        }
+    }
+
+    // 测试没有工作线程时在调用线程上执行
+    TEST(ThreadPoolTest, NoWorkersTest) {
+        threadPool pool(0);
+        EXPECT_EQ(pool.size(), 0);
+        int64_t sum = 0;
+        pool.parallelFor(10, [&sum](const int64_t i) {
+            sum += i;
+        });
+        EXPECT_EQ(sum, 45);
+    }
+
+    // 测试分块中的异常传递给调用线程
+    TEST(ThreadPoolTest, ExceptionTest) {
+        threadPool pool(4);
+        EXPECT_THROW(pool.parallelFor(100, [](const int64_t i) {
+            if (i == 42) throw valueError();
+        }), valueError);
+
+        std::atomic<int> cnt = 0;
+        pool.parallelFor(100, [&cnt](int64_t) {
+            cnt.fetch_add(1);
+        });
+        EXPECT_EQ(cnt.load(), 100);
+    }
+
+    // 测试在工作线程内嵌套调用不会死锁
+    TEST(ThreadPoolTest, NestedTest) {
+        threadPool pool(2);
+        std::atomic<int> cnt = 0;
+        pool.parallelFor(8, [&pool, &cnt](int64_t) {
+            pool.parallelFor(8, [&cnt](int64_t) {
+                cnt.fetch_add(1);
+            });
+        });
+        EXPECT_EQ(cnt.load(), 64);
+    }
+
+    // 测试 submit 提交的任务最终执行
+    TEST(ThreadPoolTest, SubmitTest) {
+        std::atomic<int> cnt = 0;
+        {
+            threadPool pool(3);
+            for (int i = 0; i < 50; ++i) {
+                pool.submit([&cnt] { cnt.fetch_add(1); });
+            }
+        }
+        EXPECT_EQ(cnt.load(), 50);
+    }
+}
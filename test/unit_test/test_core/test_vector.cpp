@@ -1,6 +1,9 @@
 #include <algorithm>
 #include <gtest/gtest.h>
 #include "vector.h"
+#include "chain.h"
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 // 对比函数，用于比较 original::vector 和 std::vector
@@ -351,3 +354,239 @@ TEST_F(VectorTest, MixedPushPopTest) {
 
     compareVectors(this->originalVec, this->stdVec);
 }
+
+namespace {
+    // 构造失败的元素类型: 负值构造时抛出, moves_left 减到 0 时下一次移动抛出
+    struct fragile {
+        static inline int64_t alive = 0;
+        static inline int moves_left = -1;
+        int value;
+
+        explicit fragile(const int v) : value(v) {
+            if (v < 0) throw std::runtime_error("fragile");
+            alive += 1;
+        }
+        fragile(const fragile& other) : value(other.value) { alive += 1; }
+        fragile(fragile&& other) : value(other.value) {
+            if (moves_left == 0) {
+                moves_left = -1;
+                throw std::runtime_error("fragile move");
+            }
+            if (moves_left > 0) moves_left -= 1;
+            alive += 1;
+        }
+        fragile& operator=(const fragile& other) = default;
+        fragile& operator=(fragile&& other) = default;
+        ~fragile() { alive -= 1; }
+
+        bool operator==(const fragile& other) const { return value == other.value; }
+        bool operator!=(const fragile& other) const { return value != other.value; }
+        bool operator<(const fragile& other) const { return value < other.value; }
+        friend std::ostream& operator<<(std::ostream& os, const fragile& f) { return os << f.value; }
+    };
+
+    // 没有默认构造函数的元素类型，同时统计存活对象数量
+    struct tracked {
+        static inline int64_t alive = 0;
+        std::string value;
+
+        explicit tracked(std::string v) : value(std::move(v)) { alive += 1; }
+        tracked(const tracked& other) : value(other.value) { alive += 1; }
+        tracked(tracked&& other) noexcept : value(std::move(other.value)) { alive += 1; }
+        tracked& operator=(const tracked& other) = default;
+        tracked& operator=(tracked&& other) noexcept = default;
+        ~tracked() { alive -= 1; }
+
+        bool operator==(const tracked& other) const { return value == other.value; }
+        bool operator!=(const tracked& other) const { return value != other.value; }
+        bool operator<(const tracked& other) const { return value < other.value; }
+        friend std::ostream& operator<<(std::ostream& os, const tracked& t) { return os << t.value; }
+    };
+}
+
+// 测试非默认构造类型以及非平凡类型的搬移
+TEST_F(VectorTest, NonDefaultConstructibleTest) {
+    {
+        original::vector<tracked> vec;
+        std::vector<std::string> expected;
+        for (int i = 0; i < 200; ++i) {
+            vec.pushEnd(tracked(std::to_string(i)));
+            expected.push_back(std::to_string(i));
+            vec.pushBegin(tracked("b" + std::to_string(i)));
+            expected.insert(expected.begin(), "b" + std::to_string(i));
+        }
+        for (int i = 0; i < 100; ++i) {
+            const int64_t idx = i * 3 % static_cast<int64_t>(expected.size());
+            vec.push(idx, tracked("m" + std::to_string(i)));
+            expected.insert(expected.begin() + idx, "m" + std::to_string(i));
+        }
+        for (int i = 0; i < 50; ++i) {
+            const int64_t idx = i * 7 % static_cast<int64_t>(expected.size());
+            ASSERT_EQ(vec.pop(idx).value, expected[idx]);
+            expected.erase(expected.begin() + idx);
+        }
+        ASSERT_EQ(vec.popBegin().value, expected.front());
+        expected.erase(expected.begin());
+        ASSERT_EQ(vec.popEnd().value, expected.back());
+        expected.pop_back();
+
+        ASSERT_EQ(vec.size(), expected.size());
+        for (uint32_t i = 0; i < vec.size(); ++i) {
+            ASSERT_EQ(vec.get(i).value, expected[i]);
+        }
+        EXPECT_EQ(tracked::alive, static_cast<int64_t>(expected.size()));
+
+        const original::vector<tracked> copied(vec);
+        EXPECT_EQ(tracked::alive, static_cast<int64_t>(2 * expected.size()));
+        original::vector<tracked> moved(std::move(vec));
+        EXPECT_EQ(tracked::alive, static_cast<int64_t>(2 * expected.size()));
+        EXPECT_EQ(moved.size(), copied.size());
+        EXPECT_EQ(vec.size(), 0);
+    }
+    // 只销毁存活区间内的元素
+    EXPECT_EQ(tracked::alive, 0);
+}
+
+// 测试元素构造抛出异常时向量保持原状
+TEST_F(VectorTest, ThrowingEmplaceTest) {
+    {
+        original::vector<fragile> vec;
+        vec.reserve(32);
+        for (int i = 0; i < 10; ++i) {
+            vec.emplaceEnd(i);
+        }
+        const auto check = [&vec] {
+            ASSERT_EQ(vec.size(), 10);
+            for (int i = 0; i < 10; ++i) {
+                ASSERT_EQ(vec.get(i).value, i);
+            }
+            ASSERT_EQ(fragile::alive, 10);
+        };
+        EXPECT_THROW(vec.emplaceBegin(-1), std::runtime_error);
+        check();
+        EXPECT_THROW(vec.emplace(4, -1), std::runtime_error);
+        check();
+        // 前半段移动两个元素腾出位置后, 新元素移入时失败
+        fragile::moves_left = 2;
+        EXPECT_THROW(vec.emplace(2, 100), std::runtime_error);
+        check();
+        // 后半段同样
+        fragile::moves_left = 2;
+        EXPECT_THROW(vec.emplace(8, 100), std::runtime_error);
+        check();
+        vec.emplace(8, 100);
+        vec.emplaceBegin(-0);
+        EXPECT_EQ(vec.size(), 12);
+        EXPECT_EQ(vec.get(9).value, 100);
+    }
+    EXPECT_EQ(fragile::alive, 0);
+}
+
+// 测试右值插入与原位构造
+TEST_F(VectorTest, EmplaceTest) {
+    original::vector<std::string> vec;
+    std::string moved(64, 'm');
+    vec.pushEnd(std::move(moved));
+    EXPECT_TRUE(moved.empty());
+    vec.emplaceEnd(3, 'a');
+    vec.emplaceBegin("begin");
+    vec.emplace(1, "middle", 3);
+    vec.push(2, std::string("pushed"));
+
+    const std::vector<std::string> expected = {"begin", "mid", "pushed", std::string(64, 'm'), "aaa"};
+    ASSERT_EQ(vec.size(), expected.size());
+    for (uint32_t i = 0; i < vec.size(); ++i) {
+        EXPECT_EQ(vec.get(i), expected[i]);
+    }
+
+    // 参数引用容器自身元素时，扩容不能使其失效
+    for (int i = 0; i < 100; ++i) {
+        vec.emplaceEnd(vec[0]);
+        vec.emplaceBegin(vec[-1]);
+        vec.emplace(vec.size() / 2, vec[1]);
+    }
+    for (uint32_t i = 0; i < vec.size(); ++i) {
+        EXPECT_FALSE(vec.get(i).empty());
+    }
+}
+
+// 测试预留容量与收缩
+TEST_F(VectorTest, ReserveShrinkTest) {
+    EXPECT_GE(this->originalVec.capacity(), 0);
+    this->originalVec.reserve(1000);
+    EXPECT_GE(this->originalVec.capacity(), 1000);
+
+    // 预留后追加不会重新分配
+    const int* body = &this->originalVec.data();
+    for (int i = 0; i < 1000; ++i) {
+        this->originalVec.pushEnd(i);
+        this->stdVec.push_back(i);
+    }
+    EXPECT_EQ(&this->originalVec.data(), body);
+    compareVectors(this->originalVec, this->stdVec);
+
+    for (int i = 0; i < 900; ++i) {
+        this->originalVec.popEnd();
+        this->stdVec.pop_back();
+    }
+    this->originalVec.shrinkToFit();
+    EXPECT_EQ(this->originalVec.capacity(), 100);
+    compareVectors(this->originalVec, this->stdVec);
+
+    // 收缩后仍可在两端插入
+    this->originalVec.pushBegin(-1);
+    this->stdVec.insert(this->stdVec.begin(), -1);
+    this->originalVec.pushEnd(-2);
+    this->stdVec.push_back(-2);
+    compareVectors(this->originalVec, this->stdVec);
+
+    original::vector<int> small = {1, 2, 3};
+    small.shrinkToFit();
+    EXPECT_GE(small.capacity(), 3);
+    small.pushBegin(0);
+    EXPECT_EQ(small.get(0), 0);
+    EXPECT_EQ(small.get(3), 3);
+}
+
+// 测试区间构造与批量追加
+TEST_F(VectorTest, RangePushEndTest) {
+    const original::chain<int> c = {1, 2, 3, 4, 5};
+    original::vector<int> fromChain(c.begin(), c.end());
+    compareVectors(fromChain, {1, 2, 3, 4, 5});
+
+    this->originalVec.pushBegin(0);
+    this->originalVec.pushEnd(fromChain.begin(), fromChain.end());
+    this->originalVec.pushEnd(c.begin(), c.begin());
+    compareVectors(this->originalVec, {0, 1, 2, 3, 4, 5});
+
+    original::vector<int> large;
+    for (int i = 0; i < 1000; ++i) {
+        large.pushEnd(i);
+        this->stdVec.push_back(i);
+    }
+    const original::vector<int> copied(large.begin(), large.end());
+    compareVectors(copied, this->stdVec);
+}
+
+// 测试不经过虚函数的快速遍历
+TEST_F(VectorTest, FastRangeTest) {
+    for (int i = 0; i < 100; ++i) {
+        this->originalVec.pushEnd(i);
+        this->originalVec.pushBegin(-i);
+    }
+    int sum = 0;
+    for (const int e : original::fast(this->originalVec)) {
+        sum += e;
+    }
+    EXPECT_EQ(sum, 0);
+    for (auto& e : original::fast(this->originalVec)) {
+        e *= 2;
+    }
+    EXPECT_EQ(this->originalVec.get(0), -198);
+    EXPECT_EQ(this->originalVec.get(-1), 198);
+    EXPECT_EQ(this->originalVec.fastEnd() - this->originalVec.fastBegin(), 200);
+    EXPECT_EQ(this->originalVec.fastBegin(), &this->originalVec.data());
+
+    const original::vector<int> empty;
+    EXPECT_EQ(empty.fastBegin(), empty.fastEnd());
+}